@@ -9,12 +9,14 @@
  // Arguments:
  // - cchRowWidth - the length of the default text attribute
  // - attr - the default text attribute
+ // - table - the table to intern this row's attributes in. Must outlive the row.
  // Return Value:
  // - constructed object
  // Note: will throw exception if unable to allocate memory for text attribute storage
-ATTR_ROW::ATTR_ROW(const UINT cchRowWidth, const TextAttribute attr)
+ATTR_ROW::ATTR_ROW(const UINT cchRowWidth, const TextAttribute attr, TextAttributeTable& table) :
+    _pTable{ &table }
 {
-    _list.push_back(TextAttributeRun(cchRowWidth, attr));
+    _list.push_back({ _pTable->Intern(attr), gsl::narrow<uint16_t>(cchRowWidth) });
     _cchRowWidth = cchRowWidth;
 }
 
@@ -24,8 +26,10 @@ ATTR_ROW::ATTR_ROW(const UINT cchRowWidth, const TextAttribute attr)
 // - attr - The default text attributes to use on text in this row.
 void ATTR_ROW::Reset(const TextAttribute attr)
 {
+    const IdRun run{ _pTable->Intern(attr), gsl::narrow<uint16_t>(_cchRowWidth) };
     _list.clear();
-    _list.push_back(TextAttributeRun(_cchRowWidth, attr));
+    _list.push_back(run);
+    _UpdateDenseIndex();
 }
 
 // Routine Description:
@@ -49,7 +53,7 @@ void ATTR_ROW::Resize(const size_t newWidth)
         auto& run = _list[runPos];
 
         // Extend its length by the additional columns we're adding.
-        run.SetLength(run.GetLength() + newWidth - _cchRowWidth);
+        run.length = gsl::narrow<uint16_t>(run.length + newWidth - _cchRowWidth);
 
         // Store that the new total width we represent is the new width.
         _cchRowWidth = newWidth;
@@ -67,7 +71,7 @@ void ATTR_ROW::Resize(const size_t newWidth)
         // then when we called FindAttrIndex, it returned the B5 as the pIndexedRun and a 2 for how many more segments it covers
         // after and including the 3rd column.
         // B5-2 = B3, which is what we desire to cover the new 3 size buffer.
-        run.SetLength(run.GetLength() - CountOfAttr + 1);
+        run.length = gsl::narrow<uint16_t>(run.length - CountOfAttr + 1);
 
         // Store that the new total width we represent is the new width.
         _cchRowWidth = newWidth;
@@ -79,6 +83,8 @@ void ATTR_ROW::Resize(const size_t newWidth)
         // in memory. We're not going to waste time redimensioning the array in the heap. We're just noting that the useful
         // portions of it have changed.
     }
+
+    _UpdateDenseIndex();
 }
 
 // Routine Description:
@@ -107,8 +113,19 @@ TextAttribute ATTR_ROW::GetAttrByColumn(const size_t column,
                                         size_t* const pApplies) const
 {
     THROW_HR_IF(E_INVALIDARG, column >= _cchRowWidth);
+
+    // Most rows are all one attribute.
+    if (_list.size() == 1)
+    {
+        if (nullptr != pApplies)
+        {
+            *pApplies = _cchRowWidth - column;
+        }
+        return _pTable->Get(_list.front().id);
+    }
+
     const auto runPos = FindAttrIndex(column, pApplies);
-    return _list[runPos].GetAttributes();
+    return _pTable->Get(_list[runPos].id);
 }
 
 // Routine Description:
@@ -133,6 +150,17 @@ size_t ATTR_ROW::FindAttrIndex(const size_t index, size_t* const pApplies) const
 {
     FAIL_FAST_IF(!(index < _cchRowWidth)); // The requested index cannot be longer than the total length described by this set of Attrs.
 
+    // If we have an index of the cells, we don't need to go looking.
+    if (!_cellRuns.empty())
+    {
+        const size_t runIndex = _cellRuns[index];
+        if (nullptr != pApplies)
+        {
+            *pApplies = _runEnds[runIndex] - index;
+        }
+        return runIndex;
+    }
+
     size_t cTotalLength = 0;
 
     FAIL_FAST_IF(!(_list.size() > 0)); // There should be a non-zero and positive number of items in the array.
@@ -141,7 +169,7 @@ size_t ATTR_ROW::FindAttrIndex(const size_t index, size_t* const pApplies) const
     auto runPos = _list.cbegin();
     do
     {
-        cTotalLength += runPos->GetLength();
+        cTotalLength += runPos->length;
 
         if (cTotalLength > index)
         {
@@ -221,13 +249,25 @@ void ATTR_ROW::ReplaceLegacyAttrs(_In_ WORD wToBeReplacedAttr, _In_ WORD wReplac
 // - <none>
 void ATTR_ROW::ReplaceAttrs(const TextAttribute& toBeReplacedAttr, const TextAttribute& replaceWith) noexcept
 {
-    for (auto& run : _list)
+    try
     {
-        if (run.GetAttributes() == toBeReplacedAttr)
+        // If nothing has ever interned it, no row can be using it.
+        const auto toBeReplaced = _pTable->Find(toBeReplacedAttr);
+        if (!toBeReplaced.has_value())
         {
-            run.SetAttributes(replaceWith);
+            return;
+        }
+
+        const auto replaceWithId = _pTable->Intern(replaceWith);
+        for (auto& run : _list)
+        {
+            if (run.id == toBeReplaced.value())
+            {
+                run.id = replaceWithId;
+            }
         }
     }
+    CATCH_LOG();
 }
 
 
@@ -243,13 +283,89 @@ void ATTR_ROW::ReplaceAttrs(const TextAttribute& toBeReplacedAttr, const TextAtt
 // - iEnd - the final index of the merge runs
 // - BufferWidth - the width of the row.
 // Return Value:
-// - STATUS_NO_MEMORY if there wasn't enough memory to insert the runs
-//   otherwise STATUS_SUCCESS if we were successful.
+// - S_OK, or a suitable error if the attributes couldn't be interned or there
+//   wasn't enough memory to insert the runs.
 [[nodiscard]]
 HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun> newAttrs,
                                  const size_t iStart,
                                  const size_t iEnd,
                                  const size_t cBufferWidth)
+{
+    try
+    {
+        // Writing a single cell is by far the most common, so don't allocate for it.
+        if (newAttrs.size() == 1)
+        {
+            const IdRun run{ _pTable->Intern(newAttrs.front().GetAttributes()), gsl::narrow<uint16_t>(newAttrs.front().GetLength()) };
+            _InsertIdRuns({ &run, 1 }, iStart, iEnd, cBufferWidth);
+        }
+        else
+        {
+            const auto runs = _InternRuns(newAttrs);
+            _InsertIdRuns({ runs.data(), runs.size() }, iStart, iEnd, cBufferWidth);
+        }
+
+        _UpdateDenseIndex();
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Interns the attributes of the given runs.
+// Arguments:
+// - runs - The runs to intern.
+// Return Value:
+// - The runs, with their attributes replaced by ids.
+// Note:
+// - will throw if the table doesn't have room for all of them.
+std::vector<ATTR_ROW::IdRun> ATTR_ROW::_InternRuns(const std::basic_string_view<TextAttributeRun> runs)
+{
+    std::vector<IdRun> idRuns;
+    idRuns.reserve(runs.size());
+
+    // If the table has to collect its unused ids partway through, the ids we
+    // already got aren't stored anywhere yet, so they might have been given
+    // away. Start over if that happens. If it happens again, there's no room
+    // for all of these at once.
+    for (auto attempt = 0; attempt < 2; attempt++)
+    {
+        const auto generation = _pTable->Generation();
+
+        idRuns.clear();
+        for (const auto& run : runs)
+        {
+            idRuns.push_back({ _pTable->Intern(run.GetAttributes()), gsl::narrow<uint16_t>(run.GetLength()) });
+        }
+
+        if (_pTable->Generation() == generation)
+        {
+            return idRuns;
+        }
+    }
+
+    THROW_HR(E_OUTOFMEMORY);
+}
+
+// Routine Description:
+// - Does the work of InsertAttrRuns, once the attributes have been interned.
+// - Takes a array of attribute runs, and inserts them into this row from startIndex to endIndex.
+// - For example, if the current row was was [{4, BLUE}], the merge string
+//   was [{ 2, RED }], with (StartIndex, EndIndex) = (1, 2),
+//   then the row would modified to be = [{ 1, BLUE}, {2, RED}, {1, BLUE}].
+// Arguments:
+// - rgInsertAttrs - The array of attrRuns to merge into this row.
+// - cInsertAttrs - The number of elements in rgInsertAttrs
+// - iStart - The index in the row to place the array of runs.
+// - iEnd - the final index of the merge runs
+// - BufferWidth - the width of the row.
+// Return Value:
+// - <none>, throws exceptions on failures.
+void ATTR_ROW::_InsertIdRuns(const std::basic_string_view<IdRun> newAttrs,
+                             const size_t iStart,
+                             const size_t iEnd,
+                             const size_t cBufferWidth)
 {
     // Definitions:
     // Existing Run = The run length encoded color array we're already storing in memory before this was called.
@@ -273,13 +389,13 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
     if (newAttrs.size() == 1)
     {
         // Get the new color attribute we're trying to apply
-        const TextAttribute NewAttr = newAttrs.at(0).GetAttributes();
+        const auto NewAttr = newAttrs.at(0).id;
 
         // If the existing run was only 1 element...
         // ...and the new color is the same as the old, we don't have to do anything and can exit quick.
-        if (_list.size() == 1 && _list.at(0).GetAttributes() == NewAttr)
+        if (_list.size() == 1 && _list.at(0).id == NewAttr)
         {
-            return S_OK;
+            return;
         }
         // .. otherwise if we internally have a list of 2 and we're about to insert a single color
         // it's probable that we're just walking left-to-right through the row and changing each
@@ -291,21 +407,21 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         // Check for that circumstance by seeing if we're inserting a single run of the
         // left side color right at the boundary and just adjust the counts in the existing
         // two elements in our internal list.
-        else if (_list.size() == 2 && newAttrs.at(0).GetLength() == 1)
+        else if (_list.size() == 2 && newAttrs.at(0).length == 1)
         {
             auto left = _list.begin();
-            if (iStart == left->GetLength() && NewAttr == left->GetAttributes())
+            if (iStart == left->length && NewAttr == left->id)
             {
                 auto right = left + 1;
-                left->IncrementLength();
-                right->DecrementLength();
+                left->length++;
+                right->length--;
 
                 // If we just reduced the right half to zero, just erase it out of the list.
-                if (right->GetLength() == 0)
+                if (right->length == 0)
                 {
                     _list.erase(right);
                 }
-                return S_OK;
+                return;
             }
         }
     }
@@ -316,7 +432,7 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         // Just dump what we're given over what we have and call it a day.
         _list.assign(newAttrs.cbegin(), newAttrs.cend());
 
-        return S_OK;
+        return;
     }
 
     // In the worst case scenario, we will need a new run that is the length of
@@ -327,7 +443,7 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
     // The original run was 3 long. The insertion run was 1 long. We need 1 more for the
     // fact that an existing piece of the run was split in half (to hold the latter half).
     const size_t cNewRun = _list.size() + newAttrs.size() + 1;
-    std::vector<TextAttributeRun> newRun;
+    std::vector<IdRun> newRun;
     newRun.resize(cNewRun);
 
     // We will start analyzing from the beginning of our existing run.
@@ -350,7 +466,7 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         while (iExistingRunCoverage < iStart)
         {
             // Add up how much length we can cover by copying an item from the existing run.
-            iExistingRunCoverage += pExistingRunPos->GetLength();
+            iExistingRunCoverage += pExistingRunPos->length;
 
             // Copy it to the new run buffer and advance both pointers.
             *pNewRunPos++ = *pExistingRunPos++;
@@ -377,7 +493,7 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         pNewRunPos--;
 
         // Fetch out the length so we can fix it up based on the below conditions.
-        size_t length = pNewRunPos->GetLength();
+        size_t length = pNewRunPos->length;
 
         // If we've covered more cells already than the start of the attributes to be inserted...
         if (iExistingRunCoverage > iStart)
@@ -392,9 +508,9 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         // Now we're still on that "last cell copied" into the new run.
         // If the color of that existing copied cell matches the color of the first segment
         // of the run we're about to insert, we can just increment the length to extend the coverage.
-        if (pNewRunPos->GetAttributes() == pInsertRunPos->GetAttributes())
+        if (pNewRunPos->id == pInsertRunPos->id)
         {
-            length += pInsertRunPos->GetLength();
+            length += pInsertRunPos->length;
 
             // Since the color matched, we have already "used up" part of the insert run
             // and can skip it in our big "memcopy" step below that will copy the bulk of the insert run.
@@ -403,7 +519,7 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         }
 
         // We're done manipulating the length. Store it back.
-        pNewRunPos->SetLength(length);
+        pNewRunPos->length = gsl::narrow<uint16_t>(length);
 
         // Now that we're done adjusting the last copied item, advance the pointer into a fresh/blank
         // part of the new run array.
@@ -424,7 +540,7 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
     while (iExistingRunCoverage <= iEnd)
     {
         FAIL_FAST_IF(!(pExistingRunPos != pExistingRunEnd));
-        iExistingRunCoverage += pExistingRunPos->GetLength();
+        iExistingRunCoverage += pExistingRunPos->length;
         pExistingRunPos++;
     }
 
@@ -457,11 +573,11 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
             // This case is slightly off from the example above. This case is for if the B2 above was actually Y2.
             // That Y2 from the existing run is the same color as the Y2 we just filled a few columns left in the final run
             // so we can just adjust the final run's column count instead of adding another segment here.
-            if (pNewRunPos->GetAttributes() == pExistingRunPos->GetAttributes())
+            if (pNewRunPos->id == pExistingRunPos->id)
             {
-                size_t length = pNewRunPos->GetLength();
+                size_t length = pNewRunPos->length;
                 length += (iExistingRunCoverage - (iEnd + 1));
-                pNewRunPos->SetLength(length);
+                pNewRunPos->length = gsl::narrow<uint16_t>(length);
             }
             else
             {
@@ -472,11 +588,11 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
                 pNewRunPos++;
 
                 // Copy the existing run's color information to the new run
-                pNewRunPos->SetAttributes(pExistingRunPos->GetAttributes());
+                pNewRunPos->id = pExistingRunPos->id;
 
                 // Adjust the length of that copied color to cover only the reduced number of columns needed
                 // now that some have been replaced by the insert run.
-                pNewRunPos->SetLength(iExistingRunCoverage - (iEnd + 1));
+                pNewRunPos->length = gsl::narrow<uint16_t>(iExistingRunCoverage - (iEnd + 1));
             }
 
             // Now that we're done recovering a piece of the existing run we skipped, move the pointer forward again.
@@ -494,12 +610,12 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
         // New Run desired when done = R3 -> B7
         // Existing run pointer is on B2.
         // We want to merge the 2 from the B2 into the B5 so we get B7.
-        else if (pNewRunPos->GetAttributes() == pExistingRunPos->GetAttributes())
+        else if (pNewRunPos->id == pExistingRunPos->id)
         {
             // Add the value from the existing run into the current new run position.
-            size_t length = pNewRunPos->GetLength();
-            length += pExistingRunPos->GetLength();
-            pNewRunPos->SetLength(length);
+            size_t length = pNewRunPos->length;
+            length += pExistingRunPos->length;
+            pNewRunPos->length = gsl::narrow<uint16_t>(length);
 
             // Advance the existing run position since we consumed its value and merged it in.
             pExistingRunPos++;
@@ -523,8 +639,6 @@ HRESULT ATTR_ROW::InsertAttrRuns(const std::basic_string_view<TextAttributeRun>
 
     newRun.erase(pNewRunPos, newRun.end());
     _list.swap(newRun);
-
-    return S_OK;
 }
 
 // Routine Description:
@@ -555,6 +669,86 @@ std::vector<TextAttributeRun> ATTR_ROW::PackAttrs(const std::vector<TextAttribut
     return runs;
 }
 
+// Routine Description:
+// - Marks every attribute id used by this row.
+// Arguments:
+// - inUse - Indexed by id. Must be big enough for any id in the row's table.
+void ATTR_ROW::MarkIdsInUse(std::vector<bool>& inUse) const
+{
+    for (const auto& run : _list)
+    {
+        inUse.at(run.id) = true;
+    }
+}
+
+// Routine Description:
+// - Gets the runs of the row, as interned ids.
+std::basic_string_view<ATTR_ROW::IdRun> ATTR_ROW::GetIdRuns() const noexcept
+{
+    return { _list.data(), _list.size() };
+}
+
+// Routine Description:
+// - Looks up the attribute that one of the ids from GetIdRuns stands for.
+// Arguments:
+// - id - the id of a run of this row
+// Return Value:
+// - the attribute. It stays where it is until the id is collected.
+const TextAttribute& ATTR_ROW::GetAttrById(const TextAttributeTable::id_type id) const
+{
+    return _pTable->Get(id);
+}
+
+// Routine Description:
+// - Frees the storage of the row. The row has no attributes at all until
+//   RestoreIdRuns is called, so this is only for a ROW that's freezing itself.
+void ATTR_ROW::Release() noexcept
+{
+    std::vector<IdRun>{}.swap(_list);
+    std::vector<uint16_t>{}.swap(_cellRuns);
+    std::vector<uint16_t>{}.swap(_runEnds);
+}
+
+// Routine Description:
+// - Replaces the runs of the row with ones from GetIdRuns.
+// Arguments:
+// - runs - the runs to use. Must cover exactly the width of the row.
+void ATTR_ROW::RestoreIdRuns(const std::basic_string_view<IdRun> runs)
+{
+    _list.assign(runs.cbegin(), runs.cend());
+    _UpdateDenseIndex();
+}
+
+// Routine Description:
+// - Rebuilds the per-cell index, if the row has enough runs to need it.
+void ATTR_ROW::_UpdateDenseIndex()
+{
+    if (_list.size() < DenseIndexMinRuns)
+    {
+        // Walking a few runs is as quick as the index, and doesn't need the memory.
+        if (!_cellRuns.empty())
+        {
+            _cellRuns.clear();
+            _cellRuns.shrink_to_fit();
+            _runEnds.clear();
+            _runEnds.shrink_to_fit();
+        }
+        return;
+    }
+
+    _cellRuns.resize(_cchRowWidth);
+    _runEnds.resize(_list.size());
+
+    size_t column = 0;
+    for (size_t runIndex = 0; runIndex < _list.size(); runIndex++)
+    {
+        const auto end = std::min(column + _list[runIndex].length, _cchRowWidth);
+        std::fill(_cellRuns.begin() + column, _cellRuns.begin() + end, gsl::narrow_cast<uint16_t>(runIndex));
+        column = end;
+        _runEnds[runIndex] = gsl::narrow_cast<uint16_t>(column);
+    }
+}
+
 ATTR_ROW::const_iterator ATTR_ROW::begin() const noexcept
 {
     return AttrRowIterator(this);
@@ -7,6 +7,10 @@ Module Name:
 
 Abstract:
 - contains data structure for the attributes of one row of screen buffer
+- The attributes are stored as runs of ids from the buffer's TextAttributeTable.
+    Most rows have one run, and are answered without looking any further. Rows
+    with lots of runs also keep the run index of every cell, so looking up a
+    column doesn't have to walk the runs.
 
 Author(s):
 - Michael Niksa (miniksa) 10-Apr-2014
@@ -21,6 +25,7 @@ Revision History:
 #pragma once
 
 #include "TextAttributeRun.hpp"
+#include "TextAttributeTable.hpp"
 #include "AttrRowIterator.hpp"
 
 class ATTR_ROW final
@@ -28,7 +33,13 @@ class ATTR_ROW final
 public:
     using const_iterator = typename AttrRowIterator;
 
-    ATTR_ROW(const UINT cchRowWidth, const TextAttribute attr);
+    struct IdRun
+    {
+        TextAttributeTable::id_type id;
+        uint16_t length;
+    };
+
+    ATTR_ROW(const UINT cchRowWidth, const TextAttribute attr, TextAttributeTable& table);
 
     void Reset(const TextAttribute attr);
 
@@ -55,6 +66,13 @@ public:
 
     static std::vector<TextAttributeRun> PackAttrs(const std::vector<TextAttribute>& attrs);
 
+    void MarkIdsInUse(std::vector<bool>& inUse) const;
+
+    std::basic_string_view<IdRun> GetIdRuns() const noexcept;
+    const TextAttribute& GetAttrById(const TextAttributeTable::id_type id) const;
+    void Release() noexcept;
+    void RestoreIdRuns(const std::basic_string_view<IdRun> runs);
+
     const_iterator begin() const noexcept;
     const_iterator end() const noexcept;
 
@@ -65,9 +83,25 @@ public:
     friend class AttrRowIterator;
 
 private:
+    // Rows with more runs than this also get a per-cell index.
+    static constexpr size_t DenseIndexMinRuns = 16;
 
-    std::vector<TextAttributeRun> _list;
+    std::vector<IdRun> _InternRuns(const std::basic_string_view<TextAttributeRun> runs);
+    void _InsertIdRuns(const std::basic_string_view<IdRun> newAttrs,
+                       const size_t iStart,
+                       const size_t iEnd,
+                       const size_t cBufferWidth);
+    void _UpdateDenseIndex();
+
+    std::vector<IdRun> _list;
     size_t _cchRowWidth;
+    TextAttributeTable* _pTable; // non ownership pointer
+
+    // Only filled in when there are at least DenseIndexMinRuns runs.
+    // The index into _list of the run covering each column.
+    std::vector<uint16_t> _cellRuns;
+    // The column just past the end of each run.
+    std::vector<uint16_t> _runEnds;
 
 #ifdef UNIT_TESTING
     friend class AttrRowTests;
@@ -15,14 +15,14 @@ AttrRowIterator AttrRowIterator::CreateEndIterator(const ATTR_ROW* const attrRow
 
 AttrRowIterator::AttrRowIterator(const ATTR_ROW* const attrRow) :
     _pAttrRow{ attrRow },
-    _run{ attrRow->_list.cbegin() },
+    _run{ 0 },
     _currentAttributeIndex{ 0 }
 {
 }
 
 AttrRowIterator::operator bool() const noexcept
 {
-    return _run < _pAttrRow->_list.cend();
+    return _run < _pAttrRow->_list.size();
 }
 
 bool AttrRowIterator::operator==(const AttrRowIterator& it) const
@@ -84,12 +84,12 @@ AttrRowIterator AttrRowIterator::operator--(int)
 
 const TextAttribute* AttrRowIterator::operator->() const
 {
-    return &_run->GetAttributes();
+    return &operator*();
 }
 
 const TextAttribute& AttrRowIterator::operator*() const
 {
-    return _run->GetAttributes();
+    return _pAttrRow->_pTable->Get(_pAttrRow->_list.at(_run).id);
 }
 
 // Routine Description:
@@ -100,7 +100,7 @@ void AttrRowIterator::_increment(size_t count)
 {
     while (count > 0)
     {
-        const size_t runLength = _run->GetLength();
+        const size_t runLength = _pAttrRow->_list.at(_run).length;
         if (count + _currentAttributeIndex < runLength)
         {
             _currentAttributeIndex += count;
@@ -132,7 +132,7 @@ void AttrRowIterator::_decrement(size_t count)
         {
             count -= _currentAttributeIndex;
             --_run;
-            _currentAttributeIndex = _run->GetLength() - 1;
+            _currentAttributeIndex = _pAttrRow->_list.at(_run).length - 1;
         }
     }
 }
@@ -141,6 +141,6 @@ void AttrRowIterator::_decrement(size_t count)
 // - sets fields on the iterator to describe the end() state of the ATTR_ROW
 void AttrRowIterator::_setToEnd()
 {
-    _run = _pAttrRow->_list.cend();
+    _run = _pAttrRow->_list.size();
     _currentAttributeIndex = 0;
 }
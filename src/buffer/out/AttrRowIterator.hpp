@@ -52,9 +52,9 @@ public:
     const TextAttribute& operator*() const;
 
 private:
-    std::vector<TextAttributeRun>::const_iterator _run;
+    size_t _run; // index of the current run within the ATTR_ROW
     const ATTR_ROW* _pAttrRow;
-    size_t _currentAttributeIndex; // index of TextAttribute within the current TextAttributeRun
+    size_t _currentAttributeIndex; // index of TextAttribute within the current run
     
     void _increment(size_t count);
     void _decrement(size_t count);
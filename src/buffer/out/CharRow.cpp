@@ -19,6 +19,7 @@ CharRow::CharRow(size_t rowWidth, ROW* const pParent) :
     _wrapForced{ false },
     _doubleBytePadded{ false },
     _data(rowWidth, value_type()),
+    _unicodeStorage{},
     _pParent{ FAIL_FAST_IF_NULL(pParent) }
 {
 }
@@ -90,6 +91,7 @@ void CharRow::Reset()
     {
         cell.Reset();
     }
+    _unicodeStorage.Reset();
 
     _wrapForced = false;
     _doubleBytePadded = false;
@@ -108,12 +110,27 @@ HRESULT CharRow::Resize(const size_t newSize) noexcept
     {
         const value_type insertVals;
         _data.resize(newSize, insertVals);
+        _unicodeStorage.Resize(newSize);
     }
     CATCH_RETURN();
 
     return S_OK;
 }
 
+// Routine Description:
+// - Frees the cells of the row, leaving it zero cells wide. The wrap flags are
+//   kept. Used by a ROW that's freezing itself, which resizes it again when it
+//   thaws.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void CharRow::Release() noexcept
+{
+    std::vector<value_type>{}.swap(_data);
+    _unicodeStorage = UnicodeStorage{};
+}
+
 typename CharRow::iterator CharRow::begin() noexcept
 {
     return _data.begin();
@@ -169,6 +186,7 @@ size_t CharRow::MeasureRight() const noexcept
 void CharRow::ClearCell(const size_t column)
 {
     _data.at(column).Reset();
+    _unicodeStorage.Erase(column);
 }
 
 // Routine Description:
@@ -223,6 +241,72 @@ DbcsAttribute& CharRow::DbcsAttrAt(const size_t column)
 void CharRow::ClearGlyph(const size_t column)
 {
     _data.at(column).EraseChars();
+    _unicodeStorage.Erase(column);
+}
+
+// Routine Description:
+// - Copies cells, along with any glyphs stored for them, from another row.
+// Arguments:
+// - source - the row to copy the cells from
+// - sourceColumn - the first column of source to copy
+// - targetColumn - the column of this row that receives the first cell
+// - count - how many cells to copy
+// Return Value:
+// - <none>
+// Note: will throw exception if either range is out of bounds
+void CharRow::CopyCells(const CharRow& source, const size_t sourceColumn, const size_t targetColumn, const size_t count)
+{
+    THROW_HR_IF(E_INVALIDARG, sourceColumn > source._data.size() || count > source._data.size() - sourceColumn);
+    THROW_HR_IF(E_INVALIDARG, targetColumn > _data.size() || count > _data.size() - targetColumn);
+
+    const auto sourceBegin = source._data.cbegin() + sourceColumn;
+
+    // Without any glyphs on either side, the cells are all there is to copy.
+    if (source._unicodeStorage.Empty() && _unicodeStorage.Empty())
+    {
+        std::copy(sourceBegin, sourceBegin + count, _data.begin() + targetColumn);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto& cell = *(sourceBegin + i);
+        if (cell.DbcsAttr().IsGlyphStored())
+        {
+            _unicodeStorage.StoreGlyph(targetColumn + i, source._unicodeStorage.GetText(sourceColumn + i));
+        }
+        else
+        {
+            _unicodeStorage.Erase(targetColumn + i);
+        }
+        _data.at(targetColumn + i) = cell;
+    }
+}
+
+// Routine Description:
+// - Fills cells with characters that each take up one cell and don't need a
+//   stored glyph, like printable ASCII.
+// Arguments:
+// - column - the first column to fill
+// - text - one character for each cell
+// Return Value:
+// - <none>
+// Note: will throw exception if the range is out of bounds
+void CharRow::WriteNarrowText(const size_t column, const std::wstring_view text)
+{
+    THROW_HR_IF(E_INVALIDARG, column > _data.size() || text.size() > _data.size() - column);
+
+    const auto target = _data.begin() + column;
+    if (!_unicodeStorage.Empty())
+    {
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            _unicodeStorage.Erase(column + i);
+        }
+    }
+    std::transform(text.cbegin(), text.cend(), target, [](const wchar_t wch) {
+        return CharRow::value_type{ wch, DbcsAttribute{} };
+    });
 }
 
 // Routine Description:
@@ -293,25 +377,14 @@ std::wstring CharRow::GetText() const
     return wstr;
 }
 
-UnicodeStorage& CharRow::GetUnicodeStorage()
+UnicodeStorage& CharRow::GetUnicodeStorage() noexcept
 {
-    return _pParent->GetUnicodeStorage();
+    return _unicodeStorage;
 }
 
-const UnicodeStorage& CharRow::GetUnicodeStorage() const
-{
-    return _pParent->GetUnicodeStorage();
-}
-
-// Routine Description:
-// - calculates the key used by the given column of the char row to store glyph data in UnicodeStorage
-// Arguments:
-// - column - the column to generate the key for
-// Return Value:
-// - the COORD key for data access from UnicodeStorage for the column
-COORD CharRow::GetStorageKey(const size_t column) const
+const UnicodeStorage& CharRow::GetUnicodeStorage() const noexcept
 {
-    return { gsl::narrow<SHORT>(column), _pParent->GetId() };
+    return _unicodeStorage;
 }
 
 // Routine Description:
@@ -56,6 +56,7 @@ public:
     void Reset();
     [[nodiscard]]
     HRESULT Resize(const size_t newSize) noexcept;
+    void Release() noexcept;
     size_t MeasureLeft() const;
     size_t MeasureRight() const noexcept;
     void ClearCell(const size_t column);
@@ -63,6 +64,8 @@ public:
     const DbcsAttribute& DbcsAttrAt(const size_t column) const;
     DbcsAttribute& DbcsAttrAt(const size_t column);
     void ClearGlyph(const size_t column);
+    void CopyCells(const CharRow& source, const size_t sourceColumn, const size_t targetColumn, const size_t count);
+    void WriteNarrowText(const size_t column, const std::wstring_view text);
     std::wstring GetText() const;
 
     // other functions implemented at the template class level
@@ -79,9 +82,8 @@ public:
     iterator end() noexcept;
     const_iterator cend() const noexcept;
 
-    UnicodeStorage& GetUnicodeStorage();
-    const UnicodeStorage& GetUnicodeStorage() const;
-    COORD GetStorageKey(const size_t column) const;
+    UnicodeStorage& GetUnicodeStorage() noexcept;
+    const UnicodeStorage& GetUnicodeStorage() const noexcept;
 
     void UpdateParent(ROW* const pParent) noexcept;
 
@@ -98,6 +100,9 @@ protected:
     // storage for glyph data and dbcs attributes
     std::vector<value_type> _data;
 
+    // glyphs that don't fit in a cell of _data, by column
+    UnicodeStorage _unicodeStorage;
+
     // ROW that this CharRow belongs to
     ROW* _pParent;
 };
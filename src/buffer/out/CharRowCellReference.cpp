@@ -15,14 +15,16 @@ void CharRowCellReference::operator=(const std::wstring_view chars)
     THROW_HR_IF(E_INVALIDARG, chars.empty());
     if (chars.size() == 1)
     {
+        if (_cellData().DbcsAttr().IsGlyphStored())
+        {
+            _parent._unicodeStorage.Erase(_index);
+        }
         _cellData().Char() = chars.front();
         _cellData().DbcsAttr().SetGlyphStored(false);
     }
     else
     {
-        auto& storage = _parent.GetUnicodeStorage();
-        const auto key = _parent.GetStorageKey(_index);
-        storage.StoreGlyph(key, { chars.cbegin(), chars.cend() });
+        _parent._unicodeStorage.StoreGlyph(_index, chars);
         _cellData().DbcsAttr().SetGlyphStored(true);
     }
 }
@@ -62,9 +64,7 @@ std::wstring_view CharRowCellReference::_glyphData() const
 {
     if (_cellData().DbcsAttr().IsGlyphStored())
     {
-        const auto& text = _parent.GetUnicodeStorage().GetText(_parent.GetStorageKey(_index));
-
-        return { text.data(), text.size() };
+        return _parent._unicodeStorage.GetText(_index);
     }
     else
     {
@@ -80,7 +80,7 @@ CharRowCellReference::const_iterator CharRowCellReference::begin() const
 {
     if (_cellData().DbcsAttr().IsGlyphStored())
     {
-        return _parent.GetUnicodeStorage().GetText(_parent.GetStorageKey(_index)).data();
+        return _parent._unicodeStorage.GetText(_index).data();
     }
     else
     {
@@ -96,8 +96,7 @@ CharRowCellReference::const_iterator CharRowCellReference::end() const
 {
     if (_cellData().DbcsAttr().IsGlyphStored())
     {
-
-        const auto& chars = _parent.GetUnicodeStorage().GetText(_parent.GetStorageKey(_index));
+        const auto chars = _parent._unicodeStorage.GetText(_index);
         return chars.data() + chars.size();
     }
     else
@@ -123,8 +122,8 @@ bool operator==(const CharRowCellReference& ref, const std::vector<wchar_t>& gly
     }
     else
     {
-        const auto& chars = ref._parent.GetUnicodeStorage().GetText(ref._parent.GetStorageKey(ref._index));
-        return chars == glyph;
+        const auto chars = ref._parent.GetUnicodeStorage().GetText(ref._index);
+        return std::equal(chars.cbegin(), chars.cend(), glyph.cbegin(), glyph.cend());
     }
 }
 
@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "FrozenRow.hpp"
+#include "unicode.hpp"
+
+// Routine Description:
+// - Makes a compact copy of a row.
+// Arguments:
+// - charRow - the text of the row
+// - attrRow - the attributes of the row
+// - pSpill - the spill to keep the copy in, or nullptr to keep it on the heap
+// Return Value:
+// - constructed object
+FrozenRow::FrozenRow(const CharRow& charRow, const ATTR_ROW& attrRow, ScrollbackSpill* const pSpill) :
+    _record{},
+    _recordSize{ 0 },
+    _pSpill{ nullptr },
+    _spillId{ 0 }
+{
+    const auto isBlank = [](const CharRow::value_type& cell) noexcept {
+        return cell.Char() == UNICODE_SPACE &&
+               cell.DbcsAttr().IsSingle() &&
+               !cell.DbcsAttr().IsGlyphStored();
+    };
+
+    const auto begin = charRow.cbegin();
+    auto end = charRow.cend();
+    while (end != begin && isBlank(*(end - 1)))
+    {
+        --end;
+    }
+
+    Header header{};
+    header.cellCount = gsl::narrow<uint16_t>(end - begin);
+    for (auto it = begin; it != end; ++it)
+    {
+        const auto& attr = it->DbcsAttr();
+        if (!attr.IsSingle() || attr.IsGlyphStored())
+        {
+            WI_SetFlag(header.flags, HasDbcsAttrs);
+        }
+        if (attr.IsGlyphStored())
+        {
+            header.glyphLength += gsl::narrow<uint32_t>(1 + charRow.GetUnicodeStorage().GetText(it - begin).size());
+        }
+    }
+
+    const auto runs = attrRow.GetIdRuns();
+    header.runCount = gsl::narrow<uint16_t>(runs.size());
+    WI_UpdateFlag(header.flags, WrapForced, charRow.WasWrapForced());
+    WI_UpdateFlag(header.flags, DoubleBytePadded, charRow.WasDoubleBytePadded());
+
+    const size_t textLength = header.cellCount + header.glyphLength;
+    const size_t dbcsCount = WI_IsFlagSet(header.flags, HasDbcsAttrs) ? header.cellCount : 0;
+    _recordSize = sizeof(Header) +
+                  runs.size() * sizeof(ATTR_ROW::IdRun) +
+                  textLength * sizeof(wchar_t) +
+                  dbcsCount * sizeof(DbcsAttribute);
+    _record = std::make_unique<BYTE[]>(_recordSize);
+
+    std::memcpy(_record.get(), &header, sizeof(header));
+    const auto pRuns = reinterpret_cast<ATTR_ROW::IdRun*>(_record.get() + sizeof(Header));
+    std::copy(runs.cbegin(), runs.cend(), pRuns);
+
+    auto pText = reinterpret_cast<wchar_t*>(pRuns + runs.size());
+    for (auto it = begin; it != end; ++it)
+    {
+        *pText++ = it->Char();
+    }
+    for (auto it = begin; header.glyphLength > 0 && it != end; ++it)
+    {
+        if (it->DbcsAttr().IsGlyphStored())
+        {
+            const auto glyph = charRow.GetUnicodeStorage().GetText(it - begin);
+            *pText++ = gsl::narrow<wchar_t>(glyph.size());
+            pText = std::copy(glyph.cbegin(), glyph.cend(), pText);
+        }
+    }
+
+    auto pDbcsAttrs = reinterpret_cast<DbcsAttribute*>(pText);
+    for (auto it = begin; dbcsCount > 0 && it != end; ++it)
+    {
+        *pDbcsAttrs++ = it->DbcsAttr();
+    }
+
+    if (pSpill)
+    {
+        _spillId = pSpill->Append({ _record.get(), _recordSize });
+        _pSpill = pSpill;
+        _record.reset();
+    }
+}
+
+FrozenRow::~FrozenRow()
+{
+    if (_pSpill)
+    {
+        _pSpill->Erase(_spillId);
+    }
+}
+
+// Routine Description:
+// - Restores the row this was made from.
+// Arguments:
+// - charRow - the text of the row to fill in. Must be blank, and as wide as
+//      the row was.
+// - attrRow - the attributes of the row to fill in.
+// Return Value:
+// - <none>, throws exceptions on failures.
+void FrozenRow::Thaw(CharRow& charRow, ATTR_ROW& attrRow) const
+{
+    const auto record = _GetRecord();
+
+    Header header;
+    std::memcpy(&header, record.data(), sizeof(header));
+    const auto pRuns = reinterpret_cast<const ATTR_ROW::IdRun*>(record.data() + sizeof(Header));
+    const auto pText = reinterpret_cast<const wchar_t*>(pRuns + header.runCount);
+    const auto pDbcsAttrs = reinterpret_cast<const DbcsAttribute*>(pText + header.cellCount + header.glyphLength);
+    const bool hasDbcsAttrs = WI_IsFlagSet(header.flags, HasDbcsAttrs);
+
+    auto pGlyph = pText + header.cellCount;
+    auto cell = charRow.begin();
+    for (size_t i = 0; i < header.cellCount; ++i, ++cell)
+    {
+        const auto attr = hasDbcsAttrs ? pDbcsAttrs[i] : DbcsAttribute{};
+        *cell = { pText[i], attr };
+        if (attr.IsGlyphStored())
+        {
+            const size_t length = *pGlyph++;
+            charRow.GetUnicodeStorage().StoreGlyph(i, { pGlyph, length });
+            pGlyph += length;
+        }
+    }
+
+    charRow.SetWrapForced(WI_IsFlagSet(header.flags, WrapForced));
+    charRow.SetDoubleBytePadded(WI_IsFlagSet(header.flags, DoubleBytePadded));
+    attrRow.RestoreIdRuns({ pRuns, header.runCount });
+}
+
+// Routine Description:
+// - Marks the attribute ids used by the row, like ATTR_ROW::MarkIdsInUse.
+// Arguments:
+// - inUse - indexed by id, set to true for each id the row uses
+void FrozenRow::MarkIdsInUse(std::vector<bool>& inUse) const
+{
+    const auto record = _GetRecord();
+
+    Header header;
+    std::memcpy(&header, record.data(), sizeof(header));
+    const auto pRuns = reinterpret_cast<const ATTR_ROW::IdRun*>(record.data() + sizeof(Header));
+    for (size_t i = 0; i < header.runCount; ++i)
+    {
+        inUse.at(pRuns[i].id) = true;
+    }
+}
+
+// Routine Description:
+// - Measures the row as part of a line of text, like ROW::MeasureLine.
+// Arguments:
+// - width - how wide the row is
+// - cells - the length of the line so far. The row's cells are added to it.
+// - leadingCells - where the line's leading bytes are. The row's are added to it.
+// Return Value:
+// - true if the line goes on into the next row.
+bool FrozenRow::MeasureLine(const size_t width, size_t& cells, std::vector<size_t>& leadingCells) const
+{
+    const auto record = _GetRecord();
+
+    Header header;
+    std::memcpy(&header, record.data(), sizeof(header));
+    const auto pRuns = reinterpret_cast<const ATTR_ROW::IdRun*>(record.data() + sizeof(Header));
+    const auto pText = reinterpret_cast<const wchar_t*>(pRuns + header.runCount);
+    const auto pDbcsAttrs = reinterpret_cast<const DbcsAttribute*>(pText + header.cellCount + header.glyphLength);
+    const bool hasDbcsAttrs = WI_IsFlagSet(header.flags, HasDbcsAttrs);
+    const bool wrapForced = WI_IsFlagSet(header.flags, WrapForced);
+
+    // Like CharRow::MeasureRight, spaces at the end don't count, even ones that were
+    // stored for their DBCS attribute.
+    size_t right = header.cellCount;
+    while (right > 0 && pText[right - 1] == UNICODE_SPACE && !(hasDbcsAttrs && pDbcsAttrs[right - 1].IsGlyphStored()))
+    {
+        --right;
+    }
+    if (wrapForced)
+    {
+        right = WI_IsFlagSet(header.flags, DoubleBytePadded) ? width - 1 : width;
+    }
+
+    for (size_t x = 0; hasDbcsAttrs && x < right && x < header.cellCount; ++x)
+    {
+        if (pDbcsAttrs[x].IsLeading())
+        {
+            leadingCells.push_back(cells + x);
+        }
+    }
+    cells += right;
+
+    return wrapForced || right == width;
+}
+
+// Routine Description:
+// - Gets roughly how many bytes of the heap the frozen row takes up, for
+//   diagnostics. A record in the spill doesn't count.
+// Return Value:
+// - the size of this object plus the record, if it's on the heap
+size_t FrozenRow::MemoryUsage() const noexcept
+{
+    return sizeof(*this) + (_pSpill ? 0 : _recordSize);
+}
+
+std::basic_string_view<BYTE> FrozenRow::_GetRecord() const
+{
+    if (_pSpill)
+    {
+        return _pSpill->Read(_spillId);
+    }
+    return { _record.get(), _recordSize };
+}
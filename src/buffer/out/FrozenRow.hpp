@@ -0,0 +1,70 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- FrozenRow.hpp
+
+Abstract:
+- A compact copy of a row that has scrolled far enough above the cursor that
+    it's unlikely to change again. A full ROW keeps a cell and a DBCS attribute
+    for every column, even though most of scrollback is short lines followed by
+    blanks. A frozen row is a single record with the text up to the last cell
+    that isn't blank, the DBCS attributes only when there are any other than
+    single-width, and the row's attribute runs as they were interned.
+- The record is kept on the heap, or in the buffer's ScrollbackSpill if it has
+    one.
+- The ROW owns its frozen copy and throws away its full storage while it has
+    one. The first time anything asks the ROW for its cells, it thaws the copy
+    back into full storage. See TextBuffer::_FreezeColdRows for when rows are
+    frozen.
+--*/
+
+#pragma once
+
+#include "AttrRow.hpp"
+#include "CharRow.hpp"
+#include "ScrollbackSpill.hpp"
+
+class FrozenRow final
+{
+public:
+    FrozenRow(const CharRow& charRow, const ATTR_ROW& attrRow, ScrollbackSpill* const pSpill);
+    ~FrozenRow();
+
+    FrozenRow(const FrozenRow&) = delete;
+    FrozenRow& operator=(const FrozenRow&) = delete;
+
+    void Thaw(CharRow& charRow, ATTR_ROW& attrRow) const;
+
+    void MarkIdsInUse(std::vector<bool>& inUse) const;
+    bool MeasureLine(const size_t width, size_t& cells, std::vector<size_t>& leadingCells) const;
+
+    size_t MemoryUsage() const noexcept;
+
+private:
+    // The record starts with this. It's followed by the attribute runs, then
+    // the character of each stored cell, then the glyphs that didn't fit in a
+    // cell, each one prefixed by its length, and finally the DBCS attribute of
+    // each stored cell, if there are any other than single-width.
+    struct Header
+    {
+        uint32_t glyphLength;
+        uint16_t cellCount; // everything after these cells is blank
+        uint16_t runCount;
+        uint8_t flags;
+    };
+
+    static constexpr uint8_t WrapForced = 0x1;
+    static constexpr uint8_t DoubleBytePadded = 0x2;
+    static constexpr uint8_t HasDbcsAttrs = 0x4;
+
+    std::basic_string_view<BYTE> _GetRecord() const;
+
+    // The record, unless it's in the spill.
+    std::unique_ptr<BYTE[]> _record;
+    size_t _recordSize;
+
+    ScrollbackSpill* _pSpill; // non ownership pointer, set when the record is in the spill
+    ScrollbackSpill::id_type _spillId;
+};
@@ -338,6 +338,46 @@ const OutputCellView* OutputCellIterator::operator->() const
     return &_currentView;
 }
 
+// Routine Description:
+// - Gets the text coming up next, if the iterator is walking over text with
+//   one attribute and the text is printable ASCII. Each of those characters
+//   fills exactly one cell, so they can be written without working out the
+//   width of every glyph. See ROW::WriteRun.
+// Arguments:
+// - maxCells - The most cells worth of text to return.
+// Return Value:
+// - The run of text, or an empty view if the next cell isn't part of one.
+std::wstring_view OutputCellIterator::GetNarrowRun(const size_t maxCells) const noexcept
+{
+    if (_mode != Mode::Loose || !operator bool())
+    {
+        return {};
+    }
+
+    const auto text = std::get_if<std::wstring_view>(&_run)->substr(_pos, maxCells);
+    const auto end = std::find_if_not(text.cbegin(), text.cend(), [](const wchar_t wch) {
+        return wch >= L' ' && wch <= L'~';
+    });
+    return text.substr(0, end - text.cbegin());
+}
+
+// Routine Description:
+// - Advances the iterator past text that was written in bulk.
+// Arguments:
+// - length - How many characters to skip. Must be no more than the length of
+//            the run from GetNarrowRun.
+void OutputCellIterator::SkipNarrowRun(const size_t length)
+{
+    THROW_HR_IF(E_INVALIDARG, _mode != Mode::Loose);
+
+    _pos += length;
+    _distance += length;
+    if (operator bool())
+    {
+        _currentView = s_GenerateView(std::get<std::wstring_view>(_run).substr(_pos), _attr);
+    }
+}
+
 // Routine Description:
 // - Checks the current view. If it is a leading half, it updates the current
 //   view to the trailing half of the same glyph.
@@ -58,6 +58,9 @@ public:
     const OutputCellView& operator*() const;
     const OutputCellView* operator->() const;
 
+    std::wstring_view GetNarrowRun(const size_t maxCells) const noexcept;
+    void SkipNarrowRun(const size_t length);
+
 private:
     
     enum class Mode 
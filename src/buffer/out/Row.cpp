@@ -20,7 +20,9 @@ ROW::ROW(const SHORT rowId, const short rowWidth, const TextAttribute fillAttrib
     _id{ rowId },
     _rowWidth{ gsl::narrow<size_t>(rowWidth) },
     _charRow{ gsl::narrow<size_t>(rowWidth), this },
-    _attrRow{ gsl::narrow<UINT>(rowWidth), fillAttribute },
+    _attrRow{ gsl::narrow<UINT>(rowWidth), fillAttribute, pParent->GetAttributeTable() },
+    _frozen{},
+    _generation{ 0 },
     _pParent{ pParent }
 {
 }
@@ -32,6 +34,7 @@ size_t ROW::size() const noexcept
 
 const CharRow& ROW::GetCharRow() const
 {
+    _EnsureThawed();
     return _charRow;
 }
 
@@ -40,12 +43,13 @@ CharRow& ROW::GetCharRow()
     return const_cast<CharRow&>(static_cast<const ROW* const>(this)->GetCharRow());
 }
 
-const ATTR_ROW& ROW::GetAttrRow() const noexcept
+const ATTR_ROW& ROW::GetAttrRow() const
 {
+    _EnsureThawed();
     return _attrRow;
 }
 
-ATTR_ROW& ROW::GetAttrRow() noexcept
+ATTR_ROW& ROW::GetAttrRow()
 {
     return const_cast<ATTR_ROW&>(static_cast<const ROW* const>(this)->GetAttrRow());
 }
@@ -60,6 +64,24 @@ void ROW::SetId(const SHORT id) noexcept
     _id = id;
 }
 
+uint64_t ROW::GetGeneration() const noexcept
+{
+    return _generation;
+}
+
+void ROW::SetGeneration(const uint64_t generation) noexcept
+{
+    _generation = generation;
+}
+
+// Routine Description:
+// - Points the CharRow back at this ROW, after the ROW has been moved.
+//   Doesn't thaw the row.
+void ROW::UpdateCharRowParent() noexcept
+{
+    _charRow.UpdateParent(this);
+}
+
 // Routine Description:
 // - Sets all properties of the ROW to default values
 // Arguments:
@@ -68,7 +90,20 @@ void ROW::SetId(const SHORT id) noexcept
 // - <none>
 bool ROW::Reset(const TextAttribute Attr)
 {
+    if (_frozen)
+    {
+        // There's no point in thawing what we're about to throw away.
+        const HRESULT hr = _charRow.Resize(_rowWidth);
+        if (FAILED(hr))
+        {
+            LOG_HR(hr);
+            return false;
+        }
+        _frozen.reset();
+    }
+
     _charRow.Reset();
+    _pParent->NotifyRowChanged(*this);
     try
     {
         _attrRow.Reset(Attr);
@@ -90,6 +125,12 @@ bool ROW::Reset(const TextAttribute Attr)
 [[nodiscard]]
 HRESULT ROW::Resize(const size_t width)
 {
+    try
+    {
+        _EnsureThawed();
+    }
+    CATCH_RETURN();
+
     RETURN_IF_FAILED(_charRow.Resize(width));
     try
     {
@@ -110,8 +151,10 @@ HRESULT ROW::Resize(const size_t width)
 // - <none>
 void ROW::ClearColumn(const size_t column)
 {
+    _EnsureThawed();
     THROW_HR_IF(E_INVALIDARG, column >= _charRow.size());
     _charRow.ClearCell(column);
+    _pParent->NotifyRowChanged(*this);
 }
 
 // Routine Description:
@@ -120,6 +163,7 @@ void ROW::ClearColumn(const size_t column)
 // - wstring containing text for the row
 std::wstring ROW::GetText() const
 {
+    _EnsureThawed();
     return _charRow.GetText();
 }
 
@@ -135,12 +179,14 @@ RowCellIterator ROW::AsCellIter(const size_t startIndex, const size_t count) con
 
 UnicodeStorage& ROW::GetUnicodeStorage()
 {
-    return _pParent->GetUnicodeStorage();
+    _EnsureThawed();
+    return _charRow.GetUnicodeStorage();
 }
 
 const UnicodeStorage& ROW::GetUnicodeStorage() const
 {
-    return _pParent->GetUnicodeStorage();
+    _EnsureThawed();
+    return _charRow.GetUnicodeStorage();
 }
 
 // Routine Description:
@@ -154,8 +200,10 @@ const UnicodeStorage& ROW::GetUnicodeStorage() const
 // - iterator to first cell that was not written to this row. 
 OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, const bool setWrap, std::optional<size_t> limitRight)
 {
+    _EnsureThawed();
     THROW_HR_IF(E_INVALIDARG, index >= _charRow.size());
     THROW_HR_IF(E_INVALIDARG, limitRight.value_or(0) >= _charRow.size()); 
+    _pParent->NotifyRowChanged(*this);
     size_t currentIndex = index;
 
     // If we're given a right-side column limit, use it. Otherwise, the write limit is the final column index available in the char row.
@@ -163,6 +211,21 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
 
     while (it && currentIndex <= finalColumnInRow)
     {
+        // Text that fills one cell per character with one color can go in all at once.
+        const auto narrowText = it.GetNarrowRun(finalColumnInRow - currentIndex + 1);
+        if (!narrowText.empty())
+        {
+            WriteRun(narrowText, it->TextAttr(), currentIndex);
+            it.SkipNarrowRun(narrowText.size());
+            currentIndex += narrowText.size();
+
+            if (setWrap && currentIndex > finalColumnInRow)
+            {
+                _charRow.SetWrapForced(true);
+            }
+            continue;
+        }
+
         // Fill the color if the behavior isn't set to keeping the current color.
         if (it->TextAttrBehavior() != TextAttributeBehavior::Current)
         {
@@ -220,3 +283,142 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
 
     return it;
 }
+
+// Routine Description:
+// - writes a run of text that takes up one cell per character, all in one
+//   color, without going through the cells one at a time like WriteCells
+// Arguments:
+// - narrowText - the text. Every character must fill exactly one cell without
+//                a stored glyph, like printable ASCII does.
+// - attr - the color of the text
+// - column - column in row to start writing at
+// Return Value:
+// - <none>, throws exceptions on failures.
+void ROW::WriteRun(const std::wstring_view narrowText, const TextAttribute attr, const size_t column)
+{
+    _EnsureThawed();
+    THROW_HR_IF(E_INVALIDARG, column > _charRow.size() || narrowText.size() > _charRow.size() - column);
+    if (narrowText.empty())
+    {
+        return;
+    }
+    _pParent->NotifyRowChanged(*this);
+
+    const TextAttributeRun attrRun{ narrowText.size(), attr };
+    LOG_IF_FAILED(_attrRow.InsertAttrRuns({ &attrRun, 1 },
+                                          column,
+                                          column + narrowText.size() - 1,
+                                          _charRow.size()));
+    _charRow.WriteNarrowText(column, narrowText);
+}
+
+// Routine Description:
+// - Replaces the storage of the row with a compact copy of it, if it doesn't
+//   have one already. See FrozenRow.
+// - Anything that asks for the row's cells afterwards thaws it again, so
+//   this must not be called on a row that something is holding a reference
+//   into.
+// Arguments:
+// - pSpill - where to keep the copy, or nullptr to keep it on the heap. Must
+//      outlive the row.
+// Return Value:
+// - <none>, throws exceptions on failures.
+void ROW::Freeze(ScrollbackSpill* const pSpill)
+{
+    if (!_frozen)
+    {
+        _frozen = std::make_unique<FrozenRow>(_charRow, _attrRow, pSpill);
+        _charRow.Release();
+        _attrRow.Release();
+    }
+}
+
+bool ROW::IsFrozen() const noexcept
+{
+    return static_cast<bool>(_frozen);
+}
+
+// Routine Description:
+// - Gets roughly how many bytes the row takes up, for diagnostics.
+// Return Value:
+// - the size of this object plus the heap storage it owns
+size_t ROW::MemoryUsage() const noexcept
+{
+    if (_frozen)
+    {
+        return sizeof(*this) + _frozen->MemoryUsage();
+    }
+    return sizeof(*this) +
+           _charRow.size() * sizeof(CharRow::value_type) +
+           _attrRow.GetIdRuns().size() * sizeof(ATTR_ROW::IdRun);
+}
+
+// Routine Description:
+// - Marks every attribute id used by this row, without thawing it.
+// Arguments:
+// - inUse - Indexed by id. Must be big enough for any id in the row's table.
+void ROW::MarkIdsInUse(std::vector<bool>& inUse) const
+{
+    if (_frozen)
+    {
+        _frozen->MarkIdsInUse(inUse);
+    }
+    else
+    {
+        _attrRow.MarkIdsInUse(inUse);
+    }
+}
+
+// Routine Description:
+// - Measures the row as part of a line of text, without thawing it. TextBuffer::Reflow
+//   uses this to work out how many rows a line will take up at another width.
+// - Like a reflow, a row that wrapped counts all the way to its end, unless the end is
+//   padding for a double byte character that didn't fit. A row that's full without
+//   wrapping goes on into the next one too.
+// Arguments:
+// - cells - the length of the line so far. The row's cells are added to it.
+// - leadingCells - where the line's leading bytes are. The row's are added to it.
+// Return Value:
+// - true if the line goes on into the next row. <throws exceptions on failures>
+bool ROW::MeasureLine(size_t& cells, std::vector<size_t>& leadingCells) const
+{
+    if (_frozen)
+    {
+        return _frozen->MeasureLine(_rowWidth, cells, leadingCells);
+    }
+
+    size_t right = _charRow.MeasureRight();
+    if (_charRow.WasWrapForced())
+    {
+        right = _charRow.WasDoubleBytePadded() ? _rowWidth - 1 : _rowWidth;
+    }
+
+    for (size_t x = 0; x < right; ++x)
+    {
+        if (_charRow.DbcsAttrAt(x).IsLeading())
+        {
+            leadingCells.push_back(cells + x);
+        }
+    }
+    cells += right;
+
+    return _charRow.WasWrapForced() || right == _rowWidth;
+}
+
+// Routine Description:
+// - Thaws the row if it's frozen, and lets the buffer know that it has, so
+//   it can freeze it again later.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>, throws exceptions on failures.
+void ROW::_EnsureThawed() const
+{
+    if (_frozen)
+    {
+        THROW_IF_FAILED(_charRow.Resize(_rowWidth));
+        _frozen->Thaw(_charRow, _attrRow);
+        _frozen.reset();
+        _pParent->NotifyRowThawed(_id);
+    }
+}
@@ -24,6 +24,7 @@ Revision History:
 #include "OutputCell.hpp"
 #include "OutputCellIterator.hpp"
 #include "CharRow.hpp"
+#include "FrozenRow.hpp"
 #include "RowCellIterator.hpp"
 #include "UnicodeStorage.hpp"
 
@@ -39,11 +40,14 @@ public:
     const CharRow& GetCharRow() const;
     CharRow& GetCharRow();
 
-    const ATTR_ROW& GetAttrRow() const noexcept;
-    ATTR_ROW& GetAttrRow() noexcept;
+    const ATTR_ROW& GetAttrRow() const;
+    ATTR_ROW& GetAttrRow();
 
     SHORT GetId() const noexcept;
     void SetId(const SHORT id) noexcept;
+    uint64_t GetGeneration() const noexcept;
+    void SetGeneration(const uint64_t generation) noexcept;
+    void UpdateCharRowParent() noexcept;
 
     bool Reset(const TextAttribute Attr);
     [[nodiscard]]
@@ -59,23 +63,39 @@ public:
     const UnicodeStorage& GetUnicodeStorage() const;
 
     OutputCellIterator WriteCells(OutputCellIterator it, const size_t index, const bool setWrap, std::optional<size_t> limitRight = std::nullopt);
+    void WriteRun(const std::wstring_view narrowText, const TextAttribute attr, const size_t column);
 
-    friend bool operator==(const ROW& a, const ROW& b) noexcept;
+    void Freeze(ScrollbackSpill* const pSpill);
+    bool IsFrozen() const noexcept;
+    size_t MemoryUsage() const noexcept;
+    void MarkIdsInUse(std::vector<bool>& inUse) const;
+    bool MeasureLine(size_t& cells, std::vector<size_t>& leadingCells) const;
+
+    friend bool operator==(const ROW& a, const ROW& b);
 
 #ifdef UNIT_TESTING
     friend class RowTests;
 #endif
 
 private:
-    CharRow _charRow;
-    ATTR_ROW _attrRow;
+    void _EnsureThawed() const;
+
+    // While the row is frozen, these are empty, and everything is in _frozen
+    // instead. They're thawed by the first accessor that needs them, which
+    // may be a const one.
+    mutable CharRow _charRow;
+    mutable ATTR_ROW _attrRow;
+    mutable std::unique_ptr<FrozenRow> _frozen;
     SHORT _id;
     size_t _rowWidth;
+    uint64_t _generation; // the TextBuffer generation when the row last changed
     TextBuffer* _pParent; // non ownership pointer
 };
 
-inline bool operator==(const ROW& a, const ROW& b) noexcept
+inline bool operator==(const ROW& a, const ROW& b)
 {
+    a._EnsureThawed();
+    b._EnsureThawed();
     return (a._charRow == b._charRow &&
             a._attrRow == b._attrRow &&
             a._rowWidth == b._rowWidth &&
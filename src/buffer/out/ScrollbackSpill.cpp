@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "ScrollbackSpill.hpp"
+
+// Routine Description:
+// - Creates a spill in a new file in the temp directory. The file is deleted
+//   when the spill is destroyed, or the console goes away.
+// Arguments:
+// - <none>
+// Return Value:
+// - the spill, throws exceptions on failures.
+std::unique_ptr<ScrollbackSpill> ScrollbackSpill::CreateTemporary()
+{
+    std::array<wchar_t, MAX_PATH + 1> directory{};
+    THROW_LAST_ERROR_IF(0 == GetTempPathW(gsl::narrow<DWORD>(directory.size()), directory.data()));
+
+    std::array<wchar_t, MAX_PATH + 1> path{};
+    THROW_LAST_ERROR_IF(0 == GetTempFileNameW(directory.data(), L"con", 0, path.data()));
+
+    // Nothing else has any business opening the file while we have it.
+    wil::unique_hfile file{ CreateFileW(path.data(),
+                                        GENERIC_READ | GENERIC_WRITE,
+                                        0,
+                                        nullptr,
+                                        CREATE_ALWAYS,
+                                        FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE,
+                                        nullptr) };
+    if (!file)
+    {
+        const auto error = GetLastError();
+        LOG_IF_WIN32_BOOL_FALSE(DeleteFileW(path.data()));
+        THROW_WIN32(error);
+    }
+
+    return std::make_unique<ScrollbackSpill>(std::move(file));
+}
+
+// Routine Description:
+// - constructor
+// Arguments:
+// - file - the file to keep the records in. Opened for reading and writing,
+//      and empty. The spill owns it from now on.
+// Return Value:
+// - constructed object
+ScrollbackSpill::ScrollbackSpill(wil::unique_hfile file) noexcept :
+    _file{ std::move(file) },
+    _mapping{},
+    _view{},
+    _capacity{ 0 },
+    _end{ 0 },
+    _garbage{ 0 },
+    _index{},
+    _freeIds{}
+{
+}
+
+// Routine Description:
+// - Copies a record into the file.
+// Arguments:
+// - record - the bytes of the record. Must not be empty.
+// Return Value:
+// - the ID to read the record back with. Throws exceptions on failures.
+ScrollbackSpill::id_type ScrollbackSpill::Append(const std::basic_string_view<BYTE> record)
+{
+    THROW_HR_IF(E_INVALIDARG, record.empty());
+
+    const auto length = s_AlignedLength(record.size());
+    if (_end + length > _capacity && _garbage > _end / 2)
+    {
+        _Compact();
+    }
+    _Reserve(_end + length);
+
+    if (_freeIds.empty())
+    {
+        // Make room to free the ID up front, so that Erase can't fail.
+        _freeIds.reserve(_index.size() + 1);
+        const auto id = gsl::narrow<id_type>(_index.size());
+        _index.push_back({ 0, 0 });
+        _freeIds.push_back(id);
+    }
+
+    const auto id = _freeIds.back();
+    std::copy(record.cbegin(), record.cend(), _view.get() + _end);
+    _index[id] = { _end, record.size() };
+    _end += length;
+    _freeIds.pop_back();
+    return id;
+}
+
+// Routine Description:
+// - Gets a record from the file.
+// Arguments:
+// - id - the ID that Append returned for it
+// Return Value:
+// - the bytes of the record, in the mapping of the file. They're only valid
+//   until the next call to Append.
+std::basic_string_view<BYTE> ScrollbackSpill::Read(const id_type id) const
+{
+    const auto& entry = _index.at(id);
+    THROW_HR_IF(E_INVALIDARG, 0 == entry.length);
+    return { _view.get() + entry.offset, entry.length };
+}
+
+// Routine Description:
+// - Frees a record, so that its space can be reused.
+// Arguments:
+// - id - the ID that Append returned for it
+// Return Value:
+// - <none>
+void ScrollbackSpill::Erase(const id_type id) noexcept
+{
+    if (id < _index.size() && _index[id].length != 0)
+    {
+        _garbage += s_AlignedLength(_index[id].length);
+        _index[id] = { 0, 0 };
+        _freeIds.push_back(id);
+    }
+}
+
+// Routine Description:
+// - Gets how many bytes of the file are in use by records.
+size_t ScrollbackSpill::Size() const noexcept
+{
+    return _end - _garbage;
+}
+
+// Routine Description:
+// - Gets how big the file is.
+size_t ScrollbackSpill::Capacity() const noexcept
+{
+    return _capacity;
+}
+
+size_t ScrollbackSpill::s_AlignedLength(const size_t length) noexcept
+{
+    return (length + RecordAlignment - 1) / RecordAlignment * RecordAlignment;
+}
+
+// Routine Description:
+// - Makes the file, and the mapping of it, at least the given size.
+// Arguments:
+// - size - how many bytes are needed
+// Return Value:
+// - <none>, throws exceptions on failures. The file is left as it was.
+void ScrollbackSpill::_Reserve(const size_t size)
+{
+    if (size <= _capacity)
+    {
+        return;
+    }
+
+    const auto capacity = std::max({ size, _capacity * 2, MinGrowth });
+    const auto capacity64 = static_cast<uint64_t>(capacity);
+
+    // Mapping a bigger size grows the file. Map it again before letting go of
+    // the old view, so failing leaves everything as it was.
+    wil::unique_handle mapping{ CreateFileMappingW(_file.get(),
+                                                   nullptr,
+                                                   PAGE_READWRITE,
+                                                   static_cast<DWORD>(capacity64 >> 32),
+                                                   static_cast<DWORD>(capacity64),
+                                                   nullptr) };
+    THROW_LAST_ERROR_IF_NULL(mapping.get());
+
+    wil::unique_mapview_ptr<BYTE> view{ static_cast<BYTE*>(MapViewOfFile(mapping.get(),
+                                                                         FILE_MAP_READ | FILE_MAP_WRITE,
+                                                                         0,
+                                                                         0,
+                                                                         capacity)) };
+    THROW_LAST_ERROR_IF_NULL(view.get());
+
+    _view = std::move(view);
+    _mapping = std::move(mapping);
+    _capacity = capacity;
+}
+
+// Routine Description:
+// - Moves all of the records down to the start of the file, filling in the
+//   holes left by the ones that were erased. Their IDs stay the same.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>, throws exceptions on failures, before anything is moved.
+void ScrollbackSpill::_Compact()
+{
+    std::vector<id_type> ids;
+    ids.reserve(_index.size() - _freeIds.size());
+    for (id_type id = 0; id < _index.size(); ++id)
+    {
+        if (_index[id].length != 0)
+        {
+            ids.push_back(id);
+        }
+    }
+    std::sort(ids.begin(), ids.end(), [this](const id_type a, const id_type b) noexcept {
+        return _index[a].offset < _index[b].offset;
+    });
+
+    size_t end = 0;
+    for (const auto id : ids)
+    {
+        auto& entry = _index[id];
+        std::memmove(_view.get() + end, _view.get() + entry.offset, entry.length);
+        entry.offset = end;
+        end += s_AlignedLength(entry.length);
+    }
+    _end = end;
+    _garbage = 0;
+}
@@ -0,0 +1,71 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- ScrollbackSpill.hpp
+
+Abstract:
+- Holds the records of frozen rows (see FrozenRow) in a temporary file that's
+    mapped into memory, instead of on the heap. The memory manager can write the
+    pages of a mapped file out and drop them whenever it likes, so a long
+    history that nobody is looking at doesn't keep the console's memory use up.
+    Rows are read straight out of the mapping when they're thawed.
+- Records are appended to the end of the file, and found by an ID that indexes
+    their offset and length. Erasing a record leaves a hole. Once the holes add
+    up to more than half the file, the records are moved down to fill them.
+--*/
+
+#pragma once
+
+class ScrollbackSpill final
+{
+public:
+    using id_type = uint32_t;
+
+    static std::unique_ptr<ScrollbackSpill> CreateTemporary();
+
+    ScrollbackSpill(wil::unique_hfile file) noexcept;
+
+    ScrollbackSpill(const ScrollbackSpill&) = delete;
+    ScrollbackSpill& operator=(const ScrollbackSpill&) = delete;
+
+    id_type Append(const std::basic_string_view<BYTE> record);
+    std::basic_string_view<BYTE> Read(const id_type id) const;
+    void Erase(const id_type id) noexcept;
+
+    size_t Size() const noexcept;
+    size_t Capacity() const noexcept;
+
+private:
+    // Records start at multiples of this, so what's in them can be read in place.
+    static constexpr size_t RecordAlignment = 8;
+    // The file grows by at least this much at a time.
+    static constexpr size_t MinGrowth = 1024 * 1024;
+
+    struct Entry
+    {
+        size_t offset;
+        size_t length; // 0 if the ID is free
+    };
+
+    static size_t s_AlignedLength(const size_t length) noexcept;
+
+    void _Reserve(const size_t size);
+    void _Compact();
+
+    wil::unique_hfile _file;
+    wil::unique_handle _mapping;
+    wil::unique_mapview_ptr<BYTE> _view;
+    size_t _capacity;
+
+    size_t _end; // where the next record goes
+    size_t _garbage; // how much of the file before _end isn't in a record
+
+    std::vector<Entry> _index;
+    std::vector<id_type> _freeIds;
+
+#ifdef UNIT_TESTING
+    friend class ScrollbackSpillTests;
+#endif
+};
@@ -161,6 +161,8 @@ private:
     TextColor _background;
     bool _isBold;
 
+    friend struct std::hash<TextAttribute>;
+
 #ifdef UNIT_TESTING
     friend class TextBufferTests;
     friend class TextAttributeTests;
@@ -208,6 +210,23 @@ constexpr bool operator!=(const WORD& legacyAttr, const TextAttribute& attr) noe
     return !(attr == legacyAttr);
 }
 
+namespace std
+{
+    template<>
+    struct hash<TextAttribute>
+    {
+        size_t operator()(const TextAttribute& attr) const noexcept
+        {
+            // Uses the same fields as operator==.
+            const std::hash<TextColor> hashColor;
+            size_t hash = hashColor(attr._foreground);
+            hash = hash * 31 + hashColor(attr._background);
+            hash = hash * 31 + attr._wAttrLegacy;
+            return hash * 31 + attr._isBold;
+        }
+    };
+}
+
 #ifdef UNIT_TESTING
 
 #define LOG_ATTR(attr) (Log::Comment(NoThrowString().Format(\
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "TextAttributeTable.hpp"
+
+TextAttributeTable::TextAttributeTable() :
+    _attributes{},
+    _ids{},
+    _free{},
+    _collect{},
+    _generation{ 0 }
+{
+}
+
+// Routine Description:
+// - Sets the function to call when the table runs out of ids.
+// Arguments:
+// - callback - Should report every id that's still in use to Collect.
+void TextAttributeTable::SetCollectCallback(CollectCallback callback)
+{
+    _collect = std::move(callback);
+}
+
+// Routine Description:
+// - Gets the id for the given attribute, adding it to the table if it isn't there already.
+// - If the table is full, this will ask the owner to collect the unused ids first. Ids
+//   that were returned earlier but aren't stored anywhere yet may be given away when
+//   that happens. Check Generation() to find out.
+// Arguments:
+// - attr - The attribute to get the id of.
+// Return Value:
+// - The id of the attribute.
+// Note:
+// - will throw if the table is full of ids that are still in use.
+TextAttributeTable::id_type TextAttributeTable::Intern(const TextAttribute& attr)
+{
+    const auto it = _ids.find(attr);
+    if (it != _ids.end())
+    {
+        return it->second;
+    }
+
+    if (_free.empty() && _attributes.size() == MaxSize && _collect)
+    {
+        _collect(*this);
+    }
+
+    id_type id;
+    if (!_free.empty())
+    {
+        id = _free.back();
+        _free.pop_back();
+        _attributes.at(id) = attr;
+    }
+    else
+    {
+        THROW_HR_IF(E_OUTOFMEMORY, _attributes.size() == MaxSize);
+        id = gsl::narrow_cast<id_type>(_attributes.size());
+        _attributes.push_back(attr);
+    }
+
+    _ids.emplace(attr, id);
+    return id;
+}
+
+// Routine Description:
+// - Gets the id for the given attribute, if it's in the table.
+// Arguments:
+// - attr - The attribute to look for.
+// Return Value:
+// - The id of the attribute, or nullopt if nothing has interned it.
+std::optional<TextAttributeTable::id_type> TextAttributeTable::Find(const TextAttribute& attr) const
+{
+    const auto it = _ids.find(attr);
+    if (it != _ids.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+// Routine Description:
+// - Gets the attribute with the given id.
+// Arguments:
+// - id - An id returned by Intern.
+// Return Value:
+// - The attribute. The reference stays valid until the id is collected.
+const TextAttribute& TextAttributeTable::Get(const id_type id) const
+{
+    return _attributes[id];
+}
+
+// Routine Description:
+// - Gets the number of ids that have been given out, including ones that were collected.
+//   Any id is less than this.
+size_t TextAttributeTable::Size() const noexcept
+{
+    return _attributes.size();
+}
+
+// Routine Description:
+// - Gets a count of how many times ids have been collected.
+size_t TextAttributeTable::Generation() const noexcept
+{
+    return _generation;
+}
+
+// Routine Description:
+// - Frees every id that isn't in use, so it can be given out again.
+// Arguments:
+// - inUse - Indexed by id, true for each id that's still stored somewhere.
+//      Ids past the end of it are treated as unused.
+void TextAttributeTable::Collect(const std::vector<bool>& inUse)
+{
+    _free.clear();
+    for (size_t id = 0; id < _attributes.size(); id++)
+    {
+        if (id >= inUse.size() || !inUse.at(id))
+        {
+            _free.push_back(gsl::narrow_cast<id_type>(id));
+        }
+    }
+
+    // Only keep the attributes that are still in use, so they don't get found and handed out with a freed id.
+    for (auto it = _ids.begin(); it != _ids.end();)
+    {
+        if (it->second >= inUse.size() || !inUse.at(it->second))
+        {
+            it = _ids.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Hand out the lowest ids first.
+    std::reverse(_free.begin(), _free.end());
+
+    _generation++;
+}
@@ -0,0 +1,63 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- TextAttributeTable.hpp
+
+Abstract:
+- Interns the TextAttributes used by a text buffer, so that its rows can store
+    a 16-bit id for each run instead of a whole TextAttribute.
+- A buffer only uses a handful of attributes at any one time, but over time
+    it can see far more than fit in 16 bits (an app cycling through RGB
+    colors, say). When the table runs out of ids, it asks its owner which ids
+    are still in use, and reuses the rest.
+--*/
+
+#pragma once
+
+#include "TextAttribute.hpp"
+
+class TextAttributeTable final
+{
+public:
+    using id_type = uint16_t;
+
+    // The number of ids there are to give out.
+    static constexpr size_t MaxSize = static_cast<size_t>(std::numeric_limits<id_type>::max()) + 1;
+
+    // Called when the table is full. It should call Collect with every id
+    //      that's still stored somewhere.
+    using CollectCallback = std::function<void(TextAttributeTable&)>;
+
+    TextAttributeTable();
+
+    TextAttributeTable(const TextAttributeTable&) = delete;
+    TextAttributeTable& operator=(const TextAttributeTable&) = delete;
+
+    void SetCollectCallback(CollectCallback callback);
+
+    id_type Intern(const TextAttribute& attr);
+    std::optional<id_type> Find(const TextAttribute& attr) const;
+    const TextAttribute& Get(const id_type id) const;
+
+    size_t Size() const noexcept;
+    size_t Generation() const noexcept;
+
+    void Collect(const std::vector<bool>& inUse);
+
+private:
+    // Indexed by id. A deque, so references to the attributes stay valid as the table grows.
+    std::deque<TextAttribute> _attributes;
+    std::unordered_map<TextAttribute, id_type> _ids;
+    // Ids that were collected, and can be given out again.
+    std::vector<id_type> _free;
+    CollectCallback _collect;
+    // Incremented each time ids are collected, so callers that are holding
+    //      ids they haven't stored yet know they might have been given away.
+    size_t _generation;
+
+#ifdef UNIT_TESTING
+    friend class TextAttributeTableTests;
+#endif
+};
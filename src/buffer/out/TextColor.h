@@ -117,6 +117,8 @@ private:
 
     COLORREF _GetRGB() const;
 
+    friend struct std::hash<TextColor>;
+
 #ifdef UNIT_TESTING
     friend class TextBufferTests;
     template<typename TextColor> friend class WEX::TestExecution::VerifyOutputTraits;
@@ -138,6 +140,22 @@ bool constexpr operator!=(const TextColor& a, const TextColor& b) noexcept
     return !(a == b);
 }
 
+namespace std
+{
+    template<>
+    struct hash<TextColor>
+    {
+        constexpr size_t operator()(const TextColor& color) const noexcept
+        {
+            // Uses the same fields as operator==.
+            return (static_cast<size_t>(color._meta) << 24) |
+                   (static_cast<size_t>(color._red) << 16) |
+                   (static_cast<size_t>(color._green) << 8) |
+                   static_cast<size_t>(color._blue);
+        }
+    };
+}
+
 #ifdef UNIT_TESTING
 
 namespace WEX {
@@ -4,95 +4,220 @@
 #include "precomp.h"
 #include "UnicodeStorage.hpp"
 
-UnicodeStorage::UnicodeStorage() :
-    _map{}
+UnicodeStorage::UnicodeStorage() noexcept :
+    _inline{},
+    _inlineCount{ 0 },
+    _spilled{},
+    _pool{},
+    _garbage{ 0 }
 {
 }
 
 // Routine Description:
-// - fetches the text associated with key
+// - fetches the text associated with column
 // Arguments:
-// - key - the key into the storage
+// - column - the column of the row the glyph was stored for
 // Return Value:
-// - the glyph data associated with key
-// Note: will throw exception if key is not stored yet
-const UnicodeStorage::mapped_type& UnicodeStorage::GetText(const key_type key) const
+// - the glyph data associated with column. Only valid until the storage is next modified.
+// Note: will throw exception if column is not stored yet
+UnicodeStorage::mapped_type UnicodeStorage::GetText(const key_type column) const
 {
-    return _map.at(key);
+    const auto entry = _find(column);
+    THROW_HR_IF(E_INVALIDARG, entry == nullptr);
+    return { _pool.data() + entry->offset, entry->length };
 }
 
 // Routine Description:
-// - stores glyph data associated with key.
+// - stores glyph data associated with column.
 // Arguments:
-// - key - the key into the storage
+// - column - the column of the row to store the glyph for
 // - glyph - the glyph data to store
-void UnicodeStorage::StoreGlyph(const key_type key, const mapped_type& glyph)
+void UnicodeStorage::StoreGlyph(const key_type column, const mapped_type glyph)
 {
-    _map.insert_or_assign(key, glyph);
+    const auto key = gsl::narrow<uint16_t>(column);
+    const auto length = gsl::narrow<uint16_t>(glyph.size());
+
+    auto pos = std::lower_bound(_begin(), _end(), key, [](const Entry& entry, const uint16_t key) {
+        return entry.column < key;
+    });
+
+    if (pos != _end() && pos->column == key)
+    {
+        // Overwriting a glyph with one that's no longer can reuse its space.
+        if (length <= pos->length)
+        {
+            std::copy(glyph.cbegin(), glyph.cend(), _pool.begin() + pos->offset);
+            _garbage += pos->length - length;
+            pos->length = length;
+            return;
+        }
+
+        const auto index = pos - _begin();
+        _erase(pos);
+        pos = _begin() + index;
+    }
+
+    // Reclaim the space of old glyphs once they take up as much of the pool as
+    // the live ones, so rows that keep getting overwritten don't keep growing.
+    if (_garbage != 0 && _garbage >= _pool.size() / 2)
+    {
+        const auto index = pos - _begin();
+        _compact();
+        pos = _begin() + index;
+    }
+
+    const auto offset = gsl::narrow<uint32_t>(_pool.size());
+    _pool.append(glyph);
+    _insert(pos, { key, length, offset });
 }
 
 // Routine Description:
-// - erases key and it's associated data from the storage
+// - erases column and it's associated data from the storage
 // Arguments:
-// - key - the key to remove
-void UnicodeStorage::Erase(const key_type key) noexcept
+// - column - the column to remove
+void UnicodeStorage::Erase(const key_type column) noexcept
 {
-    _map.erase(key);
+    const auto entry = _find(column);
+    if (entry != nullptr)
+    {
+        _erase(_begin() + (entry - _begin()));
+    }
 }
 
 // Routine Description:
-// - Remaps all of the stored items to new coordinate positions
-//   based on a bulk rearrangement of row IDs and potential row width resize.
+// - Removes all of the stored items that are beyond the new row width.
 // Arguments:
-// - rowMap - A map of the old row IDs to the new row IDs.
-// - width - The width of the new row. Remove any items that are beyond the row width.
-//         - Use nullopt if we're not resizing the width of the row, just renumbering the rows.
-void UnicodeStorage::Remap(const std::map<SHORT, SHORT>& rowMap, const std::optional<SHORT> width)
+// - width - The new width of the row.
+void UnicodeStorage::Resize(const size_t width) noexcept
 {
-    // Make a temporary map to hold all the new row positioning
-    std::unordered_map<key_type, mapped_type> newMap;
-
-    // Walk through every stored item.
-    for (const auto& pair : _map)
+    while (_begin() != _end() && (_end() - 1)->column >= width)
     {
-        // Extract the old coordinate position
-        const auto oldCoord = pair.first;
+        _erase(_end() - 1);
+    }
+}
 
-        // Only try to short-circuit based on width if we were told it changed
-        // by being given a new width value.
-        if (width.has_value())
-        {
-            // Get the column ID
-            const auto oldColId = oldCoord.X;
-
-            // If the column index is at/beyond the row width, don't bother copying it to the new map.
-            if (oldColId >= width.value())
-            {
-                continue;
-            }
-        }
+// Routine Description:
+// - Removes all of the stored items.
+void UnicodeStorage::Reset() noexcept
+{
+    _inlineCount = 0;
+    _spilled.clear();
+    _pool.clear();
+    _garbage = 0;
+}
 
-        // Get the row ID from the position as that's what we need to remap
-        const auto oldRowId = oldCoord.Y;
+// Routine Description:
+// - Gets the number of stored items.
+size_t UnicodeStorage::Size() const noexcept
+{
+    return _spilled.empty() ? _inlineCount : _spilled.size();
+}
 
-        // Use the mapping given to convert the old row ID to the new row ID
-        const auto mapIter = rowMap.find(oldRowId);
+// Routine Description:
+// - Tells whether there are any stored items.
+bool UnicodeStorage::Empty() const noexcept
+{
+    return Size() == 0;
+}
 
-        // If there's no mapping to a new row, don't bother copying it to the new map. The row is gone.
-        if (mapIter == rowMap.end())
-        {
-            continue;
-        }
+UnicodeStorage::Entry* UnicodeStorage::_begin() noexcept
+{
+    return _spilled.empty() ? _inline.data() : _spilled.data();
+}
 
-        const auto newRowId = mapIter->second;
+UnicodeStorage::Entry* UnicodeStorage::_end() noexcept
+{
+    return _begin() + Size();
+}
 
-        // Generate a new coordinate with the same X as the old one, but a new Y value.
-        const auto newCoord = COORD{ oldCoord.X, newRowId };
+const UnicodeStorage::Entry* UnicodeStorage::_begin() const noexcept
+{
+    return _spilled.empty() ? _inline.data() : _spilled.data();
+}
 
-        // Put the adjusted coordinate into the map with the original value.
-        newMap.emplace(newCoord, pair.second);
+const UnicodeStorage::Entry* UnicodeStorage::_end() const noexcept
+{
+    return _begin() + Size();
+}
+
+// Routine Description:
+// - Finds the entry for column.
+// Arguments:
+// - column - the column to look for
+// Return Value:
+// - the entry, or nullptr if nothing is stored for column
+const UnicodeStorage::Entry* UnicodeStorage::_find(const key_type column) const noexcept
+{
+    const auto pos = std::lower_bound(_begin(), _end(), column, [](const Entry& entry, const key_type column) {
+        return entry.column < column;
+    });
+    return (pos != _end() && pos->column == column) ? pos : nullptr;
+}
+
+// Routine Description:
+// - Inserts an entry into the table, moving the table to the heap if it no
+//   longer fits inline.
+// Arguments:
+// - pos - where to insert the entry. Keeps the table sorted by column.
+// - entry - the entry to insert
+void UnicodeStorage::_insert(Entry* const pos, const Entry entry)
+{
+    const auto index = pos - _begin();
+    if (!_spilled.empty())
+    {
+        _spilled.insert(_spilled.begin() + index, entry);
+    }
+    else if (_inlineCount < _inline.size())
+    {
+        std::copy_backward(pos, _end(), _end() + 1);
+        *pos = entry;
+        ++_inlineCount;
+    }
+    else
+    {
+        _spilled.reserve(_inline.size() * 2);
+        _spilled.insert(_spilled.end(), _inline.cbegin(), _inline.cend());
+        _spilled.insert(_spilled.begin() + index, entry);
+        _inlineCount = 0;
+    }
+}
+
+// Routine Description:
+// - Removes an entry from the table. Its text stays in the pool until the
+//   pool is next compacted, unless the table is now empty.
+// Arguments:
+// - pos - the entry to remove
+void UnicodeStorage::_erase(Entry* const pos) noexcept
+{
+    _garbage += pos->length;
+    if (!_spilled.empty())
+    {
+        _spilled.erase(_spilled.begin() + (pos - _begin()));
+    }
+    else
+    {
+        std::copy(pos + 1, _end(), pos);
+        --_inlineCount;
     }
 
-    // Swap into the stored map, free the temporary when we exit.
-    _map.swap(newMap);
+    if (Empty())
+    {
+        Reset();
+    }
+}
+
+// Routine Description:
+// - Rebuilds the pool with only the text of the stored items.
+void UnicodeStorage::_compact()
+{
+    std::wstring pool;
+    pool.reserve(_pool.size() - _garbage);
+    for (auto entry = _begin(); entry != _end(); ++entry)
+    {
+        const auto offset = gsl::narrow<uint32_t>(pool.size());
+        pool.append(_pool, entry->offset, entry->length);
+        entry->offset = offset;
+    }
+    _pool.swap(pool);
+    _garbage = 0;
 }
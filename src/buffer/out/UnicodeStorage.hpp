@@ -7,6 +7,12 @@ Module Name:
 
 Abstract:
 - dynamic storage location for glyphs that can't normally fit in the output buffer
+- Each CharRow owns one of these, keyed by column. The glyphs live in a single
+    string pool per row, and a small sorted table of {column, offset, length}
+    entries points into it. The first few entries are stored inline, so a row
+    with a couple of emoji doesn't need any heap allocations beyond the pool.
+- Because the storage travels with its row, scrolling, rotating and resizing the
+    buffer never have to look up or rekey glyphs.
 
 Author(s):
 - Austin Diviness (AustDi) 02-May-2018
@@ -14,52 +20,62 @@ Author(s):
 
 #pragma once
 
+#include <array>
+#include <string>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
-#include <climits>
-
-// std::unordered_map needs help to know how to hash a COORD
-namespace std
-{
-    template <>
-    struct hash<COORD>
-    {
-
-        // Routine Description:
-        // - hashes a coord. coord will be hashed by storing the x and y values consecutively in the lower
-        // bits of a size_t.
-        // Arguments:
-        // - coord - the coord to hash
-        // Return Value:
-        // - the hashed coord
-        constexpr size_t operator()(const COORD& coord) const noexcept
-        {
-            size_t retVal = coord.Y;
-            const size_t xCoord = coord.X;
-            retVal |= xCoord << (sizeof(coord.Y) * CHAR_BIT);
-            return retVal;
-        }
-    };
-}
 
 class UnicodeStorage final
 {
 public:
-    using key_type = typename COORD;
-    using mapped_type = typename std::vector<wchar_t>;
+    using key_type = size_t;
+    using mapped_type = std::wstring_view;
+
+    UnicodeStorage() noexcept;
+
+    mapped_type GetText(const key_type column) const;
 
-    UnicodeStorage();
+    void StoreGlyph(const key_type column, const mapped_type glyph);
 
-    const mapped_type& GetText(const key_type key) const;
+    void Erase(const key_type column) noexcept;
 
-    void StoreGlyph(const key_type key, const mapped_type& glyph);
+    void Resize(const size_t width) noexcept;
 
-    void Erase(const key_type key) noexcept;
+    void Reset() noexcept;
 
-    void Remap(const std::map<SHORT, SHORT>& rowMap, const std::optional<SHORT> width);
+    size_t Size() const noexcept;
+    bool Empty() const noexcept;
 
 private:
-    std::unordered_map<key_type, mapped_type> _map;
+    struct Entry
+    {
+        uint16_t column;
+        uint16_t length;
+        uint32_t offset;
+    };
+
+    // How many entries fit before the table moves to the heap.
+    static constexpr size_t InlineEntries = 2;
+
+    Entry* _begin() noexcept;
+    Entry* _end() noexcept;
+    const Entry* _begin() const noexcept;
+    const Entry* _end() const noexcept;
+    const Entry* _find(const key_type column) const noexcept;
+    void _insert(Entry* const pos, const Entry entry);
+    void _erase(Entry* const pos) noexcept;
+    void _compact();
+
+    // Used while there are no more than InlineEntries entries. Once the table
+    // spills, all of the entries move to _spilled.
+    std::array<Entry, InlineEntries> _inline;
+    size_t _inlineCount;
+    std::vector<Entry> _spilled;
+
+    // The text of every glyph, including the text of ones since erased or
+    // overwritten, which is counted by _garbage until the pool is compacted.
+    std::wstring _pool;
+    size_t _garbage;
 
 #ifdef UNIT_TESTING
     friend class UnicodeStorageTests;
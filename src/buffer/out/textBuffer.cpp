@@ -29,11 +29,26 @@ TextBuffer::TextBuffer(const COORD screenBufferSize,
     _firstRow{ 0 },
     _currentAttributes{ defaultAttributes },
     _cursor{ cursorSize, *this },
+    _attributeTable{},
+    _spill{},
     _storage{},
-    _unicodeStorage{},
+    _deferredRows{},
+    _deferredLines{},
+    _deferredRowsHeight{ 0 },
+    _coldRowDistance{ DefaultColdRowDistance },
+    _thawedRows{},
+    _rescanColdRows{ false },
+    _generation{ 0 },
+    _allRowsChangedGeneration{ 0 },
+    _changedRows{},
     _renderTarget{ renderTarget }
 {
+    _attributeTable.SetCollectCallback([this](TextAttributeTable& table) { _CollectAttributes(table); });
+
     // initialize ROWs
+    // Reserve up front. The rows' CharRows point back at their ROW, so the
+    // storage must not move while we fill it.
+    _storage.reserve(static_cast<size_t>(screenBufferSize.Y));
     for (size_t i = 0; i < static_cast<size_t>(screenBufferSize.Y); ++i)
     {
         _storage.emplace_back(static_cast<SHORT>(i), screenBufferSize.X, _currentAttributes, this);
@@ -70,8 +85,15 @@ UINT TextBuffer::TotalRowCount() const
 // - Number of rows down from the first row of the buffer.
 // Return Value:
 // - const reference to the requested row. Asserts if out of bounds.
+// Note: The rows at the top that were left for the lines Reflow set aside are
+//   re-wrapped the first time any of them is asked for.
 const ROW& TextBuffer::GetRowByOffset(const size_t index) const
 {
+    if (index < static_cast<size_t>(_deferredRowsHeight))
+    {
+        LOG_IF_FAILED(const_cast<TextBuffer*>(this)->ReflowDeferredRows());
+    }
+
     const size_t totalRows = TotalRowCount();
 
     // Rows are stored circularly, so the index you ask for is offset by the start position and mod the total of rows.
@@ -86,11 +108,89 @@ const ROW& TextBuffer::GetRowByOffset(const size_t index) const
 // - Number of rows down from the first row of the buffer.
 // Return Value:
 // - reference to the requested row. Asserts if out of bounds.
+// Note: Callers that change the row's CharRow or ATTR_ROW directly must call
+//   NotifyRowChanged afterwards. Writing through the ROW does that already.
 ROW& TextBuffer::GetRowByOffset(const size_t index)
 {
     return const_cast<ROW&>(static_cast<const TextBuffer*>(this)->GetRowByOffset(index));
 }
 
+// Routine Description:
+// - Gets the buffer's generation, which goes up whenever rows change. Hang on to it
+//   after reading the buffer, and pass it to GetRowsChangedSince next time to find
+//   out which rows need reading again.
+// Arguments:
+// - <none>
+// Return Value:
+// - the current generation
+uint64_t TextBuffer::GetGeneration() const noexcept
+{
+    return _generation;
+}
+
+// Routine Description:
+// - Finds the rows that may have changed after the given generation. Rows are
+//   counted as changed when they're written to (see NotifyRowChanged), or when
+//   different rows move into their offsets. Scrolling the whole buffer, circling
+//   it, resetting it or resizing it changes every row.
+// Arguments:
+// - generation - a generation from GetGeneration
+// Return Value:
+// - the offsets of the changed rows, from the top down
+std::vector<SHORT> TextBuffer::GetRowsChangedSince(const uint64_t generation) const
+{
+    return GetRowsChangedSince(generation, 0, gsl::narrow<SHORT>(TotalRowCount()));
+}
+
+// Routine Description:
+// - Finds the rows in the given range that may have changed after the given
+//   generation. See above.
+// - Only the rows that changed are looked at, unless every row did.
+// Arguments:
+// - generation - a generation from GetGeneration
+// - top - the offset of the first row to look at
+// - bottom - the offset of the row after the last one to look at
+// Return Value:
+// - the offsets of the changed rows in [top, bottom), from the top down
+std::vector<SHORT> TextBuffer::GetRowsChangedSince(const uint64_t generation, const SHORT top, const SHORT bottom) const
+{
+    const auto height = gsl::narrow<SHORT>(TotalRowCount());
+    const SHORT first = std::max<SHORT>(top, 0);
+    const SHORT last = std::min(bottom, height);
+
+    std::vector<SHORT> rows;
+    if (_allRowsChangedGeneration > generation)
+    {
+        for (SHORT y = first; y < last; ++y)
+        {
+            rows.push_back(y);
+        }
+        return rows;
+    }
+
+    // _changedRows is in the order the rows changed, so everything after the given
+    // generation is at the end.
+    const auto newer = std::upper_bound(_changedRows.cbegin(),
+                                        _changedRows.cend(),
+                                        generation,
+                                        [](const uint64_t generation, const std::pair<uint64_t, SHORT>& change) {
+                                            return generation < change.first;
+                                        });
+    for (auto it = newer; it != _changedRows.cend(); ++it)
+    {
+        if (_IsLatestChange(*it))
+        {
+            const auto y = gsl::narrow_cast<SHORT>((it->second + _storage.size() - _firstRow) % _storage.size());
+            if (y >= first && y < last)
+            {
+                rows.push_back(y);
+            }
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+}
+
 // Routine Description:
 // - Retrieves read-only text iterator at the given buffer location
 // Arguments:
@@ -239,7 +339,7 @@ bool TextBuffer::_AssertValidDoubleByteSequence(const DbcsAttribute dbcsAttribut
         // Erase previous character into an N type.
         try
         {
-            prevRow.GetCharRow().ClearCell(coordPrevPosition.X);
+            prevRow.ClearColumn(coordPrevPosition.X);
         }
         catch (...)
         {
@@ -281,8 +381,9 @@ bool TextBuffer::_PrepareForDoubleByteSequence(const DbcsAttribute dbcsAttribute
         if (GetCursor().GetPosition().X == sBufferWidth - 1)
         {
             // set that we're wrapping for double byte reasons
-            CharRow& charRow = GetRowByOffset(GetCursor().GetPosition().Y).GetCharRow();
-            charRow.SetDoubleBytePadded(true);
+            ROW& row = GetRowByOffset(GetCursor().GetPosition().Y);
+            row.GetCharRow().SetDoubleBytePadded(true);
+            NotifyRowChanged(row);
 
             // then move the cursor forward and onto the next row
             fSuccess = IncrementCursor();
@@ -411,6 +512,7 @@ bool TextBuffer::InsertCharacter(const std::wstring_view chars,
             LOG_HR(wil::ResultFromCaughtException());
             return false;
         }
+        NotifyRowChanged(Row);
 
         // Store color data
         fSuccess = Row.GetAttrRow().SetAttrToEnd(iCol, attr);
@@ -462,7 +564,9 @@ void TextBuffer::_AdjustWrapOnCurrentRow(const bool fSet)
     const UINT uiCurrentRowOffset = GetCursor().GetPosition().Y;
 
     // Set the wrap status as appropriate
-    GetRowByOffset(uiCurrentRowOffset).GetCharRow().SetWrapForced(fSet);
+    ROW& row = GetRowByOffset(uiCurrentRowOffset);
+    row.GetCharRow().SetWrapForced(fSet);
+    NotifyRowChanged(row);
 }
 
 //Routine Description:
@@ -524,6 +628,15 @@ bool TextBuffer::NewlineCursor()
     {
         fSuccess = true;
     }
+
+    if (fSuccess)
+    {
+        try
+        {
+            _FreezeColdRows();
+        }
+        CATCH_LOG();
+    }
     return fSuccess;
 }
 
@@ -543,6 +656,15 @@ bool TextBuffer::IncrementCircularBuffer()
     bool fSuccess = _storage.at(_firstRow).Reset(_currentAttributes);
     if (fSuccess)
     {
+        // If this was one of the rows kept for the lines Reflow set aside, there's one
+        // fewer of them. Re-wrapping the lines drops their oldest row to fit, the same
+        // as it would have scrolled off here.
+        if (_deferredRowsHeight > 0 && --_deferredRowsHeight == 0)
+        {
+            _deferredRows.clear();
+            _deferredLines.clear();
+        }
+
         // Now proceed to increment.
         // Incrementing it will cause the next line down to become the new "top" of the window (the new "0" in logical coordinates)
         _firstRow++;
@@ -552,6 +674,9 @@ bool TextBuffer::IncrementCircularBuffer()
         {
             _firstRow = 0;
         }
+
+        // Every offset has a different row in it now.
+        _MarkAllRowsChanged();
     }
     return fSuccess;
 }
@@ -564,9 +689,20 @@ bool TextBuffer::IncrementCircularBuffer()
 // - Coordinate position in screen coordinates (offset coordinates, not array index coordinates).
 COORD TextBuffer::GetLastNonSpaceCharacter() const
 {
-    COORD coordEndOfText;
     // Always search the whole buffer, by starting at the bottom.
-    coordEndOfText.Y = GetSize().BottomInclusive();
+    return _GetLastNonSpaceCharacter(GetSize().BottomInclusive());
+}
+
+// Routine Description:
+// - Like GetLastNonSpaceCharacter, but for when the rows below a certain one are known to be empty.
+// Arguments:
+// - lastRow - the row to start searching back from.
+// Return Value:
+// - Coordinate position in screen coordinates (offset coordinates, not array index coordinates).
+COORD TextBuffer::_GetLastNonSpaceCharacter(const SHORT lastRow) const
+{
+    COORD coordEndOfText;
+    coordEndOfText.Y = lastRow;
 
     const ROW* pCurrRow = &GetRowByOffset(coordEndOfText.Y);
     // The X position of the end of the valid text is the Right draw boundary (which is one beyond the final valid character)
@@ -645,17 +781,14 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         return;
     }
 
-    // OK. We're about to play games by moving rows around within the deque to
+    // OK. We're about to play games by moving rows around within the storage to
     // scroll a massive region in a faster way than copying things.
-    // To make this easier, first correct the circular buffer to have the first row be 0 again.
-    if (_firstRow != 0)
-    {
-        // Rotate the buffer to put the first row at the front.
-        std::rotate(_storage.begin(), _storage.begin() + _firstRow, _storage.end());
-
-        // The first row is now at the top.
-        _firstRow = 0;
-    }
+    // The positions below are all logical ones, counted from _firstRow.
+    // _RotateRows walks the circular storage directly, so only the rows in the
+    // scrolled region are touched, wherever the circular buffer starts.
+    size_t first;
+    size_t middle;
+    size_t last;
 
     // Rotate just the subsection specified
     if (delta < 0)
@@ -663,7 +796,7 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // The layout is like this:
         // delta is -2, size is 3, firstRow is 5
         // We want 3 rows from 5 (5, 6, and 7) to move up 2 spots.
-        // --- (storage) ----
+        // --- (logical rows) ----
         // | 0 begin
         // | 1
         // | 2
@@ -679,7 +812,7 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // - end
         // We want B to slide up to A (the negative delta) and everything from [B,C) to slide up with it.
         // So the final layout will be
-        // --- (storage) ----
+        // --- (logical rows) ----
         // | 0 begin
         // | 1
         // | 2
@@ -693,14 +826,16 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // | 10
         // | 11
         // - end
-        std::rotate(_storage.begin() + firstRow + delta, _storage.begin() + firstRow, _storage.begin() + firstRow + size);
+        first = firstRow + delta;
+        middle = firstRow;
+        last = firstRow + size;
     }
     else
     {
         // The layout is like this:
         // delta is 2, size is 3, firstRow is 5
         // We want 3 rows from 5 (5, 6, and 7) to move down 2 spots.
-        // --- (storage) ----
+        // --- (logical rows) ----
         // | 0 begin
         // | 1
         // | 2
@@ -716,7 +851,7 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // - end
         // We want B-1 to slide down to C-1 (the positive delta) and everything from [A, B) to slide down with it.
         // So the final layout will be
-        // --- (storage) ----
+        // --- (logical rows) ----
         // | 0 begin
         // | 1
         // | 2
@@ -730,12 +865,68 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // | 10
         // | 11
         // - end
-        std::rotate(_storage.begin() + firstRow, _storage.begin() + firstRow + size, _storage.begin() + firstRow + size + delta);
+        first = firstRow;
+        middle = firstRow + size;
+        last = firstRow + size + delta;
     }
 
-    // Renumber the IDs now that we've rearranged where the rows sit within the buffer.
-    // Refreshing should also delegate to the UnicodeStorage to re-key all the stored unicode sequences (where applicable).
-    _RefreshRowIDs(std::nullopt);
+    // The rows kept for the lines Reflow set aside can't move before they're filled in.
+    if (first < static_cast<size_t>(_deferredRowsHeight))
+    {
+        LOG_IF_FAILED(ReflowDeferredRows());
+    }
+
+    if (first == 0 && last == _storage.size())
+    {
+        // Rotating the whole buffer is just moving where the circular buffer
+        // starts. Nothing needs to move, or be renumbered.
+        _SetFirstRowIndex(gsl::narrow<SHORT>((_firstRow + middle) % _storage.size()));
+        _MarkAllRowsChanged();
+    }
+    else
+    {
+        _RotateRows(first, middle, last);
+        _MarkRowsChanged(first, last);
+    }
+}
+
+// Routine Description:
+// - Rotates the logical rows [first, last) so that the row at middle ends up at first,
+//   like std::rotate would.
+// - This swaps rows within the circular storage, in place. Only the rows in the range are
+//   touched, and only they get new IDs.
+// Arguments:
+// - first - The first logical row of the range.
+// - middle - The logical row that should end up first.
+// - last - One past the last logical row of the range.
+void TextBuffer::_RotateRows(const size_t first, const size_t middle, const size_t last)
+{
+    const size_t totalRows = _storage.size();
+    const auto slotOf = [&](const size_t logicalRow) {
+        return (_firstRow + logicalRow) % totalRows;
+    };
+    const auto reverse = [&](size_t begin, size_t end) {
+        for (; begin + 1 < end; begin++, end--)
+        {
+            std::swap(_storage.at(slotOf(begin)), _storage.at(slotOf(end - 1)));
+        }
+    };
+
+    // Rotating is reversing both halves, then reversing the whole thing.
+    reverse(first, middle);
+    reverse(middle, last);
+    reverse(first, last);
+
+    // A row's ID is its slot, so renumber the rows that moved. Moving also
+    // left their CharRows pointing at the ROW that used to be in their slot.
+    // Their glyphs moved along with them.
+    for (size_t i = first; i < last; i++)
+    {
+        const auto slot = gsl::narrow<SHORT>(slotOf(i));
+        ROW& row = _storage.at(slot);
+        row.SetId(slot);
+        row.UpdateCharRowParent();
+    }
 }
 
 Cursor& TextBuffer::GetCursor()
@@ -768,9 +959,13 @@ void TextBuffer::Reset()
 
     for (auto& row : _storage)
     {
-        row.GetCharRow().Reset();
-        row.GetAttrRow().Reset(attr);
+        THROW_HR_IF(E_FAIL, !row.Reset(attr));
     }
+    _deferredRows.clear();
+    _deferredLines.clear();
+    _deferredRowsHeight = 0;
+    _ColdRowsMoved();
+    _MarkAllRowsChanged();
 }
 
 // Routine Description:
@@ -784,6 +979,10 @@ NTSTATUS TextBuffer::ResizeTraditional(const COORD newSize) noexcept
 {
     RETURN_HR_IF(E_INVALIDARG, newSize.X < 0 || newSize.Y < 0);
 
+    // Rows are kept or dropped from the top as they are, so any that Reflow set aside
+    // have to be in them first.
+    RETURN_IF_FAILED(ReflowDeferredRows());
+
     const auto currentSize = GetSize().Dimensions();
     const auto attributes = GetCurrentAttributes();
 
@@ -797,22 +996,18 @@ NTSTATUS TextBuffer::ResizeTraditional(const COORD newSize) noexcept
     // rotate rows until the top row is at index 0
     try
     {
-        const ROW& newTopRow = _storage[TopRowIndex];
-        while (&newTopRow != &_storage.front())
-        {
-            _storage.push_back(std::move(_storage.front()));
-            _storage.pop_front();
-        }
+        std::rotate(_storage.begin(), _storage.begin() + TopRowIndex, _storage.end());
 
         _SetFirstRowIndex(0);
 
         // realloc in the Y direction
         // remove rows if we're shrinking
-        while (_storage.size() > static_cast<size_t>(newSize.Y))
+        if (_storage.size() > static_cast<size_t>(newSize.Y))
         {
-            _storage.pop_back();
+            _storage.erase(_storage.begin() + newSize.Y, _storage.end());
         }
         // add rows if we're growing
+        _storage.reserve(static_cast<size_t>(newSize.Y));
         while (_storage.size() < static_cast<size_t>(newSize.Y))
         {
             _storage.emplace_back(static_cast<short>(_storage.size()), newSize.X, attributes, this);
@@ -820,7 +1015,7 @@ NTSTATUS TextBuffer::ResizeTraditional(const COORD newSize) noexcept
 
         // Now that we've tampered with the row placement, refresh all the row IDs.
         // Also take advantage of the row ID refresh loop to resize the rows in the X dimension
-        // and cleanup the UnicodeStorage characters that might fall outside the resized buffer.
+        // which also drops the UnicodeStorage characters that fall outside the resized rows.
         _RefreshRowIDs(newSize.X);
 
     }
@@ -829,14 +1024,551 @@ NTSTATUS TextBuffer::ResizeTraditional(const COORD newSize) noexcept
     return S_OK;
 }
 
-const UnicodeStorage& TextBuffer::GetUnicodeStorage() const
+// Routine Description:
+// - Resizes the buffer, re-wrapping its lines of text to the new width.
+// - Rows that wrapped because they ran out of space are joined back into one line,
+//   which is then split again at the new width. The cells and their attribute runs are
+//   copied into the new rows a span at a time, instead of being written one character
+//   at a time like InsertCharacter would.
+// - Only the lines from firstRow down are re-wrapped. The lines above are set aside at
+//   the width they're at, and enough blank rows are kept at the top of the buffer for
+//   them. Everything else goes where it would be if they had been re-wrapped too, so
+//   nothing moves when they are, the first time one of those rows is read (see
+//   ReflowDeferredRows). Only whole lines are set aside, so none is split between the two.
+//   How many rows a line takes up is worked out from its length, which is measured once
+//   when it's set aside. That way, resizing takes as long as there are rows on the screen,
+//   plus a little arithmetic for each line of scrollback.
+// - The cursor stays on the character it was on. If it was past the end of the text,
+//   it stays as far past the end of the reflowed text.
+// - The re-wrapped rows are built next to the old ones, and anything else that can fail
+//   without touching the old rows is done before any of them are. If one of those steps
+//   fails, the buffer is left as it was. Then, like ResizeTraditional, the old rows that
+//   are no longer needed are cleared and resized in place to fill out the rest of the
+//   buffer, instead of making new ones. That can fail too, and if it does, some of the
+//   rows from the first one re-wrapped down may have been cleared or resized already.
+//   Nothing is moved out of the buffer until all of them have been. Last, moving the
+//   cursor past the end of the text can fail, and leave it short of where it should be.
+// Arguments:
+// - newSize - new size of the buffer.
+// - firstRow - the first row to re-wrap. Moved up to the start of its line, and never
+//   below the text or the cursor.
+// Return Value:
+// - S_OK if successful. E_INVALIDARG if the size is unexpected. Otherwise, the failure from building the rows.
+[[nodiscard]]
+HRESULT TextBuffer::Reflow(const COORD newSize, const SHORT firstRow) noexcept
+{
+    RETURN_HR_IF(E_INVALIDARG, newSize.X < 1 || newSize.Y < 1 || firstRow < 0);
+
+    try
+    {
+        const SHORT oldHeight = GetSize().Height();
+        const COORD oldCursorPos = GetCursor().GetPosition();
+        const COORD oldLastChar = GetLastNonSpaceCharacter();
+        const bool oldLastRowWrapped = GetRowByOffset(oldLastChar.Y).GetCharRow().WasWrapForced();
+
+        // Lines that an earlier reflow set aside stay that way, unless the rows to
+        // re-wrap reach up into the ones kept for them.
+        SHORT top = std::min({ std::max(firstRow, _deferredRowsHeight), oldLastChar.Y, oldCursorPos.Y });
+        if (top < _deferredRowsHeight)
+        {
+            THROW_IF_FAILED(ReflowDeferredRows());
+        }
+        const SHORT held = _deferredRowsHeight;
+
+        const auto continuesLine = [](const ROW& row) {
+            size_t cells = 0;
+            std::vector<size_t> leadingCells;
+            return row.MeasureLine(cells, leadingCells);
+        };
+        while (top > held && continuesLine(GetRowByOffset(top - 1)))
+        {
+            --top;
+        }
+
+        ReflowTarget target = _NewReflowTarget(newSize);
+        _ReflowRows([&](const size_t index) -> const ROW& { return GetRowByOffset(top + index); },
+                    oldLastChar.Y - top + 1,
+                    COORD{ oldCursorPos.X, oldCursorPos.Y - top },
+                    target);
+
+        // The last line only just filled its final row, and wrapped. Add the line
+        // break it had, or a later reflow to a wider size would join it with
+        // whatever gets written next.
+        if (!oldLastRowWrapped &&
+            target.pos.X == 0 &&
+            target.pos.Y > 0 &&
+            target.RowAt(target.pos.Y - 1).GetCharRow().WasWrapForced())
+        {
+            _ReflowNewline(target);
+        }
+
+        // The lines above the ones we re-wrapped are older than they are, so if those
+        // ran out of room, the rest have scrolled off the top too.
+        std::vector<DeferredLine> newLines;
+        if (!target.circled)
+        {
+            DeferredLine line{};
+            for (SHORT y = held; y < top; ++y)
+            {
+                ++line.sourceRows;
+                if (!GetRowByOffset(y).MeasureLine(line.cells, line.leadingCells))
+                {
+                    newLines.push_back(std::move(line));
+                    line = {};
+                }
+            }
+        }
+
+        // Otherwise they get whatever room is left above the re-wrapped rows. The oldest
+        // lines that don't fit at all are dropped, and the rest go as far as they fit.
+        const size_t available = target.circled ? 0 : target.height - (target.pos.Y + 1);
+        const size_t totalLines = _deferredLines.size() + newLines.size();
+        const auto lineAt = [&](const size_t index) -> const DeferredLine& {
+            return index < _deferredLines.size() ? _deferredLines.at(index) : newLines.at(index - _deferredLines.size());
+        };
+        size_t keptLines = 0;
+        size_t keptHeight = 0;
+        while (keptLines < totalLines && keptHeight < available)
+        {
+            keptHeight += lineAt(totalLines - 1 - keptLines).RowsAt(newSize.X);
+            ++keptLines;
+        }
+        const SHORT newHeld = gsl::narrow<SHORT>(std::min(keptHeight, available));
+
+        if (newHeld > 0)
+        {
+            _deferredRows.reserve(_deferredRows.size() + top - held);
+            _deferredLines.reserve(totalLines);
+        }
+
+        // The rest of the buffer is filled out with the rows kept for the lines set aside,
+        // then the ones that were below the first re-wrapped row, then new ones.
+        const auto attributes = GetCurrentAttributes();
+        const size_t fill = target.height - target.rows.size();
+        const size_t recycledHeld = std::min<size_t>(held, fill);
+        const size_t recycledBelow = std::min<size_t>(oldHeight - top, fill - recycledHeld);
+        for (size_t i = recycledHeld + recycledBelow; i < fill; ++i)
+        {
+            target.rows.emplace_back(gsl::narrow<SHORT>(target.rows.size()), newSize.X, attributes, this);
+        }
+
+        // Past here, the old rows start to change.
+        const auto recycleRow = [&](ROW& row, const bool blank) {
+            if (blank)
+            {
+                // The rows below the text, and the ones kept for the lines set aside,
+                // are already all spaces. There can be a lot of them, so don't clear
+                // them again.
+                row.GetCharRow().SetWrapForced(false);
+                row.GetCharRow().SetDoubleBytePadded(false);
+                row.GetAttrRow().Reset(attributes);
+            }
+            else
+            {
+                THROW_HR_IF(E_OUTOFMEMORY, !row.Reset(attributes));
+            }
+            THROW_IF_FAILED(row.Resize(newSize.X));
+        };
+        for (size_t y = 0; y < recycledHeld; ++y)
+        {
+            recycleRow(_storage.at((_firstRow + y) % _storage.size()), true);
+        }
+        for (size_t i = 0; i < recycledBelow; ++i)
+        {
+            const SHORT y = gsl::narrow<SHORT>(top + i);
+            recycleRow(GetRowByOffset(y), y > oldLastChar.Y);
+        }
+
+        // Nothing from here until the new rows are in place can fail, so now the rows can
+        // be moved.
+        if (newHeld == 0)
+        {
+            _deferredRows.clear();
+            _deferredLines.clear();
+        }
+        else
+        {
+            for (SHORT y = held; y < top; ++y)
+            {
+                _deferredRows.push_back(std::move(GetRowByOffset(y)));
+            }
+            std::move(newLines.begin(), newLines.end(), std::back_inserter(_deferredLines));
+
+            const auto droppedLines = _deferredLines.begin() + (totalLines - keptLines);
+            size_t droppedRows = 0;
+            for (auto it = _deferredLines.begin(); it != droppedLines; ++it)
+            {
+                droppedRows += it->sourceRows;
+            }
+            _deferredLines.erase(_deferredLines.begin(), droppedLines);
+            _deferredRows.erase(_deferredRows.begin(), _deferredRows.begin() + droppedRows);
+
+            for (auto& row : _deferredRows)
+            {
+                row.UpdateCharRowParent();
+            }
+        }
+
+        for (size_t y = 0; y < recycledHeld; ++y)
+        {
+            target.rows.push_back(std::move(_storage.at((_firstRow + y) % _storage.size())));
+        }
+        for (size_t i = 0; i < recycledBelow; ++i)
+        {
+            target.rows.push_back(std::move(GetRowByOffset(gsl::narrow<SHORT>(top + i))));
+        }
+
+        // Start the buffer that many blank rows from the bottom, so they're at the top,
+        // kept for the lines set aside.
+        _storage.swap(target.rows);
+        _SetFirstRowIndex(gsl::narrow<SHORT>((target.firstRow + target.height - newHeld) % target.height));
+        _deferredRowsHeight = newHeld;
+        _RefreshRowIDs(std::nullopt);
+
+        if (target.cursor.has_value())
+        {
+            GetCursor().SetPosition({ target.cursor->X, gsl::narrow<SHORT>(target.cursor->Y + newHeld) });
+        }
+        else
+        {
+            // The cursor was past the end of the text, so move it the same distance past
+            // the end of the reflowed text.
+            GetCursor().SetPosition({ target.pos.X, gsl::narrow<SHORT>(target.pos.Y + newHeld) });
+
+            int newlines = oldCursorPos.Y - oldLastChar.Y;
+            const int increments = oldCursorPos.X - oldLastChar.X;
+
+            // If either last row wrapped, the wrap already moved onto the next line.
+            // Everything below where we stopped re-wrapping is empty.
+            const COORD newLastChar = _GetLastNonSpaceCharacter(GetCursor().GetPosition().Y);
+            if (GetRowByOffset(newLastChar.Y).GetCharRow().WasWrapForced() || oldLastRowWrapped)
+            {
+                newlines = std::max(newlines - 1, 0);
+            }
+
+            for (int i = 0; i < newlines; ++i)
+            {
+                THROW_HR_IF(E_OUTOFMEMORY, !NewlineCursor());
+            }
+            for (int i = 0; i < increments - 1; ++i)
+            {
+                THROW_HR_IF(E_OUTOFMEMORY, !IncrementCursor());
+            }
+        }
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Returns true if Reflow set aside lines that haven't been re-wrapped yet.
+bool TextBuffer::HasDeferredRows() const noexcept
 {
-    return _unicodeStorage;
+    return _deferredRowsHeight > 0;
 }
 
-UnicodeStorage& TextBuffer::GetUnicodeStorage()
+// Routine Description:
+// - Re-wraps the lines that Reflow set aside to the current width, into the blank rows
+//   it kept for them at the top of the buffer. Nothing else moves, because Reflow already
+//   put everything else where it would be with them re-wrapped.
+// - If they take up more rows than were kept, the oldest are dropped, like they would
+//   have scrolled off the top if the whole buffer had been reflowed at once.
+// - GetRowByOffset calls this the first time one of those rows is asked for.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if successful. Otherwise, the failure from building the rows, in which case
+//   the lines are dropped, and the rows kept for them are left blank.
+[[nodiscard]]
+HRESULT TextBuffer::ReflowDeferredRows() noexcept
 {
-    return _unicodeStorage;
+    if (_deferredRowsHeight == 0)
+    {
+        return S_OK;
+    }
+
+    // Take them first, so that reading the rows here doesn't come back in.
+    std::vector<ROW> rows;
+    rows.swap(_deferredRows);
+    _deferredLines.clear();
+    const SHORT height = std::exchange(_deferredRowsHeight, 0i16);
+
+    try
+    {
+        ReflowTarget target = _NewReflowTarget({ GetSize().Width(), height });
+        _ReflowRows([&](const size_t index) -> const ROW& { return rows.at(index); },
+                    rows.size(),
+                    std::nullopt,
+                    target);
+
+        // Reflow only sets aside whole lines, so the row the target is at is part of what
+        // we re-wrapped. The rows go right above the rest of the text.
+        const SHORT count = target.pos.Y + 1;
+        for (SHORT y = 0; y < count; ++y)
+        {
+            const auto slot = gsl::narrow<SHORT>((_firstRow + height - count + y) % _storage.size());
+            ROW& row = _storage.at(slot);
+            row = std::move(target.RowAt(y));
+            row.SetId(slot);
+            row.UpdateCharRowParent();
+            NotifyRowChanged(row);
+        }
+        _ColdRowsMoved();
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Works out how many rows the line takes up when it's re-wrapped to the given width,
+//   the same way _ReflowRows would. A leading byte that would land in the last column
+//   goes on the next row, and a line that exactly fills its last row wraps onto one more.
+size_t TextBuffer::DeferredLine::RowsAt(const size_t width) const noexcept
+{
+    if (leadingCells.empty())
+    {
+        return cells / width + 1;
+    }
+
+    size_t rows = 1;
+    auto leading = leadingCells.cbegin();
+    for (size_t start = 0; cells - start >= width; ++rows)
+    {
+        const size_t last = start + width - 1;
+        leading = std::lower_bound(leading, leadingCells.cend(), last);
+        const bool padded = width > 1 && leading != leadingCells.cend() && *leading == last;
+        start += padded ? width - 1 : width;
+    }
+    return rows;
+}
+
+// Routine Description:
+// - Gets the row of a reflow target at the given offset from its top row.
+ROW& TextBuffer::ReflowTarget::RowAt(const SHORT y)
+{
+    return rows.at((firstRow + y) % rows.size());
+}
+
+// Routine Description:
+// - Starts a target for Reflow or ReflowDeferredRows to re-wrap rows into. Only the
+//   first row is made up front, the rest as they're reached.
+// Arguments:
+// - size - how wide the rows should be, and how many of them there can be.
+// Return Value:
+// - The target, with the position for the first cell at the top left.
+TextBuffer::ReflowTarget TextBuffer::_NewReflowTarget(const COORD size)
+{
+    ReflowTarget target{};
+    target.width = size.X;
+    target.height = size.Y;
+    // Reserved up front, like the constructor does, so the CharRows' parent pointers stay valid.
+    target.rows.reserve(target.height);
+    target.rows.emplace_back(0i16, target.width, GetCurrentAttributes(), this);
+    return target;
+}
+
+// Routine Description:
+// - Gives the row the target is at its attributes. Like SetAttrToEnd, the last one
+//   carries on to the end of the row.
+void TextBuffer::_ReflowFinishRow(ReflowTarget& target) const
+{
+    if (!target.runs.empty())
+    {
+        const size_t width = target.width;
+        target.runs.back().SetLength(target.runs.back().GetLength() + width - target.runsLength);
+        THROW_IF_FAILED(target.RowAt(target.pos.Y).GetAttrRow().InsertAttrRuns({ target.runs.data(), target.runs.size() }, 0, width - 1, width));
+        target.runs.clear();
+        target.runsLength = 0;
+    }
+}
+
+// Routine Description:
+// - Moves the target on to the start of the next row. When it runs out of rows, the
+//   top one is recycled, like IncrementCircularBuffer does.
+void TextBuffer::_ReflowNewline(ReflowTarget& target)
+{
+    _ReflowFinishRow(target);
+    target.pos.X = 0;
+    if (static_cast<size_t>(target.pos.Y) < target.height - 1)
+    {
+        ++target.pos.Y;
+        if (static_cast<size_t>(target.pos.Y) == target.rows.size())
+        {
+            target.rows.emplace_back(target.pos.Y, target.width, GetCurrentAttributes(), this);
+        }
+    }
+    else
+    {
+        THROW_HR_IF(E_OUTOFMEMORY, !target.rows.at(target.firstRow).Reset(GetCurrentAttributes()));
+        target.firstRow = (target.firstRow + 1) % target.rows.size();
+        target.circled = true;
+
+        // Everything moved up, so keep the cursor on its character.
+        if (target.cursor.has_value() && target.cursor->Y > 0)
+        {
+            --target.cursor->Y;
+        }
+    }
+}
+
+// Routine Description:
+// - Re-wraps rows into a reflow target, starting where it's up to.
+// - Each row can be a different width. A row that ends without wrapping ends its line,
+//   except the last one, which is left for the caller to finish.
+// Arguments:
+// - sourceRow - gets the rows to re-wrap, in order.
+// - sourceRows - how many rows there are.
+// - sourceCursor - where the cursor is, with Y as an index for sourceRow. If it's on
+//   one of the cells re-wrapped, or the end of one of the lines, the target records
+//   where it went.
+// - target - the rows to re-wrap into.
+void TextBuffer::_ReflowRows(const std::function<const ROW&(size_t)>& sourceRow,
+                             const size_t sourceRows,
+                             const std::optional<COORD> sourceCursor,
+                             ReflowTarget& target)
+{
+    const size_t newWidth = target.width;
+    const auto isCursorRow = [&](const size_t index) {
+        return sourceCursor.has_value() && static_cast<size_t>(sourceCursor->Y) == index;
+    };
+
+    for (size_t index = 0; index < sourceRows; ++index)
+    {
+        const ROW& oldRow = sourceRow(index);
+        const CharRow& oldCharRow = oldRow.GetCharRow();
+        const ATTR_ROW& oldAttrRow = oldRow.GetAttrRow();
+        const size_t oldWidth = oldRow.size();
+
+        // A row that wrapped continues all the way to its end, even if that's spaces,
+        // unless the end is padding for a double byte character that didn't fit.
+        size_t right = oldCharRow.MeasureRight();
+        if (oldCharRow.WasWrapForced())
+        {
+            right = oldWidth;
+            if (oldCharRow.WasDoubleBytePadded())
+            {
+                --right;
+            }
+        }
+
+        size_t oldX = 0;
+        while (oldX < right)
+        {
+            const size_t newX = target.pos.X;
+            size_t count = std::min(right - oldX, newWidth - newX);
+
+            // A leading byte can't go in the last column. Pad it out, and put the
+            // character on the next row instead.
+            bool padded = false;
+            if (newX + count == newWidth && newWidth > 1 && oldCharRow.DbcsAttrAt(oldX + count - 1).IsLeading())
+            {
+                --count;
+                padded = true;
+            }
+
+            if (count > 0)
+            {
+                // Like _AssertValidDoubleByteSequence, erase a leading byte that's left
+                // without its trailing byte.
+                if (newX > 0 || target.pos.Y > 0)
+                {
+                    CharRow& prevCharRow = target.RowAt(newX > 0 ? target.pos.Y : target.pos.Y - 1).GetCharRow();
+                    const size_t prevX = newX > 0 ? newX - 1 : newWidth - 1;
+                    if (prevCharRow.DbcsAttrAt(prevX).IsLeading() && !oldCharRow.DbcsAttrAt(oldX).IsTrailing())
+                    {
+                        prevCharRow.ClearCell(prevX);
+                    }
+                }
+
+                target.RowAt(target.pos.Y).GetCharRow().CopyCells(oldCharRow, oldX, newX, count);
+
+                for (size_t x = oldX; x < oldX + count;)
+                {
+                    size_t applies = 0;
+                    const auto attr = oldAttrRow.GetAttrByColumn(x, &applies);
+                    const auto length = std::min(applies, oldX + count - x);
+                    if (!target.runs.empty() && target.runs.back().GetAttributes() == attr)
+                    {
+                        target.runs.back().SetLength(target.runs.back().GetLength() + length);
+                    }
+                    else
+                    {
+                        target.runs.emplace_back(length, attr);
+                    }
+                    target.runsLength += length;
+                    x += length;
+                }
+
+                if (isCursorRow(index) && static_cast<size_t>(sourceCursor->X) >= oldX && static_cast<size_t>(sourceCursor->X) < oldX + count)
+                {
+                    target.cursor = COORD{ gsl::narrow<SHORT>(newX + sourceCursor->X - oldX), target.pos.Y };
+                }
+
+                target.pos.X = gsl::narrow<SHORT>(newX + count);
+                oldX += count;
+            }
+
+            if (padded)
+            {
+                target.RowAt(target.pos.Y).GetCharRow().SetDoubleBytePadded(true);
+            }
+
+            // Like IncrementCursor, running off the end of the row wraps.
+            if (padded || static_cast<size_t>(target.pos.X) == newWidth)
+            {
+                target.RowAt(target.pos.Y).GetCharRow().SetWrapForced(true);
+                _ReflowNewline(target);
+            }
+        }
+
+        // A row that ended early without wrapping is the end of a line.
+        if (right < oldWidth && !oldCharRow.WasWrapForced())
+        {
+            if (isCursorRow(index) && static_cast<size_t>(sourceCursor->X) == right)
+            {
+                target.cursor = target.pos;
+            }
+
+            if (index < sourceRows - 1)
+            {
+                _ReflowNewline(target);
+            }
+        }
+    }
+    _ReflowFinishRow(target);
+}
+
+TextAttributeTable& TextBuffer::GetAttributeTable() noexcept
+{
+    return _attributeTable;
+}
+
+// Routine Description:
+// - Tells the attribute table which ids are still used by the rows, so it can reuse the rest.
+// - Called by the table when it runs out of ids.
+// Arguments:
+// - table - The attribute table. Always our own.
+void TextBuffer::_CollectAttributes(TextAttributeTable& table) const
+{
+    std::vector<bool> inUse(table.Size());
+    for (const auto& row : _storage)
+    {
+        row.MarkIdsInUse(inUse);
+    }
+    for (const auto& row : _deferredRows)
+    {
+        row.MarkIdsInUse(inUse);
+    }
+
+    // Rows that are being built (by Reflow) or reset are filled with these,
+    // before they're ever part of the storage.
+    if (const auto id = table.Find(_currentAttributes))
+    {
+        inUse.at(id.value()) = true;
+    }
+    table.Collect(inUse);
 }
 
 // Routine Description:
@@ -845,23 +1577,19 @@ UnicodeStorage& TextBuffer::GetUnicodeStorage()
 // - This will also update parent pointers that are stored in depth within the buffer
 //   (e.g. it will update CharRow parents pointing at Rows that might have been moved around)
 // - Optionally takes a new row width if we're resizing to perform a resize operation and cleanup
-//   any high unicode (UnicodeStorage) runs while we're already looping through the rows.
+//   any high unicode (UnicodeStorage) runs past the new width while we're already looping through the rows.
 // Arguments:
 // - newRowWidth - Optional new value for the row width.
 void TextBuffer::_RefreshRowIDs(std::optional<SHORT> newRowWidth)
 {
-    std::map<SHORT, SHORT> rowMap;
     SHORT i = 0;
     for (auto& it : _storage)
     {
-        // Build a map so we can update Unicode Storage
-        rowMap.emplace(it.GetId(), i);
-
         // Update the IDs
         it.SetId(i++);
 
         // Also update the char row parent pointers as they can get shuffled up in the rotates.
-        it.GetCharRow().UpdateParent(&it);
+        it.UpdateCharRowParent();
 
         // Resize the rows in the X dimension if we have a new width
         if (newRowWidth.has_value())
@@ -871,8 +1599,174 @@ void TextBuffer::_RefreshRowIDs(std::optional<SHORT> newRowWidth)
         }
     }
 
-    // Give the new mapping to Unicode Storage
-    _unicodeStorage.Remap(rowMap, newRowWidth);
+    _ColdRowsMoved();
+    _MarkAllRowsChanged();
+}
+
+// Routine Description:
+// - Freezes the rows that are far enough above the cursor that they're unlikely to change
+//   again, to save memory. See FrozenRow. Called whenever the cursor moves to a new line.
+// - Each newline makes one more row cold, and the row above it was frozen by the last one,
+//   so this usually freezes one row. Freezing stops at the first row that's already frozen,
+//   unless the rows have been rearranged since.
+// - Rows that were thawed to be read stay thawed, in case they're read again (they might be
+//   on the screen), until there are enough of them to be worth freezing again.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>, throws exceptions on failures.
+void TextBuffer::_FreezeColdRows()
+{
+    const int lastColdRow = GetCursor().GetPosition().Y - _coldRowDistance;
+    if (lastColdRow < 0)
+    {
+        return;
+    }
+
+    if (_thawedRows.size() > MaxThawedRows)
+    {
+        const int height = TotalRowCount();
+        for (const auto id : _thawedRows)
+        {
+            // The IDs are only hints, so check that they're still cold.
+            if (id < height && (id - _firstRow + height) % height <= lastColdRow)
+            {
+                _storage.at(id).Freeze(_spill.get());
+            }
+        }
+        _thawedRows.clear();
+    }
+
+    // The rows kept for the lines Reflow set aside are blank until they're filled in.
+    for (int y = lastColdRow; y >= _deferredRowsHeight; --y)
+    {
+        ROW& row = GetRowByOffset(y);
+        if (row.IsFrozen() && !_rescanColdRows)
+        {
+            break;
+        }
+        row.Freeze(_spill.get());
+    }
+    _rescanColdRows = false;
+}
+
+// Routine Description:
+// - Counts the logical rows [first, last) as changed. See GetRowsChangedSince.
+void TextBuffer::_MarkRowsChanged(const size_t first, const size_t last) noexcept
+{
+    for (auto y = first; y < last; ++y)
+    {
+        NotifyRowChanged(_storage[(_firstRow + y) % _storage.size()]);
+    }
+}
+
+// Routine Description:
+// - Counts every row as changed, after they've all moved or been replaced. See
+//   GetRowsChangedSince.
+void TextBuffer::_MarkAllRowsChanged() noexcept
+{
+    _allRowsChangedGeneration = ++_generation;
+    // Anything that asks about an older generation gets every row anyway.
+    _changedRows.clear();
+}
+
+// Routine Description:
+// - Checks whether an entry in _changedRows is the last time its row changed,
+//   rather than one left behind by a later change, or by a row that has been
+//   replaced since.
+bool TextBuffer::_IsLatestChange(const std::pair<uint64_t, SHORT>& change) const noexcept
+{
+    const auto id = gsl::narrow_cast<size_t>(change.second);
+    return id < _storage.size() && _storage[id].GetGeneration() == change.first;
+}
+
+// Routine Description:
+// - Forgets which rows were thawed, and has the next _FreezeColdRows look at every cold
+//   row, after the rows have been rearranged or replaced.
+void TextBuffer::_ColdRowsMoved() noexcept
+{
+    _thawedRows.clear();
+    _rescanColdRows = true;
+}
+
+// Routine Description:
+// - Has rows that are frozen from now on kept in a temporary file, instead of on the heap.
+//   See ScrollbackSpill.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK, or the error from creating the file.
+[[nodiscard]]
+HRESULT TextBuffer::EnableScrollbackSpill() noexcept
+{
+    try
+    {
+        if (!_spill)
+        {
+            _spill = ScrollbackSpill::CreateTemporary();
+        }
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Called by a ROW when it thaws, so that it can be frozen again later.
+// Arguments:
+// - id - the ID of the row
+void TextBuffer::NotifyRowThawed(const SHORT id) noexcept
+{
+    try
+    {
+        _thawedRows.push_back(id);
+    }
+    CATCH_LOG();
+}
+
+// Routine Description:
+// - Counts a row as changed. See GetRowsChangedSince. Called by a ROW when it's
+//   written to, and by anything that changes a row's CharRow or ATTR_ROW directly.
+// Arguments:
+// - row - the row that changed
+void TextBuffer::NotifyRowChanged(ROW& row) noexcept
+{
+    const auto generation = ++_generation;
+    row.SetGeneration(generation);
+
+    // Rows that a reflow is building aren't in the buffer yet. Every row counts as
+    // changed once they're moved in.
+    const auto id = row.GetId();
+    if (gsl::narrow_cast<size_t>(id) >= _storage.size() || &_storage[id] != &row)
+    {
+        return;
+    }
+
+    try
+    {
+        if (!_changedRows.empty() && _changedRows.back().second == id)
+        {
+            // The same row again, like when a line is written a bit at a time.
+            _changedRows.back().first = generation;
+        }
+        else
+        {
+            if (_changedRows.size() >= _storage.size() * 2)
+            {
+                _changedRows.erase(std::remove_if(_changedRows.begin(),
+                                                  _changedRows.end(),
+                                                  [&](const auto& change) { return !_IsLatestChange(change); }),
+                                   _changedRows.end());
+            }
+            _changedRows.emplace_back(generation, id);
+        }
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        // Without a record of this row, the only safe answer is that they all changed.
+        _MarkAllRowsChanged();
+    }
 }
 
 void TextBuffer::_NotifyPaint(const Viewport& viewport) const
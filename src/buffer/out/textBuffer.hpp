@@ -52,7 +52,6 @@ filling in the last row, and updating the screen.
 #include "cursor.h"
 #include "Row.hpp"
 #include "TextAttribute.hpp"
-#include "UnicodeStorage.hpp"
 #include "../types/inc/Viewport.hpp"
 
 #include "../buffer/out/textBufferCellIterator.hpp"
@@ -117,6 +116,10 @@ public:
 
     UINT TotalRowCount() const;
 
+    uint64_t GetGeneration() const noexcept;
+    std::vector<SHORT> GetRowsChangedSince(const uint64_t generation) const;
+    std::vector<SHORT> GetRowsChangedSince(const uint64_t generation, const SHORT top, const SHORT bottom) const;
+
     [[nodiscard]]
     TextAttribute GetCurrentAttributes() const noexcept;
 
@@ -127,8 +130,21 @@ public:
     [[nodiscard]]
     HRESULT ResizeTraditional(const COORD newSize) noexcept;
 
-    const UnicodeStorage& GetUnicodeStorage() const;
-    UnicodeStorage& GetUnicodeStorage();
+    [[nodiscard]]
+    HRESULT Reflow(const COORD newSize, const SHORT firstRow = 0) noexcept;
+
+    bool HasDeferredRows() const noexcept;
+
+    [[nodiscard]]
+    HRESULT ReflowDeferredRows() noexcept;
+
+    TextAttributeTable& GetAttributeTable() noexcept;
+
+    void NotifyRowThawed(const SHORT id) noexcept;
+    void NotifyRowChanged(ROW& row) noexcept;
+
+    [[nodiscard]]
+    HRESULT EnableScrollbackSpill() noexcept;
 
     Microsoft::Console::Render::IRenderTarget& GetRenderTarget();
 
@@ -148,23 +164,98 @@ public:
 
 private:
 
-    std::deque<ROW> _storage;
+    // The attributes used by the rows. Declared before the rows, so it outlives them.
+    TextAttributeTable _attributeTable;
+
+    // Where frozen rows are kept, if not on the heap. Declared before the rows, so it outlives them.
+    std::unique_ptr<ScrollbackSpill> _spill;
+
+    // The rows, stored circularly. A row's ID is the index of its slot in here.
+    std::vector<ROW> _storage;
     Cursor _cursor;
 
     SHORT _firstRow; // indexes top row (not necessarily 0)
 
     TextAttribute _currentAttributes;
 
-    // storage location for glyphs that can't fit into the buffer normally
-    UnicodeStorage _unicodeStorage;
+    // A line of text that Reflow set aside, measured so that it can tell how many rows
+    //      the line takes up at any width without looking at its rows again.
+    struct DeferredLine
+    {
+        size_t sourceRows; // how many of the set-aside rows it's in
+        size_t cells; // how long it is
+        std::vector<size_t> leadingCells; // which of its cells are leading bytes
+
+        size_t RowsAt(const size_t width) const noexcept;
+    };
+
+    // Rows that Reflow hasn't re-wrapped yet, oldest first, and the lines in them. Each
+    //      row is still as wide as it was when it was set aside.
+    std::vector<ROW> _deferredRows;
+    std::vector<DeferredLine> _deferredLines;
+    // How many blank rows at the top of the buffer are being kept for them. The rows
+    //      below are already where they'd be if everything had been re-wrapped.
+    SHORT _deferredRowsHeight;
+
+    // Rows at least this far above the cursor are frozen. See FrozenRow.
+    static constexpr SHORT DefaultColdRowDistance = 1000;
+    // Rows that were thawed by reading them are frozen again once there are more than this many.
+    static constexpr size_t MaxThawedRows = 256;
+
+    SHORT _coldRowDistance;
+    // The IDs of rows that have been thawed since they were frozen. They may have moved since.
+    std::vector<SHORT> _thawedRows;
+    // Set when the rows have been rearranged, so cold rows may be anywhere.
+    bool _rescanColdRows;
+
+    // Goes up whenever rows change. Each row remembers the generation it last changed in.
+    uint64_t _generation;
+    // The generation when every row last changed at once, like when the buffer circled.
+    uint64_t _allRowsChangedGeneration;
+    // The generations rows changed in since then, oldest first, and the IDs of the rows.
+    //      A row that changed again has its older entries left behind, until there are
+    //      enough of them to be worth clearing out.
+    std::vector<std::pair<uint64_t, SHORT>> _changedRows;
+
+    // The rows a reflow is building, and where it's up to in them.
+    struct ReflowTarget
+    {
+        SHORT width;
+        size_t height; // how many rows there can be
+        std::vector<ROW> rows;
+        size_t firstRow; // indexes top row, like _firstRow
+        COORD pos; // where the next cell goes, like the cursor for InsertCharacter
+        std::optional<COORD> cursor; // where the cursor went, once it's found
+        bool circled; // whether the top row has been recycled
+        std::vector<TextAttributeRun> runs; // the attributes of the cells in the row at pos
+        size_t runsLength;
+
+        ROW& RowAt(const SHORT y);
+    };
+
+    ReflowTarget _NewReflowTarget(const COORD size);
+    void _ReflowRows(const std::function<const ROW&(size_t)>& sourceRow,
+                     const size_t sourceRows,
+                     const std::optional<COORD> sourceCursor,
+                     ReflowTarget& target);
+    void _ReflowNewline(ReflowTarget& target);
+    void _ReflowFinishRow(ReflowTarget& target) const;
 
     void _RefreshRowIDs(std::optional<SHORT> newRowWidth);
+    void _RotateRows(const size_t first, const size_t middle, const size_t last);
+    void _CollectAttributes(TextAttributeTable& table) const;
+    void _FreezeColdRows();
+    void _ColdRowsMoved() noexcept;
+    void _MarkRowsChanged(const size_t first, const size_t last) noexcept;
+    void _MarkAllRowsChanged() noexcept;
+    bool _IsLatestChange(const std::pair<uint64_t, SHORT>& change) const noexcept;
 
     Microsoft::Console::Render::IRenderTarget& _renderTarget;
 
     void _SetFirstRowIndex(const SHORT FirstRowIndex);
 
     COORD _GetPreviousFromCursor() const;
+    COORD _GetLastNonSpaceCharacter(const SHORT lastRow) const;
 
     void _SetWrapOnCurrentRow();
     void _AdjustWrapOnCurrentRow(const bool fSet);
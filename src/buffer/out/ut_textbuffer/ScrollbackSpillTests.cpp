@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+#include "../../inc/consoletaeftemplates.hpp"
+
+#include "../ScrollbackSpill.hpp"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class ScrollbackSpillTests
+{
+    TEST_CLASS(ScrollbackSpillTests);
+
+    static std::vector<BYTE> MakeRecord(const size_t length, const BYTE seed)
+    {
+        std::vector<BYTE> record(length);
+        for (size_t i = 0; i < length; ++i)
+        {
+            record.at(i) = static_cast<BYTE>(seed + i);
+        }
+        return record;
+    }
+
+    static bool RecordEquals(const std::basic_string_view<BYTE> actual, const std::vector<BYTE>& expected)
+    {
+        return std::equal(actual.cbegin(), actual.cend(), expected.cbegin(), expected.cend());
+    }
+
+    TEST_METHOD(CanAppendAndRead)
+    {
+        const auto spill = ScrollbackSpill::CreateTemporary();
+
+        const auto first = MakeRecord(10, 1);
+        const auto second = MakeRecord(300, 2);
+        const auto firstId = spill->Append({ first.data(), first.size() });
+        const auto secondId = spill->Append({ second.data(), second.size() });
+        VERIFY_ARE_NOT_EQUAL(firstId, secondId);
+
+        VERIFY_IS_TRUE(RecordEquals(spill->Read(firstId), first));
+        VERIFY_IS_TRUE(RecordEquals(spill->Read(secondId), second));
+
+        Log::Comment(L"Records should be padded out to the alignment.");
+        VERIFY_ARE_EQUAL(16u + 304u, spill->Size());
+        VERIFY_ARE_EQUAL(ScrollbackSpill::MinGrowth, spill->Capacity());
+    }
+
+    TEST_METHOD(ErasedIdsAreReused)
+    {
+        const auto spill = ScrollbackSpill::CreateTemporary();
+
+        const auto record = MakeRecord(8, 0);
+        const auto firstId = spill->Append({ record.data(), record.size() });
+        const auto secondId = spill->Append({ record.data(), record.size() });
+
+        spill->Erase(firstId);
+        VERIFY_ARE_EQUAL(8u, spill->Size());
+        VERIFY_THROWS_SPECIFIC(spill->Read(firstId), wil::ResultException, [](wil::ResultException& e) { return e.GetErrorCode() == E_INVALIDARG; });
+
+        Log::Comment(L"Erasing it again shouldn't do anything.");
+        spill->Erase(firstId);
+        VERIFY_ARE_EQUAL(8u, spill->Size());
+
+        VERIFY_ARE_EQUAL(firstId, spill->Append({ record.data(), record.size() }));
+        VERIFY_IS_TRUE(RecordEquals(spill->Read(secondId), record));
+    }
+
+    TEST_METHOD(CompactsInsteadOfGrowing)
+    {
+        const auto spill = ScrollbackSpill::CreateTemporary();
+
+        const size_t length = 1000;
+        std::vector<ScrollbackSpill::id_type> ids;
+        while (spill->Size() + length <= ScrollbackSpill::MinGrowth)
+        {
+            const auto record = MakeRecord(length, static_cast<BYTE>(ids.size()));
+            ids.push_back(spill->Append({ record.data(), record.size() }));
+        }
+        VERIFY_ARE_EQUAL(ScrollbackSpill::MinGrowth, spill->Capacity());
+
+        Log::Comment(L"Erase most of the records, so the next one that doesn't fit moves the rest down.");
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            if (i % 3 != 0)
+            {
+                spill->Erase(ids.at(i));
+            }
+        }
+
+        const auto record = MakeRecord(length, 0);
+        const auto lastId = spill->Append({ record.data(), record.size() });
+        VERIFY_ARE_EQUAL(ScrollbackSpill::MinGrowth, spill->Capacity());
+        VERIFY_ARE_EQUAL(0u, spill->_garbage);
+
+        for (size_t i = 0; i < ids.size(); i += 3)
+        {
+            VERIFY_IS_TRUE(RecordEquals(spill->Read(ids.at(i)), MakeRecord(length, static_cast<BYTE>(i))));
+        }
+        VERIFY_IS_TRUE(RecordEquals(spill->Read(lastId), record));
+    }
+};
@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+#include "../../inc/consoletaeftemplates.hpp"
+
+#include "../TextAttributeTable.hpp"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class TextAttributeTableTests
+{
+    TEST_CLASS(TextAttributeTableTests);
+
+    TEST_METHOD(InternReturnsSameIdForEqualAttributes)
+    {
+        TextAttributeTable table;
+
+        const TextAttribute red{ FOREGROUND_RED };
+        const TextAttribute rgb{ RGB(1, 2, 3), RGB(4, 5, 6) };
+
+        const auto redId = table.Intern(red);
+        const auto rgbId = table.Intern(rgb);
+        VERIFY_ARE_NOT_EQUAL(redId, rgbId);
+
+        VERIFY_ARE_EQUAL(redId, table.Intern(TextAttribute{ FOREGROUND_RED }));
+        VERIFY_ARE_EQUAL(rgbId, table.Intern(TextAttribute{ RGB(1, 2, 3), RGB(4, 5, 6) }));
+        VERIFY_ARE_EQUAL(2u, table.Size());
+
+        VERIFY_ARE_EQUAL(red, table.Get(redId));
+        VERIFY_ARE_EQUAL(rgb, table.Get(rgbId));
+
+        VERIFY_ARE_EQUAL(redId, table.Find(red).value());
+        VERIFY_IS_FALSE(table.Find(TextAttribute{ FOREGROUND_BLUE }).has_value());
+    }
+
+    TEST_METHOD(CollectReusesUnusedIds)
+    {
+        TextAttributeTable table;
+
+        const TextAttribute first{ FOREGROUND_RED };
+        const TextAttribute second{ FOREGROUND_GREEN };
+        const TextAttribute third{ FOREGROUND_BLUE };
+
+        const auto firstId = table.Intern(first);
+        const auto secondId = table.Intern(second);
+
+        Log::Comment(L"Only the first attribute is still in use.");
+        std::vector<bool> inUse(table.Size());
+        inUse.at(firstId) = true;
+        table.Collect(inUse);
+        VERIFY_ARE_EQUAL(1u, table.Generation());
+
+        VERIFY_IS_FALSE(table.Find(second).has_value());
+        VERIFY_ARE_EQUAL(firstId, table.Find(first).value());
+
+        Log::Comment(L"The next new attribute gets the freed id, without the table growing.");
+        VERIFY_ARE_EQUAL(secondId, table.Intern(third));
+        VERIFY_ARE_EQUAL(third, table.Get(secondId));
+        VERIFY_ARE_EQUAL(2u, table.Size());
+    }
+
+    TEST_METHOD(FullTableCallsCollect)
+    {
+        TextAttributeTable table;
+
+        // Pretend that only the first attribute is stored anywhere.
+        size_t cCollects = 0;
+        table.SetCollectCallback([&](TextAttributeTable& t) {
+            cCollects++;
+            std::vector<bool> inUse(t.Size());
+            inUse.at(0) = true;
+            t.Collect(inUse);
+        });
+
+        for (size_t i = 0; i < TextAttributeTable::MaxSize; i++)
+        {
+            table.Intern(TextAttribute{ static_cast<COLORREF>(i), 0 });
+        }
+        VERIFY_ARE_EQUAL(0u, cCollects);
+        VERIFY_ARE_EQUAL(TextAttributeTable::MaxSize, table.Size());
+
+        const TextAttribute overflow{ RGB(255, 255, 255), RGB(255, 255, 255) };
+        const auto id = table.Intern(overflow);
+        VERIFY_ARE_EQUAL(1u, cCollects);
+        VERIFY_ARE_EQUAL(1u, id);
+        VERIFY_ARE_EQUAL(overflow, table.Get(id));
+        VERIFY_ARE_EQUAL(0u, table.Find(TextAttribute{ static_cast<COLORREF>(0), 0 }).value());
+    }
+
+    TEST_METHOD(FullTableOfUsedIdsThrows)
+    {
+        TextAttributeTable table;
+        table.SetCollectCallback([](TextAttributeTable& t) {
+            t.Collect(std::vector<bool>(t.Size(), true));
+        });
+
+        for (size_t i = 0; i < TextAttributeTable::MaxSize; i++)
+        {
+            table.Intern(TextAttribute{ static_cast<COLORREF>(i), 0 });
+        }
+
+        VERIFY_THROWS_SPECIFIC(table.Intern(TextAttribute{ RGB(255, 255, 255), RGB(255, 255, 255) }),
+                               wil::ResultException,
+                               [](wil::ResultException& e) { return e.GetErrorCode() == E_OUTOFMEMORY; });
+    }
+};
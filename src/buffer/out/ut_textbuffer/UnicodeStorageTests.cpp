@@ -19,34 +19,97 @@ class UnicodeStorageTests
     TEST_METHOD(CanOverwriteEmoji)
     {
         UnicodeStorage storage;
-        const COORD coord{ 1, 3 };
-        const std::vector<wchar_t> newMoon{ 0xD83C, 0xDF11 };
-        const std::vector<wchar_t> fullMoon{ 0xD83C, 0xDF15 };
+        const size_t column = 1;
+        const std::wstring newMoon{ 0xD83C, 0xDF11 };
+        const std::wstring fullMoon{ 0xD83C, 0xDF15 };
 
         // store initial glyph
-        storage.StoreGlyph(coord, newMoon);
+        storage.StoreGlyph(column, newMoon);
 
         // verify it was stored
-        auto findIt = storage._map.find(coord);
-        VERIFY_ARE_NOT_EQUAL(findIt, storage._map.end());
-        const std::vector<wchar_t>& newMoonGlyph = findIt->second;
-        VERIFY_ARE_EQUAL(newMoonGlyph.size(), newMoon.size());
-        for (size_t i = 0; i < newMoon.size(); ++i)
-        {
-            VERIFY_ARE_EQUAL(newMoonGlyph.at(i), newMoon.at(i));
-        }
+        VERIFY_ARE_EQUAL(1u, storage.Size());
+        VERIFY_ARE_EQUAL(newMoon, std::wstring{ storage.GetText(column) });
 
         // overwrite it
-        storage.StoreGlyph(coord, fullMoon);
+        storage.StoreGlyph(column, fullMoon);
 
         // verify the glyph was overwritten
-        findIt = storage._map.find(coord);
-        VERIFY_ARE_NOT_EQUAL(findIt, storage._map.end());
-        const std::vector<wchar_t>& fullMoonGlyph = findIt->second;
-        VERIFY_ARE_EQUAL(fullMoonGlyph.size(), fullMoon.size());
-        for (size_t i = 0; i < fullMoon.size(); ++i)
+        VERIFY_ARE_EQUAL(1u, storage.Size());
+        VERIFY_ARE_EQUAL(fullMoon, std::wstring{ storage.GetText(column) });
+    }
+
+    TEST_METHOD(CanEraseGlyph)
+    {
+        UnicodeStorage storage;
+        const std::wstring newMoon{ 0xD83C, 0xDF11 };
+
+        storage.StoreGlyph(3, newMoon);
+        storage.StoreGlyph(5, newMoon);
+
+        storage.Erase(3);
+        VERIFY_ARE_EQUAL(1u, storage.Size());
+        VERIFY_THROWS_SPECIFIC(storage.GetText(3), wil::ResultException, [](wil::ResultException& e) { return e.GetErrorCode() == E_INVALIDARG; });
+        VERIFY_ARE_EQUAL(newMoon, std::wstring{ storage.GetText(5) });
+
+        // Erasing something that isn't there does nothing.
+        storage.Erase(3);
+        VERIFY_ARE_EQUAL(1u, storage.Size());
+
+        storage.Erase(5);
+        VERIFY_IS_TRUE(storage.Empty());
+        VERIFY_IS_TRUE(storage._pool.empty(), L"The pool should be released along with the last glyph.");
+    }
+
+    TEST_METHOD(KeepsGlyphsPastInlineEntries)
+    {
+        UnicodeStorage storage;
+        const size_t count = UnicodeStorage::InlineEntries * 4;
+
+        // Store them backwards so every one has to go in front of the others.
+        for (size_t column = count; column > 0; --column)
+        {
+            storage.StoreGlyph(column, std::wstring(column + 1, static_cast<wchar_t>(L'a' + column)));
+        }
+
+        VERIFY_ARE_EQUAL(count, storage.Size());
+        for (size_t column = 1; column <= count; ++column)
         {
-            VERIFY_ARE_EQUAL(fullMoonGlyph.at(i), fullMoon.at(i));
+            VERIFY_ARE_EQUAL(std::wstring(column + 1, static_cast<wchar_t>(L'a' + column)), std::wstring{ storage.GetText(column) });
         }
     }
+
+    TEST_METHOD(ResizeDropsGlyphsPastWidth)
+    {
+        UnicodeStorage storage;
+        const std::wstring newMoon{ 0xD83C, 0xDF11 };
+
+        for (size_t column = 0; column < 10; column += 2)
+        {
+            storage.StoreGlyph(column, newMoon);
+        }
+
+        storage.Resize(5);
+
+        VERIFY_ARE_EQUAL(3u, storage.Size());
+        VERIFY_ARE_EQUAL(newMoon, std::wstring{ storage.GetText(4) });
+        VERIFY_THROWS_SPECIFIC(storage.GetText(6), wil::ResultException, [](wil::ResultException& e) { return e.GetErrorCode() == E_INVALIDARG; });
+    }
+
+    TEST_METHOD(OverwritingReclaimsPoolSpace)
+    {
+        UnicodeStorage storage;
+        const std::wstring family{ 0xD83D, 0xDC68, 0x200D, 0xD83D, 0xDC69, 0x200D, 0xD83D, 0xDC67 };
+        const std::wstring newMoon{ 0xD83C, 0xDF11 };
+
+        storage.StoreGlyph(0, newMoon);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            storage.StoreGlyph(1, newMoon);
+            storage.StoreGlyph(1, family);
+        }
+
+        VERIFY_ARE_EQUAL(newMoon, std::wstring{ storage.GetText(0) });
+        VERIFY_ARE_EQUAL(family, std::wstring{ storage.GetText(1) });
+        VERIFY_IS_LESS_THAN_OR_EQUAL(storage._pool.size(), (newMoon.size() + family.size()) * 2);
+    }
 };
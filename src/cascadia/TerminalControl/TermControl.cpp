@@ -849,7 +849,9 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         const auto dpi = (int)(scale * USER_DEFAULT_SCREEN_DPI);
 
         // TODO: MSFT: 21169071 - Shouldn't this all happen through _renderer and trigger the invalidate automatically on DPI change?
-        THROW_IF_FAILED(_renderEngine->UpdateDpi(dpi));
+        _renderer->UpdateEngine([&]() {
+            THROW_IF_FAILED(_renderEngine->UpdateDpi(dpi));
+        });
         _renderer->TriggerRedrawAll();
     }
 
@@ -864,8 +866,12 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         size.cx = static_cast<long>(newWidth);
         size.cy = static_cast<long>(newHeight);
 
-        // Tell the dx engine that our window is now the new size.
-        THROW_IF_FAILED(_renderEngine->SetWindowSize(size));
+        // Tell the dx engine that our window is now the new size. The frame
+        //      in progress is painted without the terminal locked, so this has
+        //      to wait for it to finish.
+        _renderer->UpdateEngine([&]() {
+            THROW_IF_FAILED(_renderEngine->SetWindowSize(size));
+        });
 
         // Invalidate everything
         _renderer->TriggerRedrawAll();
@@ -300,6 +300,11 @@ Viewport Terminal::_GetVisibleViewport() const noexcept
 //      in accordance with the written text.
 // This method is our proverbial `WriteCharsLegacy`, and great care should be made to
 //      keep it minimal and orderly, lest it become WriteCharsLegacy2ElectricBoogaloo
+// Printable runs are handed to the buffer a row at a time, and the cursor,
+//      viewport and scroll notification are only updated once for the whole string.
+// Scrolling is reported to the renderer as a scroll, rather than as a redraw
+//      of everything, so that the engines can move what they already drew
+//      and only repaint the rows that were uncovered.
 // TODO: MSFT 21006766
 //       This needs to become stream logic on the buffer itself sooner rather than later
 //       because it's otherwise impossible to avoid the Electric Boogaloo-ness here.
@@ -308,25 +313,58 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
 {
     auto& cursor = _buffer->GetCursor();
     const Viewport bufferSize = _buffer->GetSize();
+    const TextAttribute attributes = _buffer->GetCurrentAttributes();
+
+    COORD proposedCursorPosition = cursor.GetPosition();
+    bool notifyScroll = false;
+
+    // The number of rows the buffer has circled by that the renderer hasn't heard about yet.
+    //      Consecutive circles are reported as a single scroll, but they have to be
+    //      reported before we write anything else, because anything written after
+    //      them is already in the scrolled coordinates.
+    SHORT circledRows = 0;
+    const auto notifyCircledRows = [&]() {
+        if (circledRows > 0)
+        {
+            const COORD delta{ 0, -circledRows };
+            _buffer->GetRenderTarget().TriggerScroll(&delta);
+            circledRows = 0;
+        }
+    };
+
+    // If we're about to go past the bottom of the buffer, instead cycle the buffer.
+    const auto cycleBufferIfNeeded = [&]() {
+        const auto newRows = proposedCursorPosition.Y - bufferSize.Height() + 1;
+        if (newRows > 0)
+        {
+            for (auto dy = 0; dy < newRows; dy++)
+            {
+                _buffer->IncrementCircularBuffer();
+                proposedCursorPosition.Y--;
+            }
+            circledRows += gsl::narrow<SHORT>(newRows);
+            notifyScroll = true;
+        }
+    };
 
-    for (size_t i = 0; i < stringView.size(); i++)
+    size_t i = 0;
+    while (i < stringView.size())
     {
-        wchar_t wch = stringView[i];
-        const COORD cursorPosBefore = cursor.GetPosition();
-        COORD proposedCursorPosition = cursorPosBefore;
-        bool notifyScroll = false;
+        const wchar_t wch = stringView[i];
 
         if (wch == UNICODE_LINEFEED)
         {
             proposedCursorPosition.Y++;
+            i++;
         }
         else if (wch == UNICODE_CARRIAGERETURN)
         {
             proposedCursorPosition.X = 0;
+            i++;
         }
         else if (wch == UNICODE_BACKSPACE)
         {
-            if (cursorPosBefore.X == 0)
+            if (proposedCursorPosition.X == 0)
             {
                 proposedCursorPosition.X = bufferSize.Width() - 1;
                 proposedCursorPosition.Y--;
@@ -335,63 +373,93 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
             {
                 proposedCursorPosition.X--;
             }
+            i++;
         }
         else
         {
-            // TODO: MSFT 21006766
-            // This is not great but I need it demoable. Fix by making a buffer stream writer.
-            if (wch >= 0xD800 && wch <= 0xDFFF)
+            // Everything up to the next cursor control character is one printable run.
+            size_t runEnd = i + 1;
+            while (runEnd < stringView.size() && !_IsCursorControl(stringView[runEnd]))
             {
-                OutputCellIterator it{ stringView.substr(i, 2) , _buffer->GetCurrentAttributes() };
-                const auto end = _buffer->Write(it);
-                const auto cellDistance = end.GetCellDistance(it);
-                i += cellDistance - 1;
-                proposedCursorPosition.X += gsl::narrow<SHORT>(cellDistance);
+                runEnd++;
             }
-            else
+
+            OutputCellIterator it{ stringView.substr(i, runEnd - i), attributes };
+            while (it)
             {
-                OutputCellIterator it{ stringView.substr(i, 1) , _buffer->GetCurrentAttributes() };
-                const auto end = _buffer->Write(it);
+                // The previous write filled the rest of the row, so wrap before
+                //      we write any more.
+                if (proposedCursorPosition.X >= bufferSize.Width())
+                {
+                    proposedCursorPosition.X = 0;
+                    proposedCursorPosition.Y++;
+                }
+                cycleBufferIfNeeded();
+                notifyCircledRows();
+
+                const auto end = _buffer->WriteLine(it, proposedCursorPosition, true);
                 const auto cellDistance = end.GetCellDistance(it);
+
+                // A wide glyph that doesn't fit in the last column is moved to
+                //      the next row. If it doesn't even fit on an empty row,
+                //      there's nowhere to put it.
+                if (!cellDistance && proposedCursorPosition.X == 0)
+                {
+                    break;
+                }
+
                 proposedCursorPosition.X += gsl::narrow<SHORT>(cellDistance);
+                if (end)
+                {
+                    proposedCursorPosition.X = bufferSize.Width();
+                }
+                it = end;
             }
-        }
 
-        // If we're about to scroll past the bottom of the buffer, instead cycle the buffer.
-        const auto newRows = proposedCursorPosition.Y - bufferSize.Height() + 1;
-        if (newRows > 0)
-        {
-            for(auto dy = 0; dy < newRows; dy++)
-            {
-                _buffer->IncrementCircularBuffer();
-                proposedCursorPosition.Y--;
-            }
-            notifyScroll = true;
+            i = runEnd;
         }
 
-        // This section is essentially equivalent to `AdjustCursorPosition`
-        // Update Cursor Position
-        cursor.SetPosition(proposedCursorPosition);
+        cycleBufferIfNeeded();
+    }
+
+    notifyCircledRows();
 
-        const COORD cursorPosAfter = cursor.GetPosition();
+    // This section is essentially equivalent to `AdjustCursorPosition`
+    // Update Cursor Position
+    cursor.SetPosition(proposedCursorPosition);
 
-        // Move the viewport down if the cursor moved below the viewport.
-        if (cursorPosAfter.Y > _mutableViewport.BottomInclusive())
-        {
-            const auto newViewTop = std::max(0, cursorPosAfter.Y - (_mutableViewport.Height() - 1));
-            if (newViewTop != _mutableViewport.Top())
-            {
-                _mutableViewport = Viewport::FromDimensions({0, gsl::narrow<short>(newViewTop)}, _mutableViewport.Dimensions());
-                notifyScroll = true;
-            }
-        }
+    const COORD cursorPosAfter = cursor.GetPosition();
 
-        if (notifyScroll)
+    // Move the viewport down if the cursor moved below the viewport.
+    if (cursorPosAfter.Y > _mutableViewport.BottomInclusive())
+    {
+        const auto newViewTop = std::max(0, cursorPosAfter.Y - (_mutableViewport.Height() - 1));
+        if (newViewTop != _mutableViewport.Top())
         {
-            _buffer->GetRenderTarget().TriggerRedrawAll();
-            _NotifyScrollEvent();
+            _mutableViewport = Viewport::FromDimensions({0, gsl::narrow<short>(newViewTop)}, _mutableViewport.Dimensions());
+
+            // The renderer works out how far the viewport moved by itself.
+            _buffer->GetRenderTarget().TriggerScroll();
+            notifyScroll = true;
         }
     }
+
+    if (notifyScroll)
+    {
+        _NotifyScrollEvent();
+    }
+}
+
+// Routine Description:
+// - Determines if a character moves the cursor in _WriteBuffer instead of being
+//      written to the buffer.
+// Arguments:
+// - wch - Character to check.
+// Return Value:
+// - True if it is a line feed, carriage return or backspace. False otherwise.
+bool Terminal::_IsCursorControl(const wchar_t wch) noexcept
+{
+    return wch == UNICODE_LINEFEED || wch == UNICODE_CARRIAGERETURN || wch == UNICODE_BACKSPACE;
 }
 
 void Terminal::UserScrollViewport(const int viewTop)
@@ -180,6 +180,7 @@ public:
     void _InitializeColorTable();
 
     void _WriteBuffer(const std::wstring_view& stringView);
+    static bool _IsCursorControl(const wchar_t wch) noexcept;
 
     void _NotifyScrollEvent();
 
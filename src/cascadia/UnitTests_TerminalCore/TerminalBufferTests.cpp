@@ -0,0 +1,164 @@
+/*
+* Copyright (c) Microsoft Corporation.
+* Licensed under the MIT license.
+*
+* Class Name: TerminalBufferTests
+*/
+#include "precomp.h"
+#include <WexTestClass.h>
+
+#include "../cascadia/TerminalCore/Terminal.hpp"
+#include "../renderer/inc/DummyRenderTarget.hpp"
+#include "consoletaeftemplates.hpp"
+
+#include <chrono>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+using namespace Microsoft::Terminal::Core;
+using namespace Microsoft::Console::Render;
+
+namespace TerminalCoreUnitTests
+{
+    // Records the scrolls and full redraws the terminal asks the renderer for.
+    class ScrollRecordingRenderTarget final : public Microsoft::Console::Render::IRenderTarget
+    {
+    public:
+        void TriggerRedraw(const Microsoft::Console::Types::Viewport& /*region*/) override {}
+        void TriggerRedraw(const COORD* const /*pcoord*/) override {}
+        void TriggerRedrawCursor(const COORD* const /*pcoord*/) override {}
+        void TriggerRedrawAll() override { redrawAllCount++; }
+        void TriggerTeardown() override {}
+        void TriggerSelection() override {}
+        void TriggerScroll() override { viewportScrollCount++; }
+        void TriggerScroll(const COORD* const pcoordDelta) override { scrollDeltas.push_back(*pcoordDelta); }
+        void TriggerCircling() override {}
+        void TriggerTitleChange() override {}
+
+        size_t redrawAllCount = 0;
+        size_t viewportScrollCount = 0;
+        std::vector<COORD> scrollDeltas;
+    };
+
+    class TerminalBufferTests
+    {
+        TEST_CLASS(TerminalBufferTests);
+
+        static std::wstring _RowText(Terminal& term, const size_t row, const size_t cch)
+        {
+            return term.GetTextBuffer().GetRowByOffset(row).GetText().substr(0, cch);
+        }
+
+        TEST_METHOD(PrintRunWrapsAtEndOfRow)
+        {
+            Terminal term = Terminal();
+            DummyRenderTarget emptyRT;
+            term.Create({ 10, 5 }, 0, emptyRT);
+
+            term.Write(L"abcdefghijKLM");
+
+            VERIFY_ARE_EQUAL(L"abcdefghij", _RowText(term, 0, 10));
+            VERIFY_ARE_EQUAL(L"KLM       ", _RowText(term, 1, 10));
+            VERIFY_ARE_EQUAL((COORD{ 3, 1 }), term.GetCursorPosition());
+        }
+
+        TEST_METHOD(PrintRunFillingRowDefersWrap)
+        {
+            Terminal term = Terminal();
+            DummyRenderTarget emptyRT;
+            term.Create({ 10, 5 }, 0, emptyRT);
+
+            // Filling the row exactly doesn't move to the next row until there's more to print,
+            //      so a newline right after doesn't leave an empty row behind.
+            term.Write(L"abcdefghij\r\nk");
+
+            VERIFY_ARE_EQUAL(L"abcdefghij", _RowText(term, 0, 10));
+            VERIFY_ARE_EQUAL(L"k         ", _RowText(term, 1, 10));
+            VERIFY_ARE_EQUAL((COORD{ 1, 1 }), term.GetCursorPosition());
+        }
+
+        TEST_METHOD(PrintRunPastBottomCirclesBuffer)
+        {
+            Terminal term = Terminal();
+            DummyRenderTarget emptyRT;
+            term.Create({ 4, 3 }, 0, emptyRT);
+
+            // Wrapping off the bottom of the buffer has to cycle it, just like a newline does.
+            term.Write(L"1\r\n2\r\n3333444455");
+
+            VERIFY_ARE_EQUAL(L"3333", _RowText(term, 0, 4));
+            VERIFY_ARE_EQUAL(L"4444", _RowText(term, 1, 4));
+            VERIFY_ARE_EQUAL(L"55  ", _RowText(term, 2, 4));
+            VERIFY_ARE_EQUAL((COORD{ 2, 2 }), term.GetCursorPosition());
+        }
+
+        TEST_METHOD(ViewportMovesAsOneScroll)
+        {
+            Terminal term = Terminal();
+            ScrollRecordingRenderTarget recordingRT;
+            term.Create({ 10, 3 }, 10, recordingRT);
+
+            term.Write(L"1\r\n2\r\n3\r\n4\r\n5");
+
+            // The viewport moved down two rows. The renderer finds out how far by
+            //      itself, so the terminal just has to tell it once.
+            VERIFY_ARE_EQUAL(1u, recordingRT.viewportScrollCount);
+            VERIFY_ARE_EQUAL(0u, recordingRT.redrawAllCount);
+            VERIFY_ARE_EQUAL(0u, recordingRT.scrollDeltas.size());
+            VERIFY_ARE_EQUAL(2, term.GetViewport().Top());
+        }
+
+        TEST_METHOD(CirclingIsCoalescedIntoScrolls)
+        {
+            Terminal term = Terminal();
+            ScrollRecordingRenderTarget recordingRT;
+            term.Create({ 10, 3 }, 0, recordingRT);
+
+            // Fill the buffer, so every new line from here on circles it.
+            term.Write(L"1\r\n2\r\n3");
+            VERIFY_ARE_EQUAL(0u, recordingRT.scrollDeltas.size());
+
+            // Consecutive line feeds in one batch are reported as one scroll...
+            term.PrintString(L"\n\n\n");
+            VERIFY_ARE_EQUAL(1u, recordingRT.scrollDeltas.size());
+            VERIFY_ARE_EQUAL((COORD{ 0, -3 }), recordingRT.scrollDeltas.at(0));
+
+            // ...but text in between splits them, because it was written after the first scroll.
+            term.PrintString(L"\r\nA\r\nB");
+            VERIFY_ARE_EQUAL(3u, recordingRT.scrollDeltas.size());
+            VERIFY_ARE_EQUAL((COORD{ 0, -1 }), recordingRT.scrollDeltas.at(1));
+            VERIFY_ARE_EQUAL((COORD{ 0, -1 }), recordingRT.scrollDeltas.at(2));
+
+            VERIFY_ARE_EQUAL(0u, recordingRT.redrawAllCount);
+            VERIFY_ARE_EQUAL(L"A", _RowText(term, 1, 1));
+            VERIFY_ARE_EQUAL(L"B", _RowText(term, 2, 1));
+        }
+
+        TEST_METHOD(WriteLargeLog)
+        {
+            BEGIN_TEST_METHOD_PROPERTIES()
+                TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+            END_TEST_METHOD_PROPERTIES()
+
+            Terminal term = Terminal();
+            DummyRenderTarget emptyRT;
+            term.Create({ 120, 30 }, 9001, emptyRT);
+
+            std::wstring log;
+            for (size_t i = 0; i < 100000; i++)
+            {
+                log += L"[2019-05-06 12:34:56.789] INFO  Microsoft.Terminal.Core: wrote a line of a very large build log to the terminal\r\n";
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            term.Write(log);
+            const auto delta = std::chrono::steady_clock::now() - start;
+
+            Log::Comment(NoThrowString().Format(L"Writing %zu characters took %lld ms",
+                                                log.size(),
+                                                std::chrono::duration_cast<std::chrono::milliseconds>(delta).count()));
+        }
+    };
+}
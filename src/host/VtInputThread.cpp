@@ -27,7 +27,6 @@ VtInputThread::VtInputThread(_In_ wil::unique_hfile hPipe,
                              const bool inheritCursor) :
     _hFile{ std::move(hPipe) },
     _hThread{},
-    _utf8Parser{ CP_UTF8 },
     _dwThreadId{ 0 },
     _exitRequested{ false },
     _exitResult{ S_OK }
@@ -48,8 +47,8 @@ VtInputThread::VtInputThread(_In_ wil::unique_hfile hPipe,
 
 // Method Description:
 // - Processes a buffer of input characters. The characters should be utf-8
-//      encoded, and will get converted to wchar_t's to be processed by the
-//      input state machine.
+//      encoded, and are handed straight to the input state machine, which
+//      decodes them as it goes.
 // Arguments:
 // - charBuffer - the UTF-8 characters recieved.
 // - cch - number of UTF-8 characters in charBuffer
@@ -68,16 +67,9 @@ HRESULT VtInputThread::_HandleRunInput(_In_reads_(cch) const byte* const charBuf
 
     try
     {
-        std::unique_ptr<wchar_t[]> pwsSequence;
-        unsigned int cchConsumed;
-        unsigned int cchSequence;
-        auto hr = _utf8Parser.Parse(charBuffer, cch, cchConsumed, pwsSequence, cchSequence);
-        // If we hit a parsing error, eat it. It's bad utf-8, we can't do anything with it.
-        if (FAILED(hr))
-        {
-            return S_FALSE;
-        }
-        _pInputStateMachine->ProcessString(pwsSequence.get(), cchSequence);
+        // Invalid utf-8 is dropped, like Utf8ToWideCharParser did, rather than
+        //      becoming U+FFFD keypresses.
+        _pInputStateMachine->ProcessUtf8({ reinterpret_cast<const char*>(charBuffer), gsl::narrow<size_t>(cch) }, true);
     }
     CATCH_RETURN();
 
@@ -15,7 +15,6 @@ Author(s):
 #pragma once
 
 #include "..\terminal\parser\StateMachine.hpp"
-#include "utf8ToWideCharParser.hpp"
 
 namespace Microsoft::Console
 {
@@ -42,6 +41,5 @@ namespace Microsoft::Console
         HRESULT _exitResult;
 
         std::unique_ptr<StateMachine> _pInputStateMachine;
-        Utf8ToWideCharParser _utf8Parser;
     };
 }
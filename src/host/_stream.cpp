@@ -683,7 +683,9 @@ NTSTATUS WriteCharsLegacy(SCREEN_INFORMATION& screenInfo,
 
                         // since you just backspaced yourself back up into the previous row, unset the wrap
                         // flag on the prev row if it was set
-                        textBuffer.GetRowByOffset(CursorPosition.Y).GetCharRow().SetWrapForced(false);
+                        ROW& row = textBuffer.GetRowByOffset(CursorPosition.Y);
+                        row.GetCharRow().SetWrapForced(false);
+                        textBuffer.NotifyRowChanged(row);
                     }
                 }
                 else if (IS_CONTROL_CHAR(LastChar))
@@ -754,7 +756,9 @@ NTSTATUS WriteCharsLegacy(SCREEN_INFORMATION& screenInfo,
 
                     // since you just backspaced yourself back up into the previous row, unset the wrap flag
                     // on the prev row if it was set
-                    textBuffer.GetRowByOffset(CursorPosition.Y).GetCharRow().SetWrapForced(false);
+                    ROW& row = textBuffer.GetRowByOffset(CursorPosition.Y);
+                    row.GetCharRow().SetWrapForced(false);
+                    textBuffer.NotifyRowChanged(row);
 
                     Status = AdjustCursorPosition(screenInfo, CursorPosition, dwFlags & WC_KEEP_CURSOR_VISIBLE, psScrollY);
                 }
@@ -791,7 +795,9 @@ NTSTATUS WriteCharsLegacy(SCREEN_INFORMATION& screenInfo,
                     CursorPosition.Y = cursor.GetPosition().Y + 1;
 
                     // since you just tabbed yourself past the end of the row, set the wrap
-                    textBuffer.GetRowByOffset(cursor.GetPosition().Y).GetCharRow().SetWrapForced(true);
+                    ROW& row = textBuffer.GetRowByOffset(cursor.GetPosition().Y);
+                    row.GetCharRow().SetWrapForced(true);
+                    textBuffer.NotifyRowChanged(row);
                 }
                 else
                 {
@@ -842,7 +848,9 @@ NTSTATUS WriteCharsLegacy(SCREEN_INFORMATION& screenInfo,
 
             {
                 // since we explicitly just moved down a row, clear the wrap status on the row we just came from
-                textBuffer.GetRowByOffset(cursor.GetPosition().Y).GetCharRow().SetWrapForced(false);
+                ROW& row = textBuffer.GetRowByOffset(cursor.GetPosition().Y);
+                row.GetCharRow().SetWrapForced(false);
+                textBuffer.NotifyRowChanged(row);
             }
 
             Status = AdjustCursorPosition(screenInfo, CursorPosition, (dwFlags & WC_KEEP_CURSOR_VISIBLE) != 0, psScrollY);
@@ -891,6 +899,7 @@ NTSTATUS WriteCharsLegacy(SCREEN_INFORMATION& screenInfo,
                 // Additionally, this padding is only called for IsConsoleFullWidth (a.k.a. when a character
                 // is too wide to fit on the current line).
                 charRow.SetDoubleBytePadded(true);
+                textBuffer.NotifyRowChanged(Row);
 
                 Status = AdjustCursorPosition(screenInfo, CursorPosition, dwFlags & WC_KEEP_CURSOR_VISIBLE, psScrollY);
                 continue;
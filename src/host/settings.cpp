@@ -55,7 +55,8 @@ Settings::Settings() :
     _DefaultForeground(INVALID_COLOR),
     _DefaultBackground(INVALID_COLOR),
     _fUseDx(false),
-    _fCopyColor(false)
+    _fCopyColor(false),
+    _fSpillScrollback(false)
 {
     _dwScreenBufferSize.X = 80;
     _dwScreenBufferSize.Y = 25;
@@ -946,3 +947,11 @@ bool Settings::GetCopyColor() const noexcept
 {
     return _fCopyColor;
 }
+
+// Routine Description:
+// - Determines whether rows far up in the scrollback should be kept in a temporary file
+//   instead of in memory. See ScrollbackSpill.
+bool Settings::GetSpillScrollback() const noexcept
+{
+    return _fSpillScrollback;
+}
@@ -14,6 +14,8 @@
 
 #include "..\interactivity\inc\ServiceLocator.hpp"
 
+#include <chrono>
+
 using namespace Microsoft::Console::Types;
 using namespace WEX::Logging;
 using namespace WEX::TestExecution;
@@ -471,6 +473,43 @@ class ApiRoutinesTests
         }
     }
 
+    TEST_METHOD(ApiWriteConsoleWPerf)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+        END_TEST_METHOD_PROPERTIES();
+
+        CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        SCREEN_INFORMATION& si = gci.GetActiveOutputBuffer();
+
+        gci.LockConsole();
+        auto Unlock = wil::scope_exit([&] { gci.UnlockConsole(); });
+
+        // A megabyte of printable ASCII, in lines that fit in the buffer.
+        std::wstring testText;
+        while (testText.size() < 1024 * 1024)
+        {
+            for (wchar_t wch = L' '; wch < L' ' + 70; ++wch)
+            {
+                testText.push_back(wch);
+            }
+            testText.append(L"\r\n");
+        }
+
+        size_t cchRead = 0;
+        std::unique_ptr<IWaitRoutine> waiter;
+        const auto start = std::chrono::steady_clock::now();
+        const HRESULT hr = _pApiRoutines->WriteConsoleWImpl(si, testText, cchRead, waiter);
+        const auto delta = std::chrono::steady_clock::now() - start;
+
+        VERIFY_ARE_EQUAL(S_OK, hr, L"Successful result code from writing.");
+        VERIFY_ARE_EQUAL(testText.size(), cchRead, L"We should have written all of the text.");
+
+        Log::Comment(WEX::Common::NoThrowString().Format(L"Writing %zu characters took %lld us",
+                                                         testText.size(),
+                                                         std::chrono::duration_cast<std::chrono::microseconds>(delta).count()));
+    }
+
     void ValidateScreen(SCREEN_INFORMATION& si,
                         const CHAR_INFO background,
                         const CHAR_INFO fill,
@@ -12,6 +12,8 @@
 
 #include "input.h"
 
+#include <chrono>
+
 using namespace WEX::Common;
 using namespace WEX::Logging;
 using namespace WEX::TestExecution;
@@ -62,6 +64,7 @@ namespace WEX {
 
 class AttrRowTests
 {
+    TextAttributeTable _table;
     ATTR_ROW* pSingle;
     ATTR_ROW* pChain;
 
@@ -81,7 +84,7 @@ class AttrRowTests
 
     TEST_METHOD_SETUP(MethodSetup)
     {
-        pSingle = new ATTR_ROW(_sDefaultLength, _DefaultAttr);
+        pSingle = new ATTR_ROW(_sDefaultLength, _DefaultAttr, _table);
 
         // Segment length is the expected length divided by the row length
         // E.g. row of 80, 4 segments, 20 segment length each
@@ -101,13 +104,13 @@ class AttrRowTests
         }
 
         // Create the chain
-        pChain = new ATTR_ROW(_sDefaultLength, _DefaultAttr);
-        pChain->_list.resize(sChainSegmentsNeeded);
+        pChain = new ATTR_ROW(_sDefaultLength, _DefaultAttr, _table);
+        std::vector<TextAttributeRun> chain(sChainSegmentsNeeded);
 
         // Attach all chain segments that are even multiples of the row length
         for (short iChain = 0; iChain < _sDefaultChainLength; iChain++)
         {
-            TextAttributeRun* pRun = &pChain->_list[iChain];
+            TextAttributeRun* pRun = &chain[iChain];
 
             pRun->SetAttributesFromLegacy(iChain); // Just use the chain position as the value
             pRun->SetLength(sChainSegLength);
@@ -117,12 +120,14 @@ class AttrRowTests
         {
             // If we had a leftover, then this chain is one longer than we expected (the default length)
             // So use it as the index (because indicies start at 0)
-            TextAttributeRun* pRun = &pChain->_list[_sDefaultChainLength];
+            TextAttributeRun* pRun = &chain[_sDefaultChainLength];
 
             pRun->SetAttributes(_DefaultChainAttr);
             pRun->SetLength(sChainLeftover);
         }
 
+        _SetRuns(*pChain, chain);
+
         return true;
     }
 
@@ -150,9 +155,10 @@ class AttrRowTests
 
             pUnderTest->Reset(attr);
 
-            VERIFY_ARE_EQUAL(pUnderTest->_list.size(), 1u);
-            VERIFY_ARE_EQUAL(pUnderTest->_list[0].GetAttributes(), attr);
-            VERIFY_ARE_EQUAL(pUnderTest->_list[0].GetLength(), (unsigned int)_sDefaultLength);
+            const auto runs = _GetRuns(*pUnderTest);
+            VERIFY_ARE_EQUAL(runs.size(), 1u);
+            VERIFY_ARE_EQUAL(runs[0].GetAttributes(), attr);
+            VERIFY_ARE_EQUAL(runs[0].GetLength(), (unsigned int)_sDefaultLength);
         }
     }
 
@@ -234,6 +240,30 @@ class AttrRowTests
         return NoThrowString().Format(L"%wc%d", run.GetAttributes().GetLegacyAttributes(), run.GetLength());
     }
 
+    // Routine Description:
+    // - Gets the runs stored in the row, with the ids looked up.
+    static std::vector<TextAttributeRun> _GetRuns(const ATTR_ROW& row)
+    {
+        std::vector<TextAttributeRun> runs;
+        for (const auto& run : row._list)
+        {
+            runs.emplace_back(run.length, row._pTable->Get(run.id));
+        }
+        return runs;
+    }
+
+    // Routine Description:
+    // - Replaces the runs stored in the row, without any of the merging InsertAttrRuns would do.
+    static void _SetRuns(ATTR_ROW& row, const std::vector<TextAttributeRun>& runs)
+    {
+        row._list.clear();
+        for (const auto& run : runs)
+        {
+            row._list.push_back({ row._pTable->Intern(run.GetAttributes()), gsl::narrow<uint16_t>(run.GetLength()) });
+        }
+        row._UpdateDenseIndex();
+    }
+
     void LogChain(_In_ PCWSTR pwszPrefix,
                   std::vector<TextAttributeRun>& chain)
     {
@@ -265,16 +295,17 @@ class AttrRowTests
 
         // Set up our "original row" that we are going to try to insert into.
         // This will represent a 10 column run of R3->B5->G2 that we will use for all tests.
-        ATTR_ROW originalRow{ static_cast<UINT>(_sDefaultLength), _DefaultAttr };
-        originalRow._list.resize(3);
+        ATTR_ROW originalRow{ static_cast<UINT>(_sDefaultLength), _DefaultAttr, _table };
+        std::vector<TextAttributeRun> originalRuns(3);
         originalRow._cchRowWidth = 10;
-        originalRow._list[0].SetAttributesFromLegacy('R');
-        originalRow._list[0].SetLength(3);
-        originalRow._list[1].SetAttributesFromLegacy('B');
-        originalRow._list[1].SetLength(5);
-        originalRow._list[2].SetAttributesFromLegacy('G');
-        originalRow._list[2].SetLength(2);
-        LogChain(L"Original: ", originalRow._list);
+        originalRuns[0].SetAttributesFromLegacy('R');
+        originalRuns[0].SetLength(3);
+        originalRuns[1].SetAttributesFromLegacy('B');
+        originalRuns[1].SetLength(5);
+        originalRuns[2].SetAttributesFromLegacy('G');
+        originalRuns[2].SetLength(2);
+        _SetRuns(originalRow, originalRuns);
+        LogChain(L"Original: ", originalRuns);
 
         // Set up our "insertion run"
         size_t cInsertRow = 1;
@@ -347,17 +378,18 @@ class AttrRowTests
         VERIFY_SUCCEEDED(originalRow.InsertAttrRuns({ insertRow.data(), insertRow.size() }, uiStartPos, uiEndPos, (UINT)originalRow._cchRowWidth));
 
         // Compare and ensure that the expected and actual match.
-        VERIFY_ARE_EQUAL(cPackedRun, originalRow._list.size(), L"Ensure that number of array elements required for RLE are the same.");
+        auto actualRuns = _GetRuns(originalRow);
+        VERIFY_ARE_EQUAL(cPackedRun, actualRuns.size(), L"Ensure that number of array elements required for RLE are the same.");
 
         std::vector<TextAttributeRun> packedRunExpected;
         std::copy_n(packedRun.get(), cPackedRun, std::back_inserter(packedRunExpected));
 
         LogChain(L"Expected: ", packedRunExpected);
-        LogChain(L"Actual: ", originalRow._list);
+        LogChain(L"Actual: ", actualRuns);
 
         for (size_t testIndex = 0; testIndex < cPackedRun; testIndex++)
         {
-            VERIFY_ARE_EQUAL(packedRun[testIndex], originalRow._list[testIndex]);
+            VERIFY_ARE_EQUAL(packedRun[testIndex], actualRuns[testIndex]);
         }
     }
 
@@ -512,35 +544,37 @@ class AttrRowTests
         pSingle->SetAttrToEnd(iTestIndex, TestAttr);
 
         // Was 1 (single), should now have 2 segments
-        VERIFY_ARE_EQUAL(pSingle->_list.size(), 2u);
+        const auto singleRuns = _GetRuns(*pSingle);
+        VERIFY_ARE_EQUAL(singleRuns.size(), 2u);
 
-        VERIFY_ARE_EQUAL(pSingle->_list[0].GetAttributes(), _DefaultAttr);
-        VERIFY_ARE_EQUAL(pSingle->_list[0].GetLength(), (unsigned int)(_sDefaultLength - (_sDefaultLength - iTestIndex)));
+        VERIFY_ARE_EQUAL(singleRuns[0].GetAttributes(), _DefaultAttr);
+        VERIFY_ARE_EQUAL(singleRuns[0].GetLength(), (unsigned int)(_sDefaultLength - (_sDefaultLength - iTestIndex)));
 
-        VERIFY_ARE_EQUAL(pSingle->_list[1].GetAttributes(), TestAttr);
-        VERIFY_ARE_EQUAL(pSingle->_list[1].GetLength(), (unsigned int)(_sDefaultLength - iTestIndex));
+        VERIFY_ARE_EQUAL(singleRuns[1].GetAttributes(), TestAttr);
+        VERIFY_ARE_EQUAL(singleRuns[1].GetLength(), (unsigned int)(_sDefaultLength - iTestIndex));
 
         Log::Comment(L"SetAttrToEnd for existing chain of multiple colors.");
         pChain->SetAttrToEnd(iTestIndex, TestAttr);
 
         // From 7 segments down to 5.
-        VERIFY_ARE_EQUAL(pChain->_list.size(), 5u);
+        const auto chainRuns = _GetRuns(*pChain);
+        VERIFY_ARE_EQUAL(chainRuns.size(), 5u);
 
         // Verify chain colors and lengths
-        VERIFY_ARE_EQUAL(TextAttribute(0), pChain->_list[0].GetAttributes());
-        VERIFY_ARE_EQUAL(pChain->_list[0].GetLength(), (unsigned int)13);
+        VERIFY_ARE_EQUAL(TextAttribute(0), chainRuns[0].GetAttributes());
+        VERIFY_ARE_EQUAL(chainRuns[0].GetLength(), (unsigned int)13);
 
-        VERIFY_ARE_EQUAL(TextAttribute(1), pChain->_list[1].GetAttributes());
-        VERIFY_ARE_EQUAL(pChain->_list[1].GetLength(), (unsigned int)13);
+        VERIFY_ARE_EQUAL(TextAttribute(1), chainRuns[1].GetAttributes());
+        VERIFY_ARE_EQUAL(chainRuns[1].GetLength(), (unsigned int)13);
 
-        VERIFY_ARE_EQUAL(TextAttribute(2), pChain->_list[2].GetAttributes());
-        VERIFY_ARE_EQUAL(pChain->_list[2].GetLength(), (unsigned int)13);
+        VERIFY_ARE_EQUAL(TextAttribute(2), chainRuns[2].GetAttributes());
+        VERIFY_ARE_EQUAL(chainRuns[2].GetLength(), (unsigned int)13);
 
-        VERIFY_ARE_EQUAL(TextAttribute(3), pChain->_list[3].GetAttributes());
-        VERIFY_ARE_EQUAL(pChain->_list[3].GetLength(), (unsigned int)11);
+        VERIFY_ARE_EQUAL(TextAttribute(3), chainRuns[3].GetAttributes());
+        VERIFY_ARE_EQUAL(chainRuns[3].GetLength(), (unsigned int)11);
 
-        VERIFY_ARE_EQUAL(TestAttr, pChain->_list[4].GetAttributes());
-        VERIFY_ARE_EQUAL(pChain->_list[4].GetLength(), (unsigned int)30);
+        VERIFY_ARE_EQUAL(TestAttr, chainRuns[4].GetAttributes());
+        VERIFY_ARE_EQUAL(chainRuns[4].GetLength(), (unsigned int)30);
 
         Log::Comment(L"SECOND: Set index to 0 to test replacing anything with a single");
 
@@ -553,13 +587,14 @@ class AttrRowTests
             pUnderTest->SetAttrToEnd(0, TestAttr);
 
             // should be down to 1 attribute set from beginning to end of string
-            VERIFY_ARE_EQUAL(pUnderTest->_list.size(), 1u);
+            const auto runs = _GetRuns(*pUnderTest);
+            VERIFY_ARE_EQUAL(runs.size(), 1u);
 
             // singular pair should contain the color
-            VERIFY_ARE_EQUAL(pUnderTest->_list[0].GetAttributes(), TestAttr);
+            VERIFY_ARE_EQUAL(runs[0].GetAttributes(), TestAttr);
 
             // and its length should be the length of the whole string
-            VERIFY_ARE_EQUAL(pUnderTest->_list[0].GetLength(), (unsigned int)_sDefaultLength);
+            VERIFY_ARE_EQUAL(runs[0].GetLength(), (unsigned int)_sDefaultLength);
         }
     }
 
@@ -604,4 +639,100 @@ class AttrRowTests
         state.CleanupGlobalScreenBuffer();
         state.CleanupGlobalFont();
     }
+
+    TEST_METHOD(TestDenseIndex)
+    {
+        Log::Comment(L"Give every other cell its own color, so the row has enough runs to be indexed.");
+        for (short iColumn = 1; iColumn < _sDefaultLength; iColumn += 2)
+        {
+            const TextAttributeRun run{ 1, TextAttribute{ RGB(iColumn, 0, 0), RGB(0, 0, iColumn) } };
+            VERIFY_SUCCEEDED(pSingle->InsertAttrRuns({ &run, 1 }, iColumn, iColumn, _sDefaultLength));
+        }
+        VERIFY_ARE_EQUAL(static_cast<size_t>(_sDefaultLength), pSingle->GetNumberOfRuns());
+        VERIFY_ARE_EQUAL(static_cast<size_t>(_sDefaultLength), pSingle->_cellRuns.size());
+
+        for (short iColumn = 0; iColumn < _sDefaultLength; iColumn++)
+        {
+            const auto expected = (iColumn % 2) ? TextAttribute{ RGB(iColumn, 0, 0), RGB(0, 0, iColumn) } : _DefaultAttr;
+            size_t applies = 0;
+            VERIFY_ARE_EQUAL(expected, pSingle->GetAttrByColumn(iColumn, &applies));
+            VERIFY_ARE_EQUAL(1u, applies);
+        }
+
+        Log::Comment(L"Putting the row back to one color drops the index.");
+        VERIFY_IS_TRUE(pSingle->SetAttrToEnd(0, _DefaultAttr));
+        VERIFY_ARE_EQUAL(1u, pSingle->GetNumberOfRuns());
+        VERIFY_ARE_EQUAL(0u, pSingle->_cellRuns.size());
+
+        size_t applies = 0;
+        VERIFY_ARE_EQUAL(_DefaultAttr, pSingle->GetAttrByColumn(5, &applies));
+        VERIFY_ARE_EQUAL(static_cast<size_t>(_sDefaultLength - 5), applies);
+    }
+
+    TEST_METHOD(TestCompilerOutputCost)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+        END_TEST_METHOD_PROPERTIES()
+
+        // 10k lines of scrollback that look like colored compiler output:
+        //      src\foo\bar.cpp(123,45): error C2065: 'baz': undeclared identifier
+        // with the path, the error and the identifier in their own colors.
+        const UINT cchRowWidth = 120;
+        const size_t cRows = 10000;
+        const TextAttribute plain{ FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE };
+        const TextAttribute path{ FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY };
+        const TextAttribute error{ RGB(255, 64, 64), RGB(12, 12, 12) };
+        const TextAttribute identifier{ RGB(255, 255, 128), RGB(12, 12, 12) };
+        const TextAttributeRun line[] = {
+            { 20, path },
+            { 3, plain },
+            { 13, error },
+            { 2, plain },
+            { 5, identifier },
+            { cchRowWidth - 43, plain },
+        };
+
+        TextAttributeTable table;
+        std::vector<ATTR_ROW> rows;
+        rows.reserve(cRows);
+        for (size_t i = 0; i < cRows; i++)
+        {
+            rows.emplace_back(cchRowWidth, plain, table);
+            VERIFY_SUCCEEDED(rows.back().InsertAttrRuns({ line, ARRAYSIZE(line) }, 0, cchRowWidth - 1, cchRowWidth));
+        }
+
+        size_t cbRuns = 0;
+        size_t cbRunsUninterned = 0;
+        for (const auto& row : rows)
+        {
+            cbRuns += row._list.capacity() * sizeof(row._list[0]) +
+                      row._cellRuns.capacity() * sizeof(row._cellRuns[0]) +
+                      row._runEnds.capacity() * sizeof(row._runEnds[0]);
+            cbRunsUninterned += row.GetNumberOfRuns() * sizeof(TextAttributeRun);
+        }
+        const size_t cbTable = table.Size() * (sizeof(TextAttribute) + sizeof(TextAttributeTable::id_type));
+
+        Log::Comment(NoThrowString().Format(L"%zu rows of %zu runs: %zu bytes of runs, %zu bytes of table (%zu bytes as TextAttributeRuns)",
+                                            cRows,
+                                            ARRAYSIZE(line),
+                                            cbRuns,
+                                            cbTable,
+                                            cbRunsUninterned));
+
+        size_t cBold = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& row : rows)
+        {
+            for (size_t iColumn = 0; iColumn < cchRowWidth; iColumn++)
+            {
+                cBold += row.GetAttrByColumn(iColumn).IsBold() ? 1 : 0;
+            }
+        }
+        const auto delta = std::chrono::steady_clock::now() - start;
+
+        Log::Comment(NoThrowString().Format(L"Looking up every column took %lld us (%zu)",
+                                            std::chrono::duration_cast<std::chrono::microseconds>(delta).count(),
+                                            cBold));
+    }
 };
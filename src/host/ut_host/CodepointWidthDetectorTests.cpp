@@ -8,6 +8,9 @@
 
 #include "../types/inc/CodepointWidthDetector.hpp"
 
+#include <chrono>
+#include <thread>
+
 using namespace WEX::Logging;
 
 static const std::wstring emoji = L"\xD83E\xDD22"; // U+1F922 nauseated face
@@ -20,13 +23,17 @@ static const std::vector<std::tuple<unsigned int, std::wstring, CodepointWidth>>
     { 0x7, L"\a", CodepointWidth::Narrow }, // BEL
     { 0x20, L" ", CodepointWidth::Narrow },
     { 0x39, L"9", CodepointWidth::Narrow },
+    { 0xA0, L"\xA0", CodepointWidth::Narrow }, // U+00A0 no-break space
+    { 0xA1, L"\xA1", CodepointWidth::Ambiguous }, // U+00A1 inverted exclamation mark
     { 0x414, L"\x414", CodepointWidth::Ambiguous }, // U+0414 cyrillic capital de
     { 0x1104, L"\x1104", CodepointWidth::Wide }, // U+1104 hangul choseong ssangtikeut
     { 0x306A, L"\x306A", CodepointWidth::Wide }, // U+306A hiragana na
     { 0x30CA, L"\x30CA", CodepointWidth::Wide }, // U+30CA katakana na
     { 0x72D7, L"\x72D7", CodepointWidth::Wide }, // U+72D7
     { 0x1F47E, L"\xD83D\xDC7E", CodepointWidth::Wide }, // U+1F47E alien monster
-    { 0x1F51C, L"\xD83D\xDD1C", CodepointWidth::Wide } // U+1F51C SOON
+    { 0x1F51C, L"\xD83D\xDD1C", CodepointWidth::Wide }, // U+1F51C SOON
+    { 0x10FFFD, L"\xDBFF\xDFFD", CodepointWidth::Ambiguous }, // U+10FFFD private use
+    { 0x10FFFF, L"\xDBFF\xDFFF", CodepointWidth::Invalid } // U+10FFFF noncharacter
 };
 
 class CodepointWidthDetectorTests
@@ -34,32 +41,12 @@ class CodepointWidthDetectorTests
     TEST_CLASS(CodepointWidthDetectorTests);
 
 
-    TEST_METHOD(CodepointWidthDetectDefersMapPopulation)
-    {
-        CodepointWidthDetector widthDetector;
-        VERIFY_IS_TRUE(widthDetector._map.empty());
-        widthDetector.IsWide(UNICODE_SPACE);
-        VERIFY_IS_TRUE(widthDetector._map.empty());
-        // now force checking
-        widthDetector.GetWidth(emoji);
-        VERIFY_IS_FALSE(widthDetector._map.empty());
-    }
-
     TEST_METHOD(CanLookUpEmoji)
     {
         CodepointWidthDetector widthDetector;
         VERIFY_IS_TRUE(widthDetector.IsWide(emoji));
     }
 
-    TEST_METHOD(TestUnicodeRangeCompare)
-    {
-        CodepointWidthDetector::UnicodeRangeCompare compare;
-        // test comparing 2 search terms
-        CodepointWidthDetector::UnicodeRange a{ 0x10 };
-        CodepointWidthDetector::UnicodeRange b{ 0x15 };
-        VERIFY_IS_TRUE(static_cast<bool>(compare(a, b)));
-    }
-
     TEST_METHOD(CanExtractCodepoint)
     {
         CodepointWidthDetector widthDetector;
@@ -84,6 +71,77 @@ class CodepointWidthDetectorTests
         }
     }
 
+    TEST_METHOD(CanGetWidthsConcurrently)
+    {
+        CodepointWidthDetector widthDetector;
+
+        // This is a new detector, so if it had anything to set up, the threads would race to do it.
+        std::vector<std::thread> threads;
+        std::vector<size_t> mismatches(8);
+        for (size_t i = 0; i < mismatches.size(); ++i)
+        {
+            threads.emplace_back([&, i]() {
+                for (auto repeat = 0; repeat < 1000; ++repeat)
+                {
+                    for (const auto& data : testData)
+                    {
+                        const auto& wstr = std::get<1>(data);
+                        if (widthDetector.GetWidth({ wstr.c_str(), wstr.size() }) != std::get<2>(data))
+                        {
+                            ++mismatches.at(i);
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        for (const auto count : mismatches)
+        {
+            VERIFY_ARE_EQUAL(0u, count);
+        }
+    }
+
+    TEST_METHOD(GetWidthPerf)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+        END_TEST_METHOD_PROPERTIES()
+
+        // CJK ideographs, and emoji from the pictographs and emoticons blocks.
+        std::vector<std::wstring> cjk;
+        std::vector<std::wstring> emojis;
+        for (unsigned int i = 0; i < 100000; ++i)
+        {
+            cjk.emplace_back(1, static_cast<wchar_t>(0x4E00 + (i * 7919) % 0x5000));
+
+            const auto codepoint = 0x1F300 + (i * 31) % 0x300 - 0x10000;
+            emojis.push_back({ static_cast<wchar_t>(0xD800 + (codepoint >> 10)),
+                               static_cast<wchar_t>(0xDC00 + (codepoint & 0x3FF)) });
+        }
+
+        CodepointWidthDetector widthDetector;
+        for (const auto& [name, corpus] : { std::make_pair(L"CJK", &cjk), std::make_pair(L"Emoji", &emojis) })
+        {
+            size_t wide = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto& glyph : *corpus)
+            {
+                wide += widthDetector.GetWidth(glyph) == CodepointWidth::Wide;
+            }
+            const auto delta = std::chrono::steady_clock::now() - start;
+
+            Log::Comment(WEX::Common::NoThrowString().Format(L"%s: looking up %zu glyphs took %lld us, %zu were wide",
+                                                             name,
+                                                             corpus->size(),
+                                                             std::chrono::duration_cast<std::chrono::microseconds>(delta).count(),
+                                                             wide));
+        }
+    }
+
     static bool FallbackMethod(const std::wstring_view glyph)
     {
         if (glyph.size() < 1)
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+#include "..\..\inc\consoletaeftemplates.hpp"
+
+#include "..\..\renderer\base\FramePacer.hpp"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+using namespace Microsoft::Console::Render;
+using namespace std::chrono_literals;
+
+// The pacer is told what time it is, so these tests run on a made-up clock
+// that starts at zero and only moves when they move it.
+class FramePacerTests
+{
+    TEST_CLASS(FramePacerTests);
+
+    TEST_METHOD(PaintsImmediatelyWhenIdle);
+    TEST_METHOD(CoalescesSustainedOutput);
+    TEST_METHOD(BacksOffDuringFloods);
+    TEST_METHOD(BacksOffWhenPaintsAreSlow);
+};
+
+void FramePacerTests::PaintsImmediatelyWhenIdle()
+{
+    FramePacer pacer;
+    FramePacer::clock::time_point now{};
+
+    Log::Comment(L"The first frame shouldn't wait.");
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now) == 0ms);
+    pacer.FramePainted(now, now, now);
+
+    Log::Comment(L"Nor should one asked for after a quiet spell.");
+    now += 500ms;
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now) == 0ms);
+    pacer.FramePainted(now, now, now);
+
+    Log::Comment(L"Nor should one asked for exactly an interval later.");
+    now += FramePacer::TargetFrameInterval;
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now) == 0ms);
+}
+
+void FramePacerTests::CoalescesSustainedOutput()
+{
+    FramePacer pacer;
+    FramePacer::clock::time_point now{};
+    pacer.FramePainted(now, now, now);
+
+    Log::Comment(L"A frame asked for soon after the last one waits out the rest of the interval.");
+    now += 3ms;
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now) == FramePacer::TargetFrameInterval - 3ms);
+
+    Log::Comment(L"Frames at the target rate keep it there for a while.");
+    for (size_t i = 0; i < FramePacer::FloodFrameCount - 1; ++i)
+    {
+        const auto requested = now;
+        now += pacer.GetDelayBeforePaint(now);
+        pacer.FramePainted(requested, now, now);
+        VERIFY_IS_TRUE(pacer.GetFrameInterval() == FramePacer::TargetFrameInterval);
+        now += 1ms;
+    }
+}
+
+void FramePacerTests::BacksOffDuringFloods()
+{
+    FramePacer pacer;
+    FramePacer::clock::time_point now{};
+
+    Log::Comment(L"Paint a frame as soon as the pacer allows, over and over.");
+    auto lastInterval = pacer.GetFrameInterval();
+    for (size_t i = 0; i < FramePacer::FloodFrameCount * 10; ++i)
+    {
+        const auto requested = now;
+        now += pacer.GetDelayBeforePaint(now);
+        pacer.FramePainted(requested, now, now);
+
+        const auto interval = pacer.GetFrameInterval();
+        VERIFY_IS_TRUE(interval >= lastInterval);
+        VERIFY_IS_TRUE(interval <= FramePacer::MaxFrameInterval);
+        lastInterval = interval;
+    }
+
+    Log::Comment(L"The interval should have grown as far as it can.");
+    VERIFY_IS_TRUE(pacer.GetFrameInterval() == FramePacer::MaxFrameInterval);
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now + 1ms) == FramePacer::MaxFrameInterval - 1ms);
+
+    Log::Comment(L"Once the flood is over, the next frame is painted straight away and the interval goes back to the target.");
+    now += 1s;
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now) == 0ms);
+    pacer.FramePainted(now, now, now);
+    VERIFY_IS_TRUE(pacer.GetFrameInterval() == FramePacer::TargetFrameInterval);
+}
+
+void FramePacerTests::BacksOffWhenPaintsAreSlow()
+{
+    FramePacer pacer;
+    FramePacer::clock::time_point now{};
+
+    // Longer than two target intervals, so there's never a frame that starts
+    // soon after the one before.
+    const auto paintTime = 20ms;
+
+    Log::Comment(L"Ask for the next frame as soon as each one is painted, when painting is slow.");
+    for (size_t i = 0; i < FramePacer::FloodFrameCount * 10; ++i)
+    {
+        const auto requested = now;
+        now += pacer.GetDelayBeforePaint(now);
+        const auto start = now;
+        now += paintTime;
+        pacer.FramePainted(requested, start, now);
+    }
+
+    Log::Comment(L"That's still a flood, so the interval should have grown as far as it can.");
+    VERIFY_IS_TRUE(pacer.GetFrameInterval() == FramePacer::MaxFrameInterval);
+    VERIFY_IS_TRUE(pacer.GetDelayBeforePaint(now) == FramePacer::MaxFrameInterval - paintTime);
+}
@@ -517,4 +517,40 @@ class OutputCellIteratorTests
         VERIFY_ARE_EQUAL(cellsExpected, it.GetCellDistance(original));
         VERIFY_ARE_EQUAL(inputExpected, it.GetInputDistance(original));
     }
+
+    TEST_METHOD(NarrowRuns)
+    {
+        SetVerifyOutput settings(VerifyOutputSettings::LogOnlyFailures);
+
+        const std::wstring testText(L"QWER\x30a2TYUI");
+        const TextAttribute color{ FOREGROUND_RED };
+
+        Log::Comment(L"Text without a color to apply doesn't have narrow runs.");
+        VERIFY_IS_TRUE(OutputCellIterator(testText).GetNarrowRun(100).empty());
+
+        OutputCellIterator it(testText, color);
+        const auto original = it;
+
+        Log::Comment(L"The run should stop at the full width character, or the limit given.");
+        VERIFY_ARE_EQUAL(L"QWER", std::wstring{ it.GetNarrowRun(100) });
+        VERIFY_ARE_EQUAL(L"QW", std::wstring{ it.GetNarrowRun(2) });
+
+        it.SkipNarrowRun(4);
+        VERIFY_IS_TRUE(it.GetNarrowRun(100).empty());
+        VERIFY_IS_TRUE(it->DbcsAttr().IsLeading());
+        it++;
+        VERIFY_IS_TRUE(it.GetNarrowRun(100).empty());
+        VERIFY_IS_TRUE(it->DbcsAttr().IsTrailing());
+        it++;
+
+        VERIFY_ARE_EQUAL(L"TYUI", std::wstring{ it.GetNarrowRun(100) });
+        it.SkipNarrowRun(4);
+        VERIFY_IS_FALSE(it);
+        VERIFY_IS_TRUE(it.GetNarrowRun(100).empty());
+
+        const ptrdiff_t cellsExpected = 10;
+        const ptrdiff_t inputExpected = 9;
+        VERIFY_ARE_EQUAL(cellsExpected, it.GetCellDistance(original));
+        VERIFY_ARE_EQUAL(inputExpected, it.GetInputDistance(original));
+    }
 };
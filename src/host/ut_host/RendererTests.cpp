@@ -3,22 +3,291 @@
 
 #include "precomp.h"
 #include "WexTestClass.h"
+#include "..\..\inc\consoletaeftemplates.hpp"
 
 #include "CommonState.hpp"
 
 #include "..\..\host\renderData.hpp"
 #include "..\..\renderer\base\renderer.hpp"
+#include "..\..\renderer\headless\HeadlessEngine.hpp"
+#include "..\..\renderer\inc\RenderEngineBase.hpp"
+#include "..\..\renderer\inc\DummyRenderTarget.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+
+using namespace WEX::Common;
 using namespace WEX::Logging;
 using namespace WEX::TestExecution;
 
+using namespace Microsoft::Console::Render;
+using namespace Microsoft::Console::Types;
+
+// Kept by the operator new in VtRendererTests.cpp.
+extern thread_local bool s_countAllocations;
+extern thread_local size_t s_cAllocations;
+
+// An engine that keeps track of where and what it's asked to paint. It can be
+// paired up with a partner, and then waits partway through painting for the
+// partner to get that far too, which it only can if they paint at the same time.
+class TestEngine : public RenderEngineBase
+{
+public:
+    TestEngine(const bool canPaintInParallel, const bool mustPaintUnderConsoleLock = false) :
+        canPaintInParallel{ canPaintInParallel },
+        mustPaintUnderConsoleLock{ mustPaintUnderConsoleLock },
+        partner{ nullptr },
+        paintThreadId{ 0 },
+        paintedUnderConsoleLock{ false },
+        metPartner{ false },
+        lines{},
+        _startedPainting{ wil::EventOptions::ManualReset },
+        _dirty{ false },
+        _viewport{}
+    {
+    }
+
+    // How long to wait for the partner before giving up on it. Only a broken
+    // renderer makes the wait anywhere near this long.
+    static constexpr DWORD s_partnerTimeoutMs = 30000;
+
+    const bool canPaintInParallel;
+    const bool mustPaintUnderConsoleLock;
+    TestEngine* partner;
+
+    // Which thread the last frame was painted on, whether that thread had the
+    // console locked, whether the partner was painting at the same time, and
+    // what text was in it.
+    DWORD paintThreadId;
+    bool paintedUnderConsoleLock;
+    bool metPartner;
+    std::vector<std::wstring> lines;
+
+    HRESULT StartPaint() noexcept override
+    {
+        if (!_dirty)
+        {
+            return S_FALSE;
+        }
+        lines.clear();
+        metPartner = false;
+        _startedPainting.ResetEvent();
+        return S_OK;
+    }
+    HRESULT EndPaint() noexcept override
+    {
+        _dirty = false;
+        return S_OK;
+    }
+    HRESULT Present() noexcept override { return S_OK; }
+    HRESULT PrepareForTeardown(_Out_ bool* const pForcePaint) noexcept override
+    {
+        *pForcePaint = false;
+        return S_OK;
+    }
+    HRESULT ScrollFrame() noexcept override { return S_OK; }
+
+    HRESULT Invalidate(const SMALL_RECT* const /*psrRegion*/) noexcept override { return _Invalidate(); }
+    HRESULT InvalidateCursor(const COORD* const /*pcoordCursor*/) noexcept override { return _Invalidate(); }
+    HRESULT InvalidateSystem(const RECT* const /*prcDirtyClient*/) noexcept override { return _Invalidate(); }
+    HRESULT InvalidateSelection(const std::vector<SMALL_RECT>& /*rectangles*/) noexcept override { return _Invalidate(); }
+    HRESULT InvalidateScroll(const COORD* const /*pcoordDelta*/) noexcept override { return S_OK; }
+    HRESULT InvalidateAll() noexcept override { return _Invalidate(); }
+    HRESULT InvalidateCircling(_Out_ bool* const pForcePaint) noexcept override
+    {
+        *pForcePaint = false;
+        return S_OK;
+    }
+
+    HRESULT PaintBackground() noexcept override
+    {
+        paintThreadId = GetCurrentThreadId();
+        paintedUnderConsoleLock = ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked();
+        if (partner)
+        {
+            _startedPainting.SetEvent();
+            metPartner = partner->_startedPainting.wait(s_partnerTimeoutMs);
+        }
+        return S_OK;
+    }
+    HRESULT PaintBufferLine(std::basic_string_view<Cluster> const clusters,
+                            const COORD /*coord*/,
+                            const bool /*fTrimLeft*/) noexcept override
+    {
+        try
+        {
+            std::wstring line;
+            for (const auto& cluster : clusters)
+            {
+                line.append(cluster.GetText());
+            }
+            lines.emplace_back(std::move(line));
+        }
+        CATCH_RETURN();
+        return S_OK;
+    }
+    HRESULT PaintBufferGridLines(const GridLines /*lines*/,
+                                 const COLORREF /*color*/,
+                                 const size_t /*cchLine*/,
+                                 const COORD /*coordTarget*/) noexcept override { return S_OK; }
+    HRESULT PaintSelection(const SMALL_RECT /*rect*/) noexcept override { return S_OK; }
+    HRESULT PaintCursor(const CursorOptions& /*options*/) noexcept override { return S_OK; }
+
+    HRESULT UpdateDrawingBrushes(const COLORREF /*colorForeground*/,
+                                 const COLORREF /*colorBackground*/,
+                                 const WORD /*legacyColorAttribute*/,
+                                 const bool /*isBold*/,
+                                 const bool /*isSettingDefaultBrushes*/) noexcept override { return S_OK; }
+    HRESULT UpdateFont(const FontInfoDesired& /*FontInfoDesired*/, _Out_ FontInfo& /*FontInfo*/) noexcept override { return S_OK; }
+    HRESULT UpdateDpi(const int /*iDpi*/) noexcept override { return S_OK; }
+    HRESULT UpdateViewport(const SMALL_RECT srNewViewport) noexcept override
+    {
+        _viewport = srNewViewport;
+        return S_OK;
+    }
+
+    HRESULT GetProposedFont(const FontInfoDesired& /*FontInfoDesired*/,
+                            _Out_ FontInfo& /*FontInfo*/,
+                            const int /*iDpi*/) noexcept override { return S_FALSE; }
+
+    SMALL_RECT GetDirtyRectInChars() override
+    {
+        // The dirty area is in screen coordinates, so it starts at the origin.
+        return { 0, 0, gsl::narrow_cast<SHORT>(_viewport.Right - _viewport.Left), gsl::narrow_cast<SHORT>(_viewport.Bottom - _viewport.Top) };
+    }
+    HRESULT GetFontSize(_Out_ COORD* const pFontSize) noexcept override
+    {
+        *pFontSize = { 1, 1 };
+        return S_FALSE;
+    }
+    HRESULT IsGlyphWideByFont(const std::wstring_view /*glyph*/, _Out_ bool* const pResult) noexcept override
+    {
+        *pResult = false;
+        return S_FALSE;
+    }
+
+    bool CanPaintInParallel() noexcept override { return canPaintInParallel; }
+    bool MustPaintUnderConsoleLock() noexcept override { return mustPaintUnderConsoleLock; }
+
+protected:
+    HRESULT _DoUpdateTitle(const std::wstring& /*newTitle*/) noexcept override { return S_OK; }
+
+private:
+    HRESULT _Invalidate() noexcept
+    {
+        _dirty = true;
+        return S_OK;
+    }
+
+    // Set once this frame has started painting, for the partner to wait on.
+    wil::unique_event _startedPainting;
+    bool _dirty;
+    SMALL_RECT _viewport;
+};
+
+// An engine that only counts the cells it's asked to paint, and so costs next
+// to nothing itself, leaving just the renderer's work to be measured.
+class CountingEngine final : public TestEngine
+{
+public:
+    CountingEngine() :
+        TestEngine{ false },
+        cells{ 0 }
+    {
+    }
+
+    size_t cells;
+
+    HRESULT PaintBufferLine(std::basic_string_view<Cluster> const clusters,
+                            const COORD /*coord*/,
+                            const bool /*fTrimLeft*/) noexcept override
+    {
+        for (const auto& cluster : clusters)
+        {
+            cells += cluster.GetColumns();
+        }
+        return S_OK;
+    }
+};
+
+// An engine that holds on to its frame until the test lets it go.
+class HoldingEngine final : public TestEngine
+{
+public:
+    HoldingEngine() :
+        TestEngine{ false },
+        painting{ false },
+        startedPainting{ wil::EventOptions::ManualReset },
+        release{ wil::EventOptions::ManualReset }
+    {
+    }
+
+    std::atomic<bool> painting;
+    wil::unique_event startedPainting;
+    wil::unique_event release;
+
+    HRESULT PaintBackground() noexcept override
+    {
+        painting = true;
+        startedPainting.SetEvent();
+        release.wait(s_partnerTimeoutMs);
+        painting = false;
+        return S_OK;
+    }
+};
+
+// Shows a buffer of its own, all of it at once, and gets everything else from the console.
+class BufferRenderData final : public IRenderData
+{
+public:
+    BufferRenderData(const TextBuffer& buffer, IRenderData& console) :
+        _buffer{ buffer },
+        _console{ console }
+    {
+    }
+
+    Viewport GetViewport() noexcept override { return _buffer.GetSize(); }
+    const TextBuffer& GetTextBuffer() noexcept override { return _buffer; }
+    const FontInfo& GetFontInfo() noexcept override { return _console.GetFontInfo(); }
+    const TextAttribute GetDefaultBrushColors() noexcept override { return _console.GetDefaultBrushColors(); }
+    const COLORREF GetForegroundColor(const TextAttribute& attr) const noexcept override { return _console.GetForegroundColor(attr); }
+    const COLORREF GetBackgroundColor(const TextAttribute& attr) const noexcept override { return _console.GetBackgroundColor(attr); }
+    COORD GetCursorPosition() const noexcept override { return _buffer.GetCursor().GetPosition(); }
+    bool IsCursorVisible() const noexcept override { return false; }
+    bool IsCursorOn() const noexcept override { return false; }
+    ULONG GetCursorHeight() const noexcept override { return _buffer.GetCursor().GetSize(); }
+    CursorType GetCursorStyle() const noexcept override { return CursorType::Legacy; }
+    ULONG GetCursorPixelWidth() const noexcept override { return 1; }
+    COLORREF GetCursorColor() const noexcept override { return INVALID_COLOR; }
+    bool IsCursorDoubleWidth() const noexcept override { return false; }
+    const std::vector<RenderOverlay> GetOverlays() const noexcept override { return {}; }
+    const bool IsGridLineDrawingAllowed() noexcept override { return true; }
+    std::vector<Viewport> GetSelectionRects() noexcept override { return {}; }
+    const std::wstring GetConsoleTitle() const noexcept override { return _console.GetConsoleTitle(); }
+    void LockConsole() noexcept override { _console.LockConsole(); }
+    void UnlockConsole() noexcept override { _console.UnlockConsole(); }
+
+private:
+    const TextBuffer& _buffer;
+    IRenderData& _console;
+};
+
+// Frames are painted when the test says so, rather than on a thread of their own.
+class ManualRenderThread final : public IRenderThread
+{
+public:
+    void NotifyPaint() override {}
+    void EnablePainting() override {}
+    void WaitForPaintCompletionAndDisable(const DWORD /*dwTimeoutMs*/) override {}
+};
+
 class RendererTests
 {
     TEST_CLASS(RendererTests);
 
     std::unique_ptr<CommonState> m_state;
-    std::unique_ptr<RenderData> m_renderData;
-    std::unique_ptr<Renderer> m_renderer;
 
     TEST_CLASS_SETUP(ClassSetup)
     {
@@ -29,15 +298,11 @@ class RendererTests
 
         m_state->PrepareGlobalInputBuffer();
 
-        m_renderData = std::make_unique<RenderData>();
-
         return true;
     }
 
     TEST_CLASS_CLEANUP(ClassCleanup)
     {
-        m_renderData.reset(nullptr);
-
         m_state->CleanupGlobalInputBuffer();
 
         m_state->CleanupGlobalScreenBuffer();
@@ -48,24 +313,284 @@ class RendererTests
         return true;
     }
 
-    TEST_METHOD_SETUP(MethodSetup)
+    TEST_METHOD(EnginesTakeTurnsUnlessTheyCanShare);
+    TEST_METHOD(ParallelEnginesPaintAtOnce);
+    TEST_METHOD(LoneParallelEnginePaintsOnCallingThread);
+    TEST_METHOD(LockedEnginesPaintBeforeConsoleIsUnlocked);
+    TEST_METHOD(EngineUpdatesWaitForFrameInProgress);
+    TEST_METHOD(FullRepaintPerf);
+    TEST_METHOD(HeadlessEngineRecordsWhatWasPainted);
+
+    // Paints a frame on every engine.
+    static void _PaintAll(Renderer& renderer)
     {
-        Renderer* pRenderer = nullptr;
-        Globals& g = ServiceLocator::LocateGlobals();
-        CONSOLE_INFORMATION& gci = g.getConsoleInformation();
-        VERIFY_SUCCEEDED(Renderer::s_CreateInstance(gci.renderData, &pRenderer));
-        m_renderer.reset(pRenderer);
-        return true;
+        renderer.TriggerRedrawAll();
+        VERIFY_SUCCEEDED(renderer.PaintFrame());
     }
 
-    TEST_METHOD_CLEANUP(MethodCleanup)
+    // Has each of the engines wait for the other while they paint.
+    static void _Pair(TestEngine& first, TestEngine& second) noexcept
     {
-        m_renderer.reset(nullptr);
-        return true;
+        first.partner = &second;
+        second.partner = &first;
     }
+};
+
+void RendererTests::EnginesTakeTurnsUnlessTheyCanShare()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    TestEngine first{ false };
+    TestEngine second{ true };
+    _Pair(first, second);
+    IRenderEngine* engines[] = { &first, &second };
+    Renderer renderer{ &gci.renderData, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    Log::Comment(L"An engine that can't paint at the same time as the others is painted on the calling thread...");
+    _PaintAll(renderer);
+    VERIFY_ARE_EQUAL(GetCurrentThreadId(), first.paintThreadId);
+
+    Log::Comment(L"...while the one that can is painted alongside it, on a worker thread.");
+    VERIFY_ARE_NOT_EQUAL(GetCurrentThreadId(), second.paintThreadId);
+    VERIFY_IS_TRUE(first.metPartner);
+    VERIFY_IS_TRUE(second.metPartner);
+
+    Log::Comment(L"Both were painted from the same snapshot of the buffer.");
+    VERIFY_IS_FALSE(first.lines.empty());
+    VERIFY_IS_TRUE(first.lines == second.lines);
+
+    Log::Comment(L"With neither able to share, they take turns on the calling thread.");
+    TestEngine third{ false };
+    TestEngine fourth{ false };
+    IRenderEngine* serialEngines[] = { &third, &fourth };
+    Renderer serialRenderer{ &gci.renderData, serialEngines, ARRAYSIZE(serialEngines), std::make_unique<ManualRenderThread>() };
+
+    _PaintAll(serialRenderer);
+    VERIFY_ARE_EQUAL(GetCurrentThreadId(), third.paintThreadId);
+    VERIFY_ARE_EQUAL(GetCurrentThreadId(), fourth.paintThreadId);
+    VERIFY_IS_FALSE(third.lines.empty());
+    VERIFY_IS_TRUE(third.lines == fourth.lines);
+}
+
+void RendererTests::ParallelEnginesPaintAtOnce()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    TestEngine first{ true };
+    TestEngine second{ true };
+    _Pair(first, second);
+    IRenderEngine* engines[] = { &first, &second };
+    Renderer renderer{ &gci.renderData, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    Log::Comment(L"Both engines are handed to the workers, and paint at the same time.");
+    _PaintAll(renderer);
+    VERIFY_ARE_NOT_EQUAL(GetCurrentThreadId(), first.paintThreadId);
+    VERIFY_ARE_NOT_EQUAL(GetCurrentThreadId(), second.paintThreadId);
+    VERIFY_ARE_NOT_EQUAL(first.paintThreadId, second.paintThreadId);
+    VERIFY_IS_TRUE(first.metPartner);
+    VERIFY_IS_TRUE(second.metPartner);
+
+    VERIFY_IS_FALSE(first.lines.empty());
+    VERIFY_IS_TRUE(first.lines == second.lines);
+
+    Log::Comment(L"The worker threads are kept for the next frame, rather than new ones started.");
+    const std::set<DWORD> workers{ first.paintThreadId, second.paintThreadId };
+    _PaintAll(renderer);
+    VERIFY_IS_TRUE(first.metPartner);
+    VERIFY_IS_TRUE(second.metPartner);
+    VERIFY_IS_TRUE((std::set<DWORD>{ first.paintThreadId, second.paintThreadId }) == workers);
+    VERIFY_IS_TRUE(first.lines == second.lines);
+}
+
+void RendererTests::LoneParallelEnginePaintsOnCallingThread()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    TestEngine engine{ true };
+    IRenderEngine* engines[] = { &engine };
+    Renderer renderer{ &gci.renderData, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    Log::Comment(L"There's nothing to gain from handing a single engine off to another thread.");
+    _PaintAll(renderer);
+    VERIFY_ARE_EQUAL(GetCurrentThreadId(), engine.paintThreadId);
+    VERIFY_IS_FALSE(engine.lines.empty());
+}
+
+void RendererTests::LockedEnginesPaintBeforeConsoleIsUnlocked()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    TestEngine locked{ true, true };
+    TestEngine unlocked{ false };
+    IRenderEngine* engines[] = { &locked, &unlocked };
+    Renderer renderer{ &gci.renderData, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    Log::Comment(L"An engine that others write to under the console lock paints before it's let go of, on the calling thread...");
+    _PaintAll(renderer);
+    VERIFY_IS_TRUE(locked.paintedUnderConsoleLock);
+    VERIFY_ARE_EQUAL(GetCurrentThreadId(), locked.paintThreadId);
 
-    TEST_METHOD(Sample)
+    Log::Comment(L"...while the rest wait until it has been.");
+    VERIFY_IS_FALSE(unlocked.paintedUnderConsoleLock);
+    VERIFY_IS_FALSE(gci.IsConsoleLocked());
+
+    VERIFY_IS_FALSE(locked.lines.empty());
+    VERIFY_IS_TRUE(locked.lines == unlocked.lines);
+}
+
+void RendererTests::EngineUpdatesWaitForFrameInProgress()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    HoldingEngine engine;
+    IRenderEngine* engines[] = { &engine };
+    Renderer renderer{ &gci.renderData, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    Log::Comment(L"Start painting a frame, which lets go of the console lock and then holds on.");
+    renderer.TriggerRedrawAll();
+    HRESULT paintHr = E_FAIL;
+    std::thread painter([&]() {
+        paintHr = renderer.PaintFrame();
+    });
+    VERIFY_IS_TRUE(engine.startedPainting.wait(TestEngine::s_partnerTimeoutMs));
+    VERIFY_IS_FALSE(gci.IsConsoleLocked());
+
+    Log::Comment(L"Changing the engine in the meantime waits for the frame...");
+    wil::unique_event updated{ wil::EventOptions::ManualReset };
+    bool updatedWhilePainting = true;
+    std::thread updater([&]() {
+        renderer.UpdateEngine([&]() {
+            updatedWhilePainting = engine.painting;
+            updated.SetEvent();
+        });
+    });
+    VERIFY_IS_FALSE(updated.wait(100));
+
+    Log::Comment(L"...and goes ahead once it's done.");
+    engine.release.SetEvent();
+    painter.join();
+    updater.join();
+    VERIFY_SUCCEEDED(paintHr);
+    VERIFY_IS_TRUE(updated.is_signaled());
+    VERIFY_IS_FALSE(updatedWhilePainting);
+}
+
+void RendererTests::FullRepaintPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    // A big window full of colored text, with some wide characters mixed in.
+    const COORD size{ 240, 80 };
+    DummyRenderTarget renderTarget;
+    TextBuffer buffer{ size, TextAttribute{ 0x07 }, 12, renderTarget };
+    for (SHORT row = 0; row < size.Y; ++row)
     {
-        m_renderer->TriggerTitleChange();
+        std::wstring text;
+        for (size_t word = 0; text.size() < 200; ++word)
+        {
+            text.append(word % 9 == 0 ? L"\x4e00" : L"abcdefg");
+        }
+        buffer.Write(OutputCellIterator(text, TextAttribute{ gsl::narrow_cast<WORD>(1 + row % 7) }), { 0, row });
+
+        for (SHORT column = 0; column < size.X; column += 12)
+        {
+            buffer.Write(OutputCellIterator(std::wstring_view{ L"XYZ" }, TextAttribute{ gsl::narrow_cast<WORD>(0x10 + column % 15) }), { column, row });
+        }
     }
-};
+
+    BufferRenderData data{ buffer, gci.renderData };
+    CountingEngine engine;
+    IRenderEngine* engines[] = { &engine };
+    Renderer renderer{ &data, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    // Let the renderer's snapshot grow to fit.
+    for (size_t frame = 0; frame < 4; frame++)
+    {
+        renderer.TriggerRedrawAll();
+        VERIFY_SUCCEEDED(renderer.PaintFrame());
+    }
+
+    // With only one engine, the whole frame is painted on this thread, so every
+    //      allocation the renderer makes is counted.
+    const size_t cFrames = 1000;
+    engine.cells = 0;
+    s_cAllocations = 0;
+    s_countAllocations = true;
+    HRESULT hr = S_OK;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t frame = 0; frame < cFrames && SUCCEEDED(hr); frame++)
+    {
+        renderer.TriggerRedrawAll();
+        hr = renderer.PaintFrame();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    s_countAllocations = false;
+
+    VERIFY_SUCCEEDED(hr);
+    VERIFY_ARE_EQUAL(static_cast<size_t>(size.X) * size.Y * cFrames, engine.cells);
+
+    const auto allocationsPerFrame = s_cAllocations / cFrames;
+    const auto nsPerCell = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / static_cast<long long>(engine.cells);
+    Log::Comment(NoThrowString().Format(
+        L"%zu frames of %dx%d, %zu allocations per frame, %lld ns per cell",
+        cFrames,
+        size.X,
+        size.Y,
+        allocationsPerFrame,
+        static_cast<long long>(nsPerCell)));
+
+    // Copying the text and colors out of the buffer doesn't allocate once the snapshot
+    //      is big enough. What's left is the handful of things the renderer's
+    //      interfaces hand back by value: the dirty area, the title, and so on.
+    VERIFY_IS_LESS_THAN_OR_EQUAL(allocationsPerFrame, 4u);
+}
+
+void RendererTests::HeadlessEngineRecordsWhatWasPainted()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    DummyRenderTarget renderTarget;
+    TextBuffer buffer{ { 10, 3 }, TextAttribute{ 0x07 }, 12, renderTarget };
+    const TextAttribute helloAttr{ FOREGROUND_RED | FOREGROUND_INTENSITY | BACKGROUND_BLUE };
+    buffer.Write(OutputCellIterator(std::wstring_view{ L"hello" }, helloAttr), { 0, 0 });
+
+    BufferRenderData data{ buffer, gci.renderData };
+    HeadlessEngine engine{ buffer.GetSize() };
+    IRenderEngine* engines[] = { &engine };
+    Renderer renderer{ &data, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    Log::Comment(L"Nothing has been painted yet, so the first frame covers the whole screen.");
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+    VERIFY_ARE_EQUAL(1u, engine.GetFramesPainted());
+    VERIFY_ARE_EQUAL(30u, engine.GetCellsPainted());
+
+    Log::Comment(L"The first line is the colored text, drawn with its own colors.");
+    const auto& calls = engine.GetCalls();
+    const auto firstLine = std::find_if(calls.cbegin(), calls.cend(), [](const auto& call) {
+        return call.type == HeadlessEngine::CallType::PaintBufferLine;
+    });
+    VERIFY_IS_TRUE(firstLine != calls.cend());
+    VERIFY_IS_TRUE(firstLine != calls.cbegin());
+    VERIFY_ARE_EQUAL(5u, firstLine->columns);
+    VERIFY_ARE_EQUAL(String(L"hello"), String(engine.GetText().data(), gsl::narrow<int>(firstLine->textEnd)));
+
+    const auto& brushes = *(firstLine - 1);
+    VERIFY_IS_TRUE(brushes.type == HeadlessEngine::CallType::UpdateDrawingBrushes);
+    VERIFY_ARE_EQUAL(data.GetForegroundColor(helloAttr), brushes.foreground);
+    VERIFY_ARE_EQUAL(data.GetBackgroundColor(helloAttr), brushes.background);
+
+    Log::Comment(L"With nothing changed, there's no frame to paint.");
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+    VERIFY_ARE_EQUAL(1u, engine.GetFramesPainted());
+
+    Log::Comment(L"Only what changed is painted in the next frame.");
+    renderer.TriggerRedraw(Viewport::FromDimensions({ 1, 0 }, { 3, 1 }));
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+    VERIFY_ARE_EQUAL(2u, engine.GetFramesPainted());
+    VERIFY_ARE_EQUAL(3u, engine.GetCellsPainted());
+    VERIFY_ARE_EQUAL(String(L"ell"), String(engine.GetText().data(), gsl::narrow<int>(engine.GetText().size())));
+}
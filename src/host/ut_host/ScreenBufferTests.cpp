@@ -158,6 +158,8 @@ class ScreenBufferTests
     TEST_METHOD(ScrollUpInMargins);
     TEST_METHOD(ScrollDownInMargins);
 
+    TEST_METHOD(ApiReflowsRowsLeftByResize);
+
 };
 
 void ScreenBufferTests::SingleAlternateBufferCreationTest()
@@ -3015,3 +3017,51 @@ void ScreenBufferTests::ScrollDownInMargins()
         VERIFY_ARE_EQUAL(L"B" , iter5->Chars());
     }
 }
+
+void ScreenBufferTests::ApiReflowsRowsLeftByResize()
+{
+    // A resize only re-wraps the rows near the viewport, and leaves the rest of
+    //      the scrollback until something reads it. Clients should never see that.
+
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    gci.LockConsole(); // Lock must be taken to manipulate buffer.
+    auto unlock = wil::scope_exit([&] { gci.UnlockConsole(); });
+
+    SCREEN_INFORMATION& si = gci.GetActiveOutputBuffer().GetActiveBuffer();
+    StateMachine& stateMachine = si.GetStateMachine();
+    gci.SetWrapText(true);
+
+    Log::Comment(L"Write enough lines that the first ones are more than a screen above the viewport.");
+    const short lines = static_cast<short>(si.GetViewport().Height() * 3);
+    for (short i = 0; i < lines; ++i)
+    {
+        stateMachine.ProcessString(L"line " + std::to_wstring(i) + L"\r\n");
+    }
+    VERIFY_ARE_EQUAL(COORD({ 0, lines }), si.GetTextBuffer().GetCursor().GetPosition());
+
+    COORD newBufferSize = si.GetBufferSize().Dimensions();
+    newBufferSize.X -= 10;
+    VERIFY_SUCCEEDED(si.ResizeScreenBuffer(newBufferSize, false));
+    VERIFY_IS_TRUE(si.GetTextBuffer().HasDeferredRows());
+
+    Log::Comment(L"The cursor should be reported below every line, like the whole buffer was re-wrapped, without re-wrapping it.");
+    CONSOLE_SCREEN_BUFFER_INFOEX csbiex{ 0 };
+    ServiceLocator::LocateGlobals().api.GetConsoleScreenBufferInfoExImpl(si, csbiex);
+    VERIFY_IS_TRUE(si.GetTextBuffer().HasDeferredRows());
+    VERIFY_ARE_EQUAL(COORD({ 0, lines }), csbiex.dwCursorPosition);
+
+    newBufferSize.X -= 10;
+    VERIFY_SUCCEEDED(si.ResizeScreenBuffer(newBufferSize, false));
+    VERIFY_IS_TRUE(si.GetTextBuffer().HasDeferredRows());
+
+    Log::Comment(L"Reading the top of the buffer should find the first line.");
+    std::wstring text(6, L'\0');
+    size_t written = 0;
+    VERIFY_SUCCEEDED(ServiceLocator::LocateGlobals().api.ReadConsoleOutputCharacterWImpl(si, { 0, 0 }, gsl::make_span(text), written));
+    VERIFY_ARE_EQUAL(6u, written);
+    VERIFY_ARE_EQUAL(L"line 0", text);
+    VERIFY_IS_FALSE(si.GetTextBuffer().HasDeferredRows());
+
+    Log::Comment(L"Nothing else should have moved.");
+    VERIFY_ARE_EQUAL(COORD({ 0, lines }), si.GetTextBuffer().GetCursor().GetPosition());
+}
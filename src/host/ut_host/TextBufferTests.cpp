@@ -17,6 +17,8 @@
 #include "../interactivity/inc/ServiceLocator.hpp"
 #include "../renderer/inc/DummyRenderTarget.hpp"
 
+#include <chrono>
+
 using namespace Microsoft::Console::Types;
 using namespace WEX::Common;
 using namespace WEX::Logging;
@@ -136,12 +138,42 @@ class TextBufferTests
 
     TEST_METHOD(ResizeTraditionalRotationPreservesHighUnicode);
     TEST_METHOD(ScrollBufferRotationPreservesHighUnicode);
+    TEST_METHOD(ScrollRowsInCircledBuffer);
+    TEST_METHOD(ScrollRowsWholeBuffer);
 
     TEST_METHOD(ResizeTraditionalHighUnicodeRowRemoval);
     TEST_METHOD(ResizeTraditionalHighUnicodeColumnRemoval);
 
     TEST_METHOD(TestBurrito);
 
+    TEST_METHOD(ScrollRowsPerf);
+    TEST_METHOD(ResizeTraditionalPerf);
+    TEST_METHOD(IterateRowsPerf);
+    TEST_METHOD(ScrollRowsHighUnicodePerf);
+
+    TEST_METHOD(ReflowNarrower);
+    TEST_METHOD(ReflowWider);
+    TEST_METHOD(ReflowPadsLeadingByte);
+    TEST_METHOD(ReflowKeepsCursorPastText);
+    TEST_METHOD(ReflowPerf);
+
+    TEST_METHOD(ReflowDefersRowsAboveFirstRow);
+    TEST_METHOD(ReflowDeferredRowsDropsWhatDoesntFit);
+    TEST_METHOD(ReflowDoesntSplitLineAtFirstRow);
+    TEST_METHOD(ReflowKeepsLinesSetAsideAcrossResizes);
+    TEST_METHOD(CirclingDropsRowsKeptForLinesSetAside);
+    TEST_METHOD(ReflowVisibleRowsPerf);
+
+    TEST_METHOD(FreezesRowsFarAboveCursor);
+    TEST_METHOD(FrozenRowsKeepTheirCells);
+    TEST_METHOD(RefreezesThawedRows);
+    TEST_METHOD(SpillsFrozenRowsToFile);
+    TEST_METHOD(FrozenScrollbackPerf);
+
+    TEST_METHOD(WriteRunReplacesCells);
+
+    TEST_METHOD(TracksChangedRows);
+
 };
 
 void TextBufferTests::TestBufferCreate()
@@ -1874,6 +1906,83 @@ void TextBufferTests::ScrollBufferRotationPreservesHighUnicode()
     VERIFY_ARE_EQUAL(String(fire), String(shouldBeFireText.data(), gsl::narrow<int>(shouldBeFireText.size())));
 }
 
+// This tests that scrolling a region moves the right rows when the circular buffer doesn't start at 0,
+// and that it does so without rotating the whole storage back to the top.
+void TextBufferTests::ScrollRowsInCircledBuffer()
+{
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Circle the buffer a few times, so logical row 0 isn't in storage slot 0.
+    for (auto i = 0; i < 3; i++)
+    {
+        _buffer->IncrementCircularBuffer();
+    }
+    const auto firstRow = _buffer->_firstRow;
+    VERIFY_ARE_EQUAL(static_cast<SHORT>(3), firstRow);
+
+    // Mark each row with a letter. Row 8 is also given a fire emoji, so we
+    // know the unicode storage follows it.
+    const auto fire = L"\xD83D\xDD25";
+    for (SHORT y = 0; y < bufferSize.Y; y++)
+    {
+        _buffer->GetRowByOffset(y).GetCharRow().GlyphAt(0) = std::wstring(1, static_cast<wchar_t>(L'A' + y));
+    }
+    _buffer->GetRowByOffset(8).GetCharRow().GlyphAt(1) = fire;
+
+    // Move rows 6-8 up to 4-6. This region wraps around the end of the storage.
+    _buffer->ScrollRows(6, 3, -2);
+
+    VERIFY_ARE_EQUAL(firstRow, _buffer->_firstRow);
+
+    const std::wstring expected = L"ABCDGHIEFJ";
+    for (SHORT y = 0; y < bufferSize.Y; y++)
+    {
+        const ROW& row = _buffer->GetRowByOffset(y);
+        const std::wstring_view glyph = row.GetCharRow().GlyphAt(0);
+        VERIFY_ARE_EQUAL(expected.at(y), glyph.front());
+
+        // Every row must still know which slot it's in.
+        VERIFY_ARE_EQUAL(gsl::narrow<SHORT>((firstRow + y) % bufferSize.Y), row.GetId());
+    }
+
+    const auto shouldBeFireText = *_buffer->GetTextDataAt({ 1, 6 });
+    VERIFY_ARE_EQUAL(String(fire), String(shouldBeFireText.data(), gsl::narrow<int>(shouldBeFireText.size())));
+}
+
+// This tests that scrolling the whole buffer just moves where the circular buffer starts.
+void TextBufferTests::ScrollRowsWholeBuffer()
+{
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    const auto fire = L"\xD83D\xDD25";
+    for (SHORT y = 0; y < bufferSize.Y; y++)
+    {
+        _buffer->GetRowByOffset(y).GetCharRow().GlyphAt(0) = std::wstring(1, static_cast<wchar_t>(L'A' + y));
+    }
+    _buffer->GetRowByOffset(2).GetCharRow().GlyphAt(1) = fire;
+
+    // Move rows 2-9 up to the top, which makes rows 0 and 1 the bottom two rows.
+    _buffer->ScrollRows(2, 8, -2);
+
+    VERIFY_ARE_EQUAL(static_cast<SHORT>(2), _buffer->_firstRow);
+
+    const std::wstring expected = L"CDEFGHIJAB";
+    for (SHORT y = 0; y < bufferSize.Y; y++)
+    {
+        const std::wstring_view glyph = _buffer->GetRowByOffset(y).GetCharRow().GlyphAt(0);
+        VERIFY_ARE_EQUAL(expected.at(y), glyph.front());
+    }
+
+    const auto shouldBeFireText = *_buffer->GetTextDataAt({ 1, 0 });
+    VERIFY_ARE_EQUAL(String(fire), String(shouldBeFireText.data(), gsl::narrow<int>(shouldBeFireText.size())));
+}
+
 // This tests that rows removed from the buffer while resizing traditionally will also drop the high unicode
 // characters from the Unicode Storage buffer
 void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
@@ -1899,14 +2008,17 @@ void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
     const auto readBackText = *readBack;
     VERIFY_ARE_EQUAL(String(emoji), String(readBackText.data(), gsl::narrow<int>(readBackText.size())));
 
-    VERIFY_ARE_EQUAL(1u, _buffer->GetUnicodeStorage()._map.size(), L"There should be one item in the map.");
+    VERIFY_ARE_EQUAL(1u, _buffer->_storage[pos.Y].GetUnicodeStorage().Size(), L"There should be one item in the row's storage.");
 
     // Perform resize to trim off the row of the buffer that included the emoji
     COORD trimmedBufferSize{ bufferSize.X, bufferSize.Y - 1 };
 
     VERIFY_NT_SUCCESS(_buffer->ResizeTraditional(trimmedBufferSize));
 
-    VERIFY_IS_TRUE(_buffer->GetUnicodeStorage()._map.empty(), L"The map should now be empty.");
+    for (const auto& row : _buffer->_storage)
+    {
+        VERIFY_IS_TRUE(row.GetUnicodeStorage().Empty(), L"No row should have anything stored now.");
+    }
 }
 
 // This tests that columns removed from the buffer while resizing traditionally will also drop the high unicode
@@ -1934,14 +2046,14 @@ void TextBufferTests::ResizeTraditionalHighUnicodeColumnRemoval()
     const auto readBackText = *readBack;
     VERIFY_ARE_EQUAL(String(emoji), String(readBackText.data(), gsl::narrow<int>(readBackText.size())));
 
-    VERIFY_ARE_EQUAL(1u, _buffer->GetUnicodeStorage()._map.size(), L"There should be one item in the map.");
+    VERIFY_ARE_EQUAL(1u, _buffer->_storage[pos.Y].GetUnicodeStorage().Size(), L"There should be one item in the row's storage.");
 
     // Perform resize to trim off the column of the buffer that included the emoji
     COORD trimmedBufferSize{ bufferSize.X - 1, bufferSize.Y};
 
     VERIFY_NT_SUCCESS(_buffer->ResizeTraditional(trimmedBufferSize));
 
-    VERIFY_IS_TRUE(_buffer->GetUnicodeStorage()._map.empty(), L"The map should now be empty.");
+    VERIFY_IS_TRUE(_buffer->_storage[pos.Y].GetUnicodeStorage().Empty(), L"The row's storage should now be empty.");
 }
 
 void TextBufferTests::TestBurrito()
@@ -1964,3 +2076,746 @@ void TextBufferTests::TestBurrito()
     _buffer->IncrementCursor();
     VERIFY_IS_FALSE(afterBurritoIter);
 }
+
+void TextBufferTests::ScrollRowsPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 240, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Circle the buffer, like a console that has been running for a while.
+    for (auto i = 0; i < 1234; i++)
+    {
+        _buffer->IncrementCircularBuffer();
+    }
+
+    // Scroll a 30 row viewport at the bottom of the buffer up a line at a time.
+    const size_t iterations = 10000;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        _buffer->ScrollRows(bufferSize.Y - 29, 29, -1);
+    }
+    const auto delta = std::chrono::steady_clock::now() - start;
+
+    Log::Comment(NoThrowString().Format(L"Scrolling a 30 row region %zu times took %lld us",
+                                        iterations,
+                                        std::chrono::duration_cast<std::chrono::microseconds>(delta).count()));
+}
+
+void TextBufferTests::ResizeTraditionalPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 240, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    for (auto i = 0; i < 1234; i++)
+    {
+        _buffer->IncrementCircularBuffer();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    VERIFY_SUCCEEDED(_buffer->ResizeTraditional({ 120, 9001 }));
+    VERIFY_SUCCEEDED(_buffer->ResizeTraditional({ 240, 9001 }));
+    const auto delta = std::chrono::steady_clock::now() - start;
+
+    Log::Comment(NoThrowString().Format(L"Resizing twice took %lld us",
+                                        std::chrono::duration_cast<std::chrono::microseconds>(delta).count()));
+}
+
+void TextBufferTests::IterateRowsPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 240, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    for (auto i = 0; i < 1234; i++)
+    {
+        _buffer->IncrementCircularBuffer();
+    }
+
+    size_t cchRight = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (SHORT y = 0; y < bufferSize.Y; y++)
+    {
+        cchRight += _buffer->GetRowByOffset(y).GetCharRow().MeasureRight();
+    }
+    const auto delta = std::chrono::steady_clock::now() - start;
+
+    Log::Comment(NoThrowString().Format(L"Visiting %d rows took %lld us (%zu)",
+                                        bufferSize.Y,
+                                        std::chrono::duration_cast<std::chrono::microseconds>(delta).count(),
+                                        cchRight));
+}
+
+void TextBufferTests::ScrollRowsHighUnicodePerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 240, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    for (auto i = 0; i < 1234; i++)
+    {
+        _buffer->IncrementCircularBuffer();
+    }
+
+    // Fill the bottom of the buffer with emoji, like the output of a tool that
+    // decorates every line with them.
+    // This is the eggplant emoji: 🍆
+    const auto emoji = L"\xD83C\xDF46";
+    for (SHORT y = bufferSize.Y - 300; y < bufferSize.Y; y++)
+    {
+        auto& charRow = _buffer->GetRowByOffset(y).GetCharRow();
+        for (size_t x = 0; x < charRow.size(); x += 2)
+        {
+            charRow.GlyphAt(x) = emoji;
+        }
+    }
+
+    // Scroll a 30 row viewport at the bottom of the buffer up a line at a time.
+    const size_t iterations = 10000;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        _buffer->ScrollRows(bufferSize.Y - 29, 29, -1);
+    }
+    const auto delta = std::chrono::steady_clock::now() - start;
+
+    Log::Comment(NoThrowString().Format(L"Scrolling a 30 row region of emoji %zu times took %lld us",
+                                        iterations,
+                                        std::chrono::duration_cast<std::chrono::microseconds>(delta).count()));
+
+    const std::wstring_view glyph = _buffer->GetRowByOffset(bufferSize.Y - 1).GetCharRow().GlyphAt(0);
+    VERIFY_ARE_EQUAL(String(emoji), String(glyph.data(), gsl::narrow<int>(glyph.size())));
+}
+
+// Writes each line with InsertCharacter, with a newline between them, like a
+// program printing them would.
+static void WriteLines(TextBuffer& buffer, const std::vector<std::wstring>& lines, const TextAttribute attr)
+{
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        if (i > 0)
+        {
+            VERIFY_IS_TRUE(buffer.NewlineCursor());
+        }
+        for (const auto wch : lines.at(i))
+        {
+            VERIFY_IS_TRUE(buffer.InsertCharacter(wch, {}, attr));
+        }
+    }
+}
+
+void TextBufferTests::ReflowNarrower()
+{
+    const COORD bufferSize{ 10, 5 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    const TextAttribute red{ FOREGROUND_RED };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLines(*_buffer, { L"abcdefgh", L"xy" }, attr);
+    _buffer->GetRowByOffset(0).GetAttrRow().SetAttrToEnd(6, red);
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 5, 5 }));
+
+    VERIFY_ARE_EQUAL(5, _buffer->GetSize().Width());
+    VERIFY_ARE_EQUAL(5, _buffer->GetSize().Height());
+
+    VERIFY_ARE_EQUAL(L"abcde", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(0).GetCharRow().WasWrapForced());
+    VERIFY_ARE_EQUAL(L"fgh  ", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(1).GetCharRow().WasWrapForced());
+    VERIFY_ARE_EQUAL(L"xy   ", _buffer->GetRowByOffset(2).GetText());
+
+    Log::Comment(L"The attributes should have moved along with the text.");
+    const auto& attrRow = _buffer->GetRowByOffset(1).GetAttrRow();
+    VERIFY_ARE_EQUAL(attr, attrRow.GetAttrByColumn(0));
+    VERIFY_ARE_EQUAL(red, attrRow.GetAttrByColumn(1));
+    VERIFY_ARE_EQUAL(red, attrRow.GetAttrByColumn(4));
+
+    Log::Comment(L"The cursor should still be after the y.");
+    VERIFY_ARE_EQUAL(COORD({ 2, 2 }), _buffer->GetCursor().GetPosition());
+}
+
+void TextBufferTests::ReflowWider()
+{
+    const COORD bufferSize{ 5, 5 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // This wraps onto the second row.
+    WriteLines(*_buffer, { L"abcdefgh", L"xy" }, attr);
+    _buffer->GetCursor().SetPosition({ 3, 1 });
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 10, 3 }));
+
+    VERIFY_ARE_EQUAL(L"abcdefgh  ", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(0).GetCharRow().WasWrapForced());
+    VERIFY_ARE_EQUAL(L"xy        ", _buffer->GetRowByOffset(1).GetText());
+
+    Log::Comment(L"The cursor was just after the h, and should still be.");
+    VERIFY_ARE_EQUAL(COORD({ 8, 0 }), _buffer->GetCursor().GetPosition());
+}
+
+void TextBufferTests::ReflowPadsLeadingByte()
+{
+    const COORD bufferSize{ 10, 3 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // A double byte character starting in the fourth column.
+    const wchar_t wide = 0x30a2;
+    WriteLines(*_buffer, { L"abc" }, attr);
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(wide, DbcsAttribute{ DbcsAttribute::Attribute::Leading }, attr));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(wide, DbcsAttribute{ DbcsAttribute::Attribute::Trailing }, attr));
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 4, 3 }));
+
+    Log::Comment(L"The leading byte would have gone in the last column, so it should be on the next row.");
+    const auto& firstRow = _buffer->GetRowByOffset(0).GetCharRow();
+    VERIFY_IS_TRUE(firstRow.WasWrapForced());
+    VERIFY_IS_TRUE(firstRow.WasDoubleBytePadded());
+    VERIFY_IS_TRUE(firstRow.DbcsAttrAt(3).IsSingle());
+
+    const auto& secondRow = _buffer->GetRowByOffset(1).GetCharRow();
+    VERIFY_IS_TRUE(secondRow.DbcsAttrAt(0).IsLeading());
+    VERIFY_IS_TRUE(secondRow.DbcsAttrAt(1).IsTrailing());
+    const std::wstring_view glyph = secondRow.GlyphAt(0);
+    VERIFY_ARE_EQUAL(wide, glyph.front());
+}
+
+void TextBufferTests::ReflowKeepsCursorPastText()
+{
+    const COORD bufferSize{ 10, 8 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLines(*_buffer, { L"abcdefgh" }, attr);
+
+    // Two rows below the text, as if after a couple of empty lines.
+    _buffer->GetCursor().SetPosition({ 3, 2 });
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 4, 8 }));
+
+    VERIFY_ARE_EQUAL(L"abcd", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_ARE_EQUAL(L"efgh", _buffer->GetRowByOffset(1).GetText());
+
+    Log::Comment(L"The cursor should still be below the text, at the start of a line.");
+    const auto cursorPosition = _buffer->GetCursor().GetPosition();
+    VERIFY_ARE_EQUAL(0, cursorPosition.X);
+    VERIFY_IS_GREATER_THAN(cursorPosition.Y, static_cast<SHORT>(2));
+}
+
+void TextBufferTests::ReflowPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 120, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    const TextAttribute green{ FOREGROUND_GREEN };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Fill the scrollback with lines of all sorts of lengths, some of which
+    // wrap, and a little color.
+    for (SHORT y = 0; y < bufferSize.Y - 1; y++)
+    {
+        const auto length = (y * 37) % 200;
+        for (auto x = 0; x < length; x++)
+        {
+            _buffer->InsertCharacter(static_cast<wchar_t>(L'a' + x % 26), {}, (x / 10) % 2 ? green : attr);
+        }
+        _buffer->NewlineCursor();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 80, bufferSize.Y }));
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 120, bufferSize.Y }));
+    const auto delta = std::chrono::steady_clock::now() - start;
+
+    Log::Comment(NoThrowString().Format(L"Reflowing %d rows narrower and back took %lld us",
+                                        bufferSize.Y,
+                                        std::chrono::duration_cast<std::chrono::microseconds>(delta).count()));
+}
+
+// Writes a line of 8 of each letter from a to f, so each line wraps onto a
+// second row when the buffer is 5 wide.
+static void WriteLetterLines(TextBuffer& buffer, const TextAttribute attr)
+{
+    std::vector<std::wstring> lines;
+    for (wchar_t wch = L'a'; wch <= L'f'; ++wch)
+    {
+        lines.emplace_back(8, wch);
+    }
+    WriteLines(buffer, lines, attr);
+}
+
+void TextBufferTests::ReflowDefersRowsAboveFirstRow()
+{
+    const COORD bufferSize{ 10, 20 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLetterLines(*_buffer, attr);
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 5, 20 }, 3));
+
+    Log::Comment(L"Only the lines from the fourth down should have been re-wrapped, below six rows kept for the rest.");
+    VERIFY_IS_TRUE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(L"ddddd", _buffer->GetRowByOffset(6).GetText());
+    VERIFY_ARE_EQUAL(L"fff  ", _buffer->GetRowByOffset(11).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 3, 11 }), _buffer->GetCursor().GetPosition());
+    VERIFY_IS_TRUE(_buffer->HasDeferredRows());
+
+    Log::Comment(L"Reading the top row should re-wrap the first three lines into the rows kept for them.");
+    VERIFY_ARE_EQUAL(L"aaaaa", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_FALSE(_buffer->HasDeferredRows());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(0).GetCharRow().WasWrapForced());
+    VERIFY_ARE_EQUAL(L"aaa  ", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_ARE_EQUAL(L"ccc  ", _buffer->GetRowByOffset(5).GetText());
+
+    Log::Comment(L"Nothing else should have moved.");
+    VERIFY_ARE_EQUAL(L"ddddd", _buffer->GetRowByOffset(6).GetText());
+    VERIFY_ARE_EQUAL(L"fff  ", _buffer->GetRowByOffset(11).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 3, 11 }), _buffer->GetCursor().GetPosition());
+}
+
+void TextBufferTests::ReflowDeferredRowsDropsWhatDoesntFit()
+{
+    const COORD bufferSize{ 10, 8 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLetterLines(*_buffer, attr);
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 5, 8 }, 3));
+    VERIFY_IS_TRUE(_buffer->HasDeferredRows());
+
+    Log::Comment(L"There's only room for the c line above the rest.");
+    VERIFY_ARE_EQUAL(L"ddddd", _buffer->GetRowByOffset(2).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 3, 7 }), _buffer->GetCursor().GetPosition());
+    VERIFY_SUCCEEDED(_buffer->ReflowDeferredRows());
+    VERIFY_IS_FALSE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(L"ccccc", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_ARE_EQUAL(L"ccc  ", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_ARE_EQUAL(L"ddddd", _buffer->GetRowByOffset(2).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 3, 7 }), _buffer->GetCursor().GetPosition());
+}
+
+void TextBufferTests::ReflowDoesntSplitLineAtFirstRow()
+{
+    const COORD bufferSize{ 5, 20 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLetterLines(*_buffer, attr);
+
+    Log::Comment(L"The fourth row is the second half of the b line, so the whole line should be re-wrapped.");
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 10, 20 }, 3));
+    VERIFY_IS_TRUE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(L"bbbbbbbb  ", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(1).GetCharRow().WasWrapForced());
+    VERIFY_ARE_EQUAL(COORD({ 8, 5 }), _buffer->GetCursor().GetPosition());
+
+    Log::Comment(L"Only the a line should have been set aside, with a row of its own kept for it.");
+    VERIFY_ARE_EQUAL(L"aaaaaaaa  ", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_FALSE(_buffer->HasDeferredRows());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(0).GetCharRow().WasWrapForced());
+    VERIFY_ARE_EQUAL(L"bbbbbbbb  ", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_ARE_EQUAL(L"ffffffff  ", _buffer->GetRowByOffset(5).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 8, 5 }), _buffer->GetCursor().GetPosition());
+}
+
+void TextBufferTests::ReflowKeepsLinesSetAsideAcrossResizes()
+{
+    const COORD bufferSize{ 10, 20 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLetterLines(*_buffer, attr);
+
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 5, 20 }, 3));
+
+    Log::Comment(L"Resizing again should set aside the d line too, and keep three rows for each line at the new width.");
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 3, 20 }, 8));
+    VERIFY_IS_TRUE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(L"eee", _buffer->GetRowByOffset(12).GetText());
+    VERIFY_ARE_EQUAL(L"ff ", _buffer->GetRowByOffset(17).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 2, 17 }), _buffer->GetCursor().GetPosition());
+
+    Log::Comment(L"The lines should fill those rows exactly, as if they'd been re-wrapped all along.");
+    VERIFY_ARE_EQUAL(L"aaa", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_FALSE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(L"aa ", _buffer->GetRowByOffset(2).GetText());
+    VERIFY_ARE_EQUAL(L"ddd", _buffer->GetRowByOffset(9).GetText());
+    VERIFY_ARE_EQUAL(L"dd ", _buffer->GetRowByOffset(11).GetText());
+    VERIFY_ARE_EQUAL(L"eee", _buffer->GetRowByOffset(12).GetText());
+    VERIFY_ARE_EQUAL(COORD({ 2, 17 }), _buffer->GetCursor().GetPosition());
+}
+
+void TextBufferTests::CirclingDropsRowsKeptForLinesSetAside()
+{
+    const COORD bufferSize{ 10, 8 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    WriteLetterLines(*_buffer, attr);
+
+    Log::Comment(L"Two rows should be kept for the c line, and then one of them scrolls off the top.");
+    VERIFY_SUCCEEDED(_buffer->Reflow({ 5, 8 }, 3));
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_TRUE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(COORD({ 0, 7 }), _buffer->GetCursor().GetPosition());
+
+    Log::Comment(L"Only the end of the c line should be left.");
+    VERIFY_ARE_EQUAL(L"ccc  ", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_FALSE(_buffer->HasDeferredRows());
+    VERIFY_ARE_EQUAL(L"ddddd", _buffer->GetRowByOffset(1).GetText());
+}
+
+void TextBufferTests::ReflowVisibleRowsPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 120, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    for (SHORT y = 0; y < bufferSize.Y - 1; y++)
+    {
+        const auto length = (y * 37) % 200;
+        for (auto x = 0; x < length; x++)
+        {
+            _buffer->InsertCharacter(static_cast<wchar_t>(L'a' + x % 26), {}, attr);
+        }
+        _buffer->NewlineCursor();
+    }
+
+    // Like dragging the edge of a 30 row window, which re-wraps from a screen
+    // above the viewport down.
+    const SHORT viewportHeight = 30;
+    const auto start = std::chrono::steady_clock::now();
+    for (SHORT width = 119; width >= 80; --width)
+    {
+        const SHORT firstRow = std::max<SHORT>(_buffer->GetCursor().GetPosition().Y - 2 * viewportHeight, 0);
+        VERIFY_SUCCEEDED(_buffer->Reflow({ width, bufferSize.Y }, firstRow));
+    }
+    const auto delta = std::chrono::steady_clock::now() - start;
+
+    Log::Comment(NoThrowString().Format(L"40 resizes re-wrapping the visible rows took %lld us",
+                                        std::chrono::duration_cast<std::chrono::microseconds>(delta).count()));
+
+    VERIFY_SUCCEEDED(_buffer->ReflowDeferredRows());
+    VERIFY_IS_FALSE(_buffer->HasDeferredRows());
+}
+
+void TextBufferTests::FreezesRowsFarAboveCursor()
+{
+    const COORD bufferSize{ 10, 20 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+    _buffer->_coldRowDistance = 3;
+
+    WriteLetterLines(*_buffer, attr);
+
+    Log::Comment(L"Rows at least three above the cursor should be frozen, and the rest not.");
+    for (SHORT y = 0; y < bufferSize.Y; ++y)
+    {
+        VERIFY_ARE_EQUAL(y <= 2, _buffer->GetRowByOffset(y).IsFrozen());
+    }
+
+    Log::Comment(L"Reading a frozen row should thaw it, with its text intact.");
+    VERIFY_ARE_EQUAL(L"aaaaaaaa  ", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(0).IsFrozen());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(1).IsFrozen());
+
+    Log::Comment(L"Moving to the next line should only freeze the row that became cold.");
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(0).IsFrozen());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(3).IsFrozen());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(4).IsFrozen());
+}
+
+void TextBufferTests::FrozenRowsKeepTheirCells()
+{
+    const COORD bufferSize{ 10, 20 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    const TextAttribute red{ FOREGROUND_RED };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+    _buffer->_coldRowDistance = 2;
+
+    DbcsAttribute glyphAttr;
+    glyphAttr.SetGlyphStored(true);
+    const std::wstring emoji{ 0xD83D, 0xDE00 };
+
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'a', {}, attr));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'b', {}, red));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'\x3041', DbcsAttribute{ DbcsAttribute::Attribute::Leading }, red));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'\x3041', DbcsAttribute{ DbcsAttribute::Attribute::Trailing }, red));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(emoji, glyphAttr, attr));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L' ', {}, red));
+
+    std::vector<std::tuple<std::wstring, DbcsAttribute, TextAttribute>> expected;
+    for (auto it = _buffer->GetCellDataAt({ 0, 0 }); it && it._pos.Y == 0; ++it)
+    {
+        expected.emplace_back(std::wstring{ it->Chars() }, it->DbcsAttr(), it->TextAttr());
+    }
+    const bool wrapForced = _buffer->GetRowByOffset(0).GetCharRow().WasWrapForced();
+
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(0).IsFrozen());
+
+    Log::Comment(L"Iterating over the frozen row should see the same cells as before.");
+    size_t i = 0;
+    for (auto it = _buffer->GetCellDataAt({ 0, 0 }); it && it._pos.Y == 0; ++it, ++i)
+    {
+        VERIFY_ARE_EQUAL(std::get<0>(expected.at(i)), std::wstring{ it->Chars() });
+        VERIFY_IS_TRUE(std::get<1>(expected.at(i)) == it->DbcsAttr());
+        VERIFY_ARE_EQUAL(std::get<1>(expected.at(i)).IsGlyphStored(), it->DbcsAttr().IsGlyphStored());
+        VERIFY_ARE_EQUAL(std::get<2>(expected.at(i)), it->TextAttr());
+    }
+    VERIFY_ARE_EQUAL(expected.size(), i);
+    VERIFY_ARE_EQUAL(wrapForced, _buffer->GetRowByOffset(0).GetCharRow().WasWrapForced());
+}
+
+void TextBufferTests::RefreezesThawedRows()
+{
+    const SHORT lines = gsl::narrow<SHORT>(TextBuffer::MaxThawedRows + 5);
+    const COORD bufferSize{ 10, gsl::narrow<SHORT>(lines + 5) };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+    _buffer->_coldRowDistance = 1;
+
+    for (SHORT y = 0; y < lines; ++y)
+    {
+        VERIFY_IS_TRUE(_buffer->InsertCharacter(L'x', {}, attr));
+        VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    }
+
+    Log::Comment(L"A few thawed rows should be left alone.");
+    VERIFY_ARE_EQUAL(L"x", _buffer->GetRowByOffset(0).GetText().substr(0, 1));
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(0).IsFrozen());
+
+    Log::Comment(L"Once too many are thawed, the cold ones should be frozen again.");
+    for (SHORT y = 0; y < lines; ++y)
+    {
+        VERIFY_ARE_EQUAL(L'x', _buffer->GetRowByOffset(y).GetText().front());
+    }
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    for (SHORT y = 0; y < lines + 2; ++y)
+    {
+        VERIFY_IS_TRUE(_buffer->GetRowByOffset(y).IsFrozen());
+    }
+}
+
+void TextBufferTests::SpillsFrozenRowsToFile()
+{
+    const COORD bufferSize{ 10, 20 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+    VERIFY_SUCCEEDED(_buffer->EnableScrollbackSpill());
+    _buffer->_coldRowDistance = 3;
+
+    WriteLetterLines(*_buffer, attr);
+
+    Log::Comment(L"The frozen rows should be in the file, and not on the heap.");
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(0).IsFrozen());
+    const auto spilled = _buffer->_spill->Size();
+    VERIFY_IS_GREATER_THAN(spilled, 0u);
+    VERIFY_ARE_EQUAL(sizeof(ROW) + sizeof(FrozenRow), _buffer->GetRowByOffset(0).MemoryUsage());
+
+    Log::Comment(L"Thawing a row should read it back from the file, and free its record.");
+    VERIFY_ARE_EQUAL(L"aaaaaaaa  ", _buffer->GetRowByOffset(0).GetText());
+    VERIFY_ARE_EQUAL(L"bbbbbbbb  ", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_IS_LESS_THAN(_buffer->_spill->Size(), spilled);
+}
+
+void TextBufferTests::FrozenScrollbackPerf()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    const COORD bufferSize{ 120, 9001 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+
+    for (const bool freeze : { false, true })
+    {
+        auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+        if (!freeze)
+        {
+            _buffer->_coldRowDistance = bufferSize.Y;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto line = 0; line < 2 * bufferSize.Y; line++)
+        {
+            const auto length = (line * 37) % 100;
+            for (auto x = 0; x < length; x++)
+            {
+                _buffer->InsertCharacter(static_cast<wchar_t>(L'a' + x % 26), {}, attr);
+            }
+            _buffer->NewlineCursor();
+        }
+        const auto delta = std::chrono::steady_clock::now() - start;
+
+        size_t bytes = 0;
+        for (SHORT y = 0; y < bufferSize.Y; y++)
+        {
+            bytes += _buffer->GetRowByOffset(y).MemoryUsage();
+        }
+
+        Log::Comment(NoThrowString().Format(L"%s: writing %d lines took %lld us, and the rows use %zu KB",
+                                            freeze ? L"Frozen" : L"Not frozen",
+                                            2 * bufferSize.Y,
+                                            std::chrono::duration_cast<std::chrono::microseconds>(delta).count(),
+                                            bytes / 1024));
+    }
+}
+
+void TextBufferTests::WriteRunReplacesCells()
+{
+    const COORD bufferSize{ 10, 5 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    const TextAttribute red{ FOREGROUND_RED };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    DbcsAttribute glyphAttr;
+    glyphAttr.SetGlyphStored(true);
+    const std::wstring emoji{ 0xD83D, 0xDE00 };
+
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'a', {}, attr));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(emoji, glyphAttr, attr));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'\x3041', DbcsAttribute{ DbcsAttribute::Attribute::Leading }, attr));
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'\x3041', DbcsAttribute{ DbcsAttribute::Attribute::Trailing }, attr));
+
+    Log::Comment(L"Writing a run over the glyph and the double byte character should replace all of their cells.");
+    auto& row = _buffer->GetRowByOffset(0);
+    row.WriteRun(L"xyz", red, 1);
+    VERIFY_ARE_EQUAL(L"axyz      ", row.GetText());
+    VERIFY_IS_TRUE(row.GetUnicodeStorage().Empty());
+    for (size_t x = 0; x < bufferSize.X; ++x)
+    {
+        VERIFY_IS_TRUE(row.GetCharRow().DbcsAttrAt(x).IsSingle());
+        VERIFY_ARE_EQUAL(x >= 1 && x <= 3 ? red : attr, row.GetAttrRow().GetAttrByColumn(x));
+    }
+
+    Log::Comment(L"Writing text should switch between runs and other cells, and set the wrap at the end of the row.");
+    const std::wstring text{ L"ab\x3041" L"cdefghijk" };
+    const OutputCellIterator it(text, red);
+    const auto end = _buffer->Write(it, { 0, 1 });
+    const ptrdiff_t cellsExpected = 13;
+    VERIFY_ARE_EQUAL(cellsExpected, end.GetCellDistance(it));
+    VERIFY_ARE_EQUAL(L"ab\x3041" L"cdefgh", _buffer->GetRowByOffset(1).GetText());
+    VERIFY_ARE_EQUAL(L"ijk       ", _buffer->GetRowByOffset(2).GetText());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(1).GetCharRow().DbcsAttrAt(2).IsLeading());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(1).GetCharRow().DbcsAttrAt(3).IsTrailing());
+    VERIFY_IS_TRUE(_buffer->GetRowByOffset(1).GetCharRow().WasWrapForced());
+    VERIFY_IS_FALSE(_buffer->GetRowByOffset(2).GetCharRow().WasWrapForced());
+}
+
+void TextBufferTests::TracksChangedRows()
+{
+    const COORD bufferSize{ 10, 5 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+    _buffer->_coldRowDistance = 1;
+
+    const auto verifyChangedRows = [&](const uint64_t generation, const std::vector<SHORT>& expected) {
+        const auto changed = _buffer->GetRowsChangedSince(generation);
+        VERIFY_ARE_EQUAL(expected.size(), changed.size());
+        for (size_t i = 0; i < std::min(expected.size(), changed.size()); ++i)
+        {
+            VERIFY_ARE_EQUAL(expected.at(i), changed.at(i));
+        }
+    };
+
+    auto generation = _buffer->GetGeneration();
+    verifyChangedRows(generation, {});
+
+    Log::Comment(L"Writing a line should only change its row.");
+    _buffer->WriteLine(OutputCellIterator(std::wstring_view{ L"abc" }, attr), { 0, 2 });
+    verifyChangedRows(generation, { 2 });
+    generation = _buffer->GetGeneration();
+    verifyChangedRows(generation, {});
+
+    Log::Comment(L"Reading rows shouldn't change any, even through the non-const accessor.");
+    for (SHORT y = 0; y < bufferSize.Y; ++y)
+    {
+        VERIFY_ARE_EQUAL(bufferSize.X, gsl::narrow<SHORT>(_buffer->GetRowByOffset(y).GetText().size()));
+    }
+    verifyChangedRows(generation, {});
+
+    Log::Comment(L"Inserting a character should change the cursor's row, and only show up in a range with it.");
+    _buffer->GetCursor().SetPosition({ 1, 3 });
+    VERIFY_IS_TRUE(_buffer->InsertCharacter(L'x', {}, attr));
+    _buffer->GetCursor().SetPosition({ 0, 0 });
+    verifyChangedRows(generation, { 3 });
+    VERIFY_ARE_EQUAL(0u, _buffer->GetRowsChangedSince(generation, 0, 3).size());
+    VERIFY_ARE_EQUAL(1u, _buffer->GetRowsChangedSince(generation, 3, bufferSize.Y).size());
+    generation = _buffer->GetGeneration();
+
+    Log::Comment(L"Moving the cursor and freezing rows shouldn't change any.");
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_TRUE(_buffer->NewlineCursor());
+    VERIFY_IS_TRUE(_buffer->_storage.at(0).IsFrozen());
+    verifyChangedRows(generation, {});
+
+    Log::Comment(L"Scrolling some rows should change the rows they moved through.");
+    _buffer->ScrollRows(2, 2, -1);
+    verifyChangedRows(generation, { 1, 2, 3 });
+
+    Log::Comment(L"Circling the buffer should change every row.");
+    generation = _buffer->GetGeneration();
+    VERIFY_IS_TRUE(_buffer->IncrementCircularBuffer());
+    verifyChangedRows(generation, { 0, 1, 2, 3, 4 });
+
+    Log::Comment(L"So should resetting it.");
+    generation = _buffer->GetGeneration();
+    _buffer->Reset();
+    verifyChangedRows(generation, { 0, 1, 2, 3, 4 });
+}
@@ -9,8 +9,12 @@
 #include "../../renderer/vt/Xterm256Engine.hpp"
 #include "../../renderer/vt/XtermEngine.hpp"
 #include "../../renderer/vt/WinTelnetEngine.hpp"
+#include "../../renderer/vt/VtPipeWriter.hpp"
 #include "../Settings.hpp"
 
+#include <chrono>
+#include <condition_variable>
+
 using namespace WEX::Common;
 using namespace WEX::Logging;
 using namespace WEX::TestExecution;
@@ -38,6 +42,30 @@ static const std::string CURSOR_HOME = "\x1b[H";
 // We don't use null because that will confuse the VERIFY macros re: string length.
 const char* const EMPTY_CALLBACK_SENTINEL = "\xff";
 
+// Counts the heap allocations made by this thread while s_countAllocations is
+// set, so tests can check that painting a frame doesn't allocate.
+// They're shared with the other tests in this binary, which declare them extern.
+thread_local bool s_countAllocations = false;
+thread_local size_t s_cAllocations = 0;
+
+void* operator new(size_t const cb)
+{
+    if (s_countAllocations)
+    {
+        s_cAllocations++;
+    }
+    if (void* const pv = malloc(cb == 0 ? 1 : cb))
+    {
+        return pv;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* const pv) noexcept
+{
+    free(pv);
+}
+
 
 class VtRenderTestColorProvider : public Microsoft::Console::IDefaultColorProvider
 {
@@ -56,6 +84,62 @@ public:
 
 VtRenderTestColorProvider p;
 
+// Stands in for the conpty pipe. Records everything written to it, and can
+// hold up writes (like a terminal that isn't reading) or fail them (like a
+// terminal that went away).
+class TestOutputSink final : public IVtOutputSink
+{
+public:
+    struct State
+    {
+        std::mutex lock;
+        std::condition_variable changed;
+        std::string written;
+        size_t cWrites = 0;
+        bool blocked = false;
+        bool writeStarted = false;
+        bool canceled = false;
+        HRESULT result = S_OK;
+    };
+
+    TestOutputSink(std::shared_ptr<State> state) :
+        _state(state)
+    {
+    }
+
+    [[nodiscard]]
+    HRESULT Write(const std::string_view bytes) noexcept override
+    {
+        std::unique_lock<std::mutex> lock{ _state->lock };
+        _state->writeStarted = true;
+        _state->changed.notify_all();
+        _state->changed.wait(lock, [&]() { return !_state->blocked || _state->canceled; });
+
+        if (_state->canceled)
+        {
+            return HRESULT_FROM_WIN32(ERROR_OPERATION_ABORTED);
+        }
+        if (SUCCEEDED(_state->result))
+        {
+            _state->written.append(bytes);
+            _state->cWrites++;
+        }
+        return _state->result;
+    }
+
+    void Cancel() noexcept override
+    {
+        {
+            std::unique_lock<std::mutex> lock{ _state->lock };
+            _state->canceled = true;
+        }
+        _state->changed.notify_all();
+    }
+
+private:
+    std::shared_ptr<State> _state;
+};
+
 class Microsoft::Console::Render::VtRendererTest
 {
     TEST_CLASS(VtRendererTest);
@@ -109,6 +193,17 @@ class Microsoft::Console::Render::VtRendererTest
 
     TEST_METHOD(TestResize);
 
+    TEST_METHOD(TestSparseInvalidationBytesEmitted);
+
+    TEST_METHOD(TestFrameDiffing);
+
+    TEST_METHOD(SteadyStateFrameAllocations);
+
+    TEST_METHOD(PipeWriterPreservesOrder);
+    TEST_METHOD(PipeWriterDoesntWaitForSlowReader);
+    TEST_METHOD(PipeWriterReportsFailure);
+    TEST_METHOD(PipeWriterGivesUpOnStuckReader);
+
     void Test16Colors(VtEngine* engine);
 
     std::deque<std::string> qExpectedInput;
@@ -1338,3 +1433,412 @@ void VtRendererTest::TestResize()
 
 
 }
+
+void VtRendererTest::TestSparseInvalidationBytesEmitted()
+{
+    Viewport view = SetUpViewport();
+
+    Log::Comment(NoThrowString().Format(
+        L"Invalidate one cell at the top and the whole bottom line, then count "
+        L"the bytes emitted painting the bounding rectangle (what the renderer "
+        L"used to paint) and painting just the dirty area."
+    ));
+
+    const auto measure = [&](const bool useDirtyArea) {
+        wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+        auto engine = std::make_unique<Xterm256Engine>(std::move(hFile), p, view, g_ColorTable, static_cast<WORD>(COLOR_TABLE_SIZE));
+
+        size_t cbEmitted = 0;
+        engine->SetTestCallback([&](const char* const /*pch*/, size_t const cch) {
+            cbEmitted += cch;
+            return true;
+        });
+
+        // Get the first paint's clear screen out of the way.
+        VERIFY_SUCCEEDED(engine->StartPaint());
+        VERIFY_SUCCEEDED(engine->EndPaint());
+        cbEmitted = 0;
+
+        const SMALL_RECT topCell = { 0, 0, 1, 1 };
+        const SMALL_RECT bottomLine = { 0, view.BottomInclusive(), view.Width(), view.BottomExclusive() };
+        VERIFY_SUCCEEDED(engine->Invalidate(&topCell));
+        VERIFY_SUCCEEDED(engine->Invalidate(&bottomLine));
+
+        const auto dirtyArea = engine->GetDirtyArea();
+        VERIFY_ARE_EQUAL(2u, dirtyArea.size());
+        VERIFY_ARE_EQUAL((SMALL_RECT{ 0, 0, 0, 0 }), dirtyArea.at(0));
+        VERIFY_ARE_EQUAL((SMALL_RECT{ 0, view.BottomInclusive(), view.RightInclusive(), view.BottomInclusive() }), dirtyArea.at(1));
+
+        const std::vector<SMALL_RECT> paintArea = useDirtyArea ? dirtyArea : std::vector<SMALL_RECT>{ engine->GetDirtyRectInChars() };
+
+        VERIFY_SUCCEEDED(engine->StartPaint());
+        for (const auto& rect : paintArea)
+        {
+            const std::wstring line(rect.Right - rect.Left + 1, L'X');
+            std::vector<Cluster> clusters;
+            for (size_t i = 0; i < line.size(); i++)
+            {
+                clusters.emplace_back(std::wstring_view{ &line[i], 1 }, 1u);
+            }
+
+            for (SHORT row = rect.Top; row <= rect.Bottom; row++)
+            {
+                VERIFY_SUCCEEDED(engine->PaintBufferLine({ clusters.data(), clusters.size() }, { rect.Left, row }, false));
+            }
+        }
+        VERIFY_SUCCEEDED(engine->EndPaint());
+
+        return cbEmitted;
+    };
+
+    const size_t cbBoundingRect = measure(false);
+    const size_t cbDirtyArea = measure(true);
+
+    Log::Comment(NoThrowString().Format(L"Bounding rectangle: %zu bytes, dirty area: %zu bytes", cbBoundingRect, cbDirtyArea));
+
+    // The bounding rectangle is the whole screen, the dirty area is one line and one cell.
+    VERIFY_IS_LESS_THAN(cbDirtyArea, view.Width() * 2u);
+    VERIFY_IS_GREATER_THAN(cbBoundingRect, cbDirtyArea * 10);
+}
+
+void VtRendererTest::TestFrameDiffing()
+{
+    wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+    std::unique_ptr<Xterm256Engine> engine = std::make_unique<Xterm256Engine>(std::move(hFile), p, SetUpViewport(), g_ColorTable, static_cast<WORD>(COLOR_TABLE_SIZE));
+    auto pfn = std::bind(&VtRendererTest::WriteCallback, this, std::placeholders::_1, std::placeholders::_2);
+    engine->SetTestCallback(pfn);
+
+    // Keep the clusters alive as long as the text they point into.
+    std::wstring line;
+    std::vector<Cluster> clusters;
+    const auto paintLine = [&](const wchar_t* const text, const COORD coord) {
+        line = text;
+        clusters.clear();
+        for (size_t i = 0; i < line.size(); i++)
+        {
+            clusters.emplace_back(std::wstring_view{ &line[i], 1 }, 1u);
+        }
+        VERIFY_SUCCEEDED(engine->PaintBufferLine({ clusters.data(), clusters.size() }, coord, false));
+    };
+
+    // Invalidate only the lines we paint. Invalidating everything would make
+    //      the engine clear the screen, and forget what it had sent.
+    const SMALL_RECT topLines = { 0, 0, SetUpViewport().Width(), 2 };
+
+    qExpectedInput.push_back("\x1b[2J");
+    TestPaint(*engine, [&]() {
+        VERIFY_IS_FALSE(engine->_firstPaint);
+    });
+
+    VERIFY_SUCCEEDED(engine->Invalidate(&topLines));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"The first time a line is painted, all of it is sent."
+        ));
+        qExpectedInput.push_back("\x1b[H");
+        qExpectedInput.push_back("Hello, World");
+        paintLine(L"Hello, World", { 0, 0 });
+    });
+
+    VERIFY_SUCCEEDED(engine->Invalidate(&topLines));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"Only the one cell that changed is sent."
+        ));
+        qExpectedInput.push_back("\x1b[1;8H");
+        qExpectedInput.push_back("w");
+        paintLine(L"Hello, world", { 0, 0 });
+    });
+
+    VERIFY_SUCCEEDED(engine->Invalidate(&topLines));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"Painting the same line again sends nothing."
+        ));
+        qExpectedInput.push_back(EMPTY_CALLBACK_SENTINEL);
+        paintLine(L"Hello, world", { 0, 0 });
+        WriteCallback(EMPTY_CALLBACK_SENTINEL, 1);
+    });
+
+    VERIFY_SUCCEEDED(engine->Invalidate(&topLines));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"Two changes far apart are sent as two runs, moving the cursor over "
+            L"the unchanged cells between them."
+        ));
+        qExpectedInput.push_back("\x1b[1;2H");
+        qExpectedInput.push_back("x");
+        qExpectedInput.push_back("\x1b[6C");
+        qExpectedInput.push_back("x");
+        paintLine(L"Hxllo, wxrld", { 0, 0 });
+    });
+
+    VERIFY_SUCCEEDED(engine->Invalidate(&topLines));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"Two changes close together are sent as one run, since rewriting "
+            L"the cell between them is shorter than moving the cursor over it."
+        ));
+        qExpectedInput.push_back("\x1b[1;2H");
+        qExpectedInput.push_back("zlz");
+        paintLine(L"Hzlzo, wxrld", { 0, 0 });
+    });
+
+    COORD scrollDelta = { 0, 1 };
+    VERIFY_SUCCEEDED(engine->InvalidateScroll(&scrollDelta));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"Scrolling moves the shadow frame with the terminal's contents, so "
+            L"the line that scrolled down isn't sent again."
+        ));
+        qExpectedInput.push_back("\x1b[H");
+        qExpectedInput.push_back("\x1b[L");
+        VERIFY_SUCCEEDED(engine->ScrollFrame());
+
+        paintLine(L"Hzlzo, wxrld", { 0, 1 });
+    });
+
+    VERIFY_SUCCEEDED(engine->Invalidate(&topLines));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"Passthrough text could have changed anything, so the whole line "
+            L"is sent again."
+        ));
+        qExpectedInput.push_back("foo");
+        VERIFY_SUCCEEDED(engine->WriteTerminalW(L"foo"));
+
+        qExpectedInput.push_back("\r\n");
+        qExpectedInput.push_back("Hzlzo, wxrld");
+        paintLine(L"Hzlzo, wxrld", { 0, 1 });
+    });
+}
+
+void VtRendererTest::SteadyStateFrameAllocations()
+{
+    BEGIN_TEST_METHOD_PROPERTIES()
+        TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+    END_TEST_METHOD_PROPERTIES()
+
+    Viewport view = SetUpViewport();
+    wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+    auto engine = std::make_unique<Xterm256Engine>(std::move(hFile), p, view, g_ColorTable, static_cast<WORD>(COLOR_TABLE_SIZE));
+
+    size_t cbEmitted = 0;
+    engine->SetTestCallback([&](const char* const /*pch*/, size_t const cch) {
+        cbEmitted += cch;
+        return true;
+    });
+
+    // Two versions of every line, so that each frame actually changes the
+    //      cells it paints. The trailing spaces are enough to get an ECH.
+    const std::wstring lines[] = {
+        L"The quick brown fox jumps over the lazy dog                  ",
+        L"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG                  ",
+    };
+    std::vector<Cluster> clusters[2];
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (size_t j = 0; j < lines[i].size(); j++)
+        {
+            clusters[i].emplace_back(std::wstring_view{ &lines[i][j], 1 }, 1u);
+        }
+    }
+
+    // Neither color is in the color table, so each brush change is an RGB SGR.
+    const COLORREF colors[] = { RGB(1, 2, 3), RGB(250, 128, 64) };
+
+    // Paint every other row, so that moving between them takes a CUP. Leave
+    //      the bottom row alone, so the engine doesn't decide to clear the
+    //      screen instead. This doesn't VERIFY anything itself, since logging
+    //      the results would allocate.
+    const SMALL_RECT dirty = { 0, 0, view.Width(), view.BottomInclusive() };
+    const auto paintFrame = [&](const size_t frame) -> HRESULT {
+        RETURN_IF_FAILED(engine->Invalidate(&dirty));
+        RETURN_IF_FAILED(engine->StartPaint());
+        for (SHORT row = 0; row < view.BottomInclusive(); row += 2)
+        {
+            const auto& line = clusters[frame % 2];
+            RETURN_IF_FAILED(engine->UpdateDrawingBrushes(colors[frame % 2], colors[(frame + 1) % 2], 0, false, false));
+            RETURN_IF_FAILED(engine->PaintBufferLine({ line.data(), line.size() }, { 0, row }, false));
+        }
+        return engine->EndPaint();
+    };
+
+    // Let the engine's scratch buffers grow to fit.
+    for (size_t frame = 0; frame < 4; frame++)
+    {
+        VERIFY_SUCCEEDED(paintFrame(frame));
+    }
+
+    const size_t cFrames = 1000;
+    cbEmitted = 0;
+    s_cAllocations = 0;
+    s_countAllocations = true;
+    HRESULT hr = S_OK;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t frame = 0; frame < cFrames && SUCCEEDED(hr); frame++)
+    {
+        hr = paintFrame(frame);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    s_countAllocations = false;
+
+    VERIFY_SUCCEEDED(hr);
+
+    Log::Comment(NoThrowString().Format(
+        L"%zu frames, %zu bytes emitted, %zu allocations, %lld us",
+        cFrames,
+        cbEmitted,
+        s_cAllocations,
+        static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count())));
+
+    VERIFY_IS_GREATER_THAN(cbEmitted, 0u);
+    VERIFY_ARE_EQUAL(0u, s_cAllocations);
+}
+
+void VtRendererTest::PipeWriterPreservesOrder()
+{
+    auto state = std::make_shared<TestOutputSink::State>();
+    VtPipeWriter writer{ std::make_unique<TestOutputSink>(state) };
+
+    std::string expected;
+    std::string buffer;
+    for (int i = 0; i < 1000; i++)
+    {
+        buffer = "\x1b[" + std::to_string(i) + "H";
+        expected += buffer;
+        VERIFY_SUCCEEDED(writer.Submit(buffer));
+        VERIFY_IS_TRUE(buffer.empty());
+    }
+    VERIFY_SUCCEEDED(writer.WaitForDrain());
+
+    std::unique_lock<std::mutex> lock{ state->lock };
+    Log::Comment(NoThrowString().Format(L"1000 submits took %zu writes", state->cWrites));
+    VERIFY_ARE_EQUAL(expected, state->written);
+    VERIFY_IS_LESS_THAN_OR_EQUAL(state->cWrites, 1000u);
+}
+
+void VtRendererTest::PipeWriterDoesntWaitForSlowReader()
+{
+    auto state = std::make_shared<TestOutputSink::State>();
+    state->blocked = true;
+    const size_t cbMaxPending = 16;
+    // Long enough that the blocked submit below never gives up waiting.
+    const std::chrono::milliseconds maxWait = std::chrono::minutes(5);
+    VtPipeWriter writer{ std::make_unique<TestOutputSink>(state), cbMaxPending, maxWait };
+
+    Log::Comment(NoThrowString().Format(
+        L"Hand the writer a frame, and wait for it to get stuck writing it."
+    ));
+    std::string buffer = "first frame";
+    VERIFY_SUCCEEDED(writer.Submit(buffer));
+    {
+        std::unique_lock<std::mutex> lock{ state->lock };
+        state->changed.wait(lock, [&]() { return state->writeStarted; });
+    }
+
+    Log::Comment(NoThrowString().Format(
+        L"While the reader is stuck, frames under the limit are accepted without waiting."
+    ));
+    buffer = "second";
+    VERIFY_SUCCEEDED(writer.Submit(buffer));
+    buffer = "third";
+    VERIFY_SUCCEEDED(writer.Submit(buffer));
+
+    Log::Comment(NoThrowString().Format(
+        L"A frame that would go over the limit waits for the reader to catch up."
+    ));
+    std::atomic<bool> fourthSubmitted{ false };
+    HRESULT hrFourth = E_UNEXPECTED;
+    std::thread submitter([&]() {
+        std::string fourth = "fourth frame";
+        hrFourth = writer.Submit(fourth);
+        fourthSubmitted = true;
+    });
+
+    Sleep(100);
+    VERIFY_IS_FALSE(fourthSubmitted.load());
+
+    {
+        std::unique_lock<std::mutex> lock{ state->lock };
+        state->blocked = false;
+    }
+    state->changed.notify_all();
+
+    submitter.join();
+    VERIFY_IS_TRUE(fourthSubmitted.load());
+    VERIFY_SUCCEEDED(hrFourth);
+    VERIFY_SUCCEEDED(writer.WaitForDrain());
+
+    std::unique_lock<std::mutex> lock{ state->lock };
+    VERIFY_ARE_EQUAL(std::string("first framesecondthirdfourth frame"), state->written);
+}
+
+void VtRendererTest::PipeWriterReportsFailure()
+{
+    auto state = std::make_shared<TestOutputSink::State>();
+    state->result = HRESULT_FROM_WIN32(ERROR_BROKEN_PIPE);
+    VtPipeWriter writer{ std::make_unique<TestOutputSink>(state) };
+
+    std::string buffer = "lost";
+    VERIFY_SUCCEEDED(writer.Submit(buffer));
+
+    Log::Comment(NoThrowString().Format(
+        L"The failure is reported once the writer thread hits it, and every "
+        L"submit after that fails too."
+    ));
+    VERIFY_ARE_EQUAL(HRESULT_FROM_WIN32(ERROR_BROKEN_PIPE), writer.WaitForDrain());
+
+    buffer = "also lost";
+    VERIFY_ARE_EQUAL(HRESULT_FROM_WIN32(ERROR_BROKEN_PIPE), writer.Submit(buffer));
+    VERIFY_IS_TRUE(buffer.empty());
+
+    std::unique_lock<std::mutex> lock{ state->lock };
+    VERIFY_IS_TRUE(state->written.empty());
+}
+
+void VtRendererTest::PipeWriterGivesUpOnStuckReader()
+{
+    auto state = std::make_shared<TestOutputSink::State>();
+    state->blocked = true;
+    const size_t cbMaxPending = 16;
+    const std::chrono::milliseconds maxWait{ 50 };
+
+    {
+        VtPipeWriter writer{ std::make_unique<TestOutputSink>(state), cbMaxPending, maxWait };
+
+        std::string buffer = "first frame";
+        VERIFY_SUCCEEDED(writer.Submit(buffer));
+        {
+            std::unique_lock<std::mutex> lock{ state->lock };
+            state->changed.wait(lock, [&]() { return state->writeStarted; });
+        }
+        buffer = "second";
+        VERIFY_SUCCEEDED(writer.Submit(buffer));
+
+        Log::Comment(NoThrowString().Format(
+            L"A frame that won't fit doesn't wait forever for a reader that's stuck. "
+            L"It's handed back, to be submitted again later."
+        ));
+        buffer = "third frame";
+        VERIFY_ARE_EQUAL(HRESULT_FROM_WIN32(ERROR_TIMEOUT), writer.Submit(buffer));
+        VERIFY_ARE_EQUAL(std::string("third frame"), buffer);
+
+        Log::Comment(NoThrowString().Format(
+            L"Once the caller knows the reader is behind, it can ask not to wait at all."
+        ));
+        const auto start = std::chrono::steady_clock::now();
+        VERIFY_ARE_EQUAL(HRESULT_FROM_WIN32(ERROR_TIMEOUT), writer.Submit(buffer, false));
+        VERIFY_IS_TRUE(std::chrono::steady_clock::now() - start < maxWait);
+        VERIFY_ARE_EQUAL(std::string("third frame"), buffer);
+
+        Log::Comment(NoThrowString().Format(
+            L"Tearing the writer down doesn't wait forever either. The stuck "
+            L"write is canceled, and what's left is dropped."
+        ));
+    }
+
+    std::unique_lock<std::mutex> lock{ state->lock };
+    VERIFY_IS_TRUE(state->canceled);
+    VERIFY_IS_TRUE(state->written.empty());
+}
@@ -584,6 +584,13 @@ IFACEMETHODIMP UiaTextRange::FindText(_In_ BSTR text,
 {
     Tracing::s_TraceUia(this, ApiCall::FindText, nullptr);
 
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    gci.LockConsole();
+    auto Unlock = wil::scope_exit([&]
+    {
+        gci.UnlockConsole();
+    });
+
     *ppRetVal = nullptr;
     try
     {
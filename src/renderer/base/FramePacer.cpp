@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "FramePacer.hpp"
+
+#pragma hdrstop
+
+using namespace Microsoft::Console::Render;
+
+// Routine Description:
+// - constructor
+// Arguments:
+// - <none>
+// Return Value:
+// - a pacer that will let the first frame paint straight away
+FramePacer::FramePacer() noexcept :
+    _lastFrameStart{},
+    _lastFrameEnd{},
+    _busyFrames{ 0 }
+{
+}
+
+// Routine Description:
+// - Works out how long to wait before painting a frame that's been asked for.
+// Arguments:
+// - now - the current time
+// Return Value:
+// - how long to wait. Zero if the last frame was long enough ago.
+FramePacer::clock::duration FramePacer::GetDelayBeforePaint(const clock::time_point now) const noexcept
+{
+    if (!_lastFrameStart.has_value())
+    {
+        return clock::duration::zero();
+    }
+
+    const auto nextFrameStart = _lastFrameStart.value() + GetFrameInterval();
+    return now < nextFrameStart ? nextFrameStart - now : clock::duration::zero();
+}
+
+// Routine Description:
+// - Records that a frame was painted, so the following ones can be paced.
+// - A frame that was asked for within two intervals of the one before finishing
+//   is taken to be part of a flood of output, and a longer gap than that ends the
+//   flood. The time spent painting doesn't count towards the gap, so frames that
+//   take longer to paint than the interval still add up to a flood.
+// Arguments:
+// - requested - when the frame was asked for
+// - start - when the frame started painting
+// - end - when the frame finished painting
+// Return Value:
+// - <none>
+void FramePacer::FramePainted(const clock::time_point requested,
+                              const clock::time_point start,
+                              const clock::time_point end) noexcept
+{
+    if (_lastFrameEnd.has_value() && requested - _lastFrameEnd.value() <= GetFrameInterval() * 2)
+    {
+        // Stop counting once the interval can't go any higher.
+        if (_busyFrames < FloodFrameCount * static_cast<size_t>(MaxFrameInterval / TargetFrameInterval))
+        {
+            ++_busyFrames;
+        }
+    }
+    else
+    {
+        _busyFrames = 0;
+    }
+
+    _lastFrameStart = start;
+    _lastFrameEnd = end;
+}
+
+// Routine Description:
+// - Gets the time there should be between the start of one frame and the next,
+//   given how long output has been flooding in.
+// Arguments:
+// - <none>
+// Return Value:
+// - the interval, between TargetFrameInterval and MaxFrameInterval
+FramePacer::clock::duration FramePacer::GetFrameInterval() const noexcept
+{
+    const auto steps = gsl::narrow_cast<int>(_busyFrames / FloodFrameCount);
+    return std::min<clock::duration>(TargetFrameInterval * (1 + steps), MaxFrameInterval);
+}
@@ -0,0 +1,51 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- FramePacer.hpp
+
+Abstract:
+- Decides when the render thread should paint its next frame. A frame asked
+  for after a quiet spell is painted straight away. While output keeps coming,
+  frames are held back to a steady rate so that many updates land in one
+  frame, and the longer a flood goes on, the lower that rate goes.
+- The pacer never reads the clock or waits itself. It's told what time it is,
+  so it can be tested without any real waiting.
+--*/
+
+#pragma once
+
+#include <chrono>
+
+namespace Microsoft::Console::Render
+{
+    class FramePacer final
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        // The time between frames while output keeps coming.
+        static constexpr std::chrono::milliseconds TargetFrameInterval{ 8 };
+        // The most time between frames, no matter how long a flood goes on.
+        static constexpr std::chrono::milliseconds MaxFrameInterval{ 32 };
+        // The interval goes up by TargetFrameInterval after this many frames in a row without a break.
+        static constexpr size_t FloodFrameCount = 60;
+
+        FramePacer() noexcept;
+
+        clock::duration GetDelayBeforePaint(const clock::time_point now) const noexcept;
+        void FramePainted(const clock::time_point requested,
+                          const clock::time_point start,
+                          const clock::time_point end) noexcept;
+
+        clock::duration GetFrameInterval() const noexcept;
+
+    private:
+        std::optional<clock::time_point> _lastFrameStart;
+        std::optional<clock::time_point> _lastFrameEnd;
+
+        // How many frames in a row were asked for without a break after the one before.
+        size_t _busyFrames;
+    };
+}
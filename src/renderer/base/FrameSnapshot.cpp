@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "FrameSnapshot.hpp"
+
+#pragma hdrstop
+
+using namespace Microsoft::Console::Render;
+
+// Routine Description:
+// - constructor
+// Arguments:
+// - <none>
+// Return Value:
+// - an empty snapshot
+FrameSnapshot::FrameSnapshot() :
+    defaultBrushes{},
+    isGridLineDrawingAllowed{ false },
+    selection{},
+    cursor{},
+    title{},
+    _text{},
+    _clusters{},
+    _runs{},
+    _pendingColumns{ 0 }
+{
+}
+
+// Routine Description:
+// - Empties the snapshot, ready for the next frame. Keeps hold of its storage.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void FrameSnapshot::Clear() noexcept
+{
+    defaultBrushes = {};
+    isGridLineDrawingAllowed = false;
+    selection.clear();
+    cursor.reset();
+    title.clear();
+
+    _text.clear();
+    _clusters.clear();
+    _runs.clear();
+    _pendingColumns = 0;
+}
+
+// Routine Description:
+// - Adds a cluster to the run that's being built.
+// Arguments:
+// - text - the characters of the cluster
+// - columns - how many columns it takes up
+// Return Value:
+// - <none>
+void FrameSnapshot::AppendCluster(const std::wstring_view text, const size_t columns)
+{
+    _text.append(text);
+    _clusters.push_back({ _text.size(), columns });
+    _pendingColumns += columns;
+}
+
+// Routine Description:
+// - Finishes the run that's being built, out of the clusters appended since the last one.
+// Arguments:
+// - brushes - what to draw the run with
+// - lines - the grid lines to draw around the run's cells
+// - target - where on the screen the run starts
+// Return Value:
+// - <none>
+void FrameSnapshot::FinishRun(const Brushes brushes, const IRenderEngine::GridLines lines, const COORD target)
+{
+    _runs.push_back({ brushes, lines, target, _pendingColumns, _clusters.size() });
+    _pendingColumns = 0;
+}
+
+// Routine Description:
+// - Gets the runs of text in the frame, in the order they should be painted.
+// Arguments:
+// - <none>
+// Return Value:
+// - the runs
+const std::vector<FrameSnapshot::Run>& FrameSnapshot::GetRuns() const noexcept
+{
+    return _runs;
+}
+
+// Routine Description:
+// - Gets the clusters of one run, ready to hand to an engine. They refer to the
+//   snapshot's own copy of the text, so they're only valid until it's cleared.
+// Arguments:
+// - run - the index of the run in GetRuns
+// - clusters - receives the clusters. Anything that was in it is thrown away.
+// Return Value:
+// - <none>
+void FrameSnapshot::GetClusters(const size_t run, std::vector<Cluster>& clusters) const
+{
+    clusters.clear();
+
+    const size_t clustersBegin = run > 0 ? _runs.at(run - 1).clustersEnd : 0;
+    const size_t clustersEnd = _runs.at(run).clustersEnd;
+
+    size_t textBegin = clustersBegin > 0 ? _clusters.at(clustersBegin - 1).textEnd : 0;
+    for (size_t i = clustersBegin; i < clustersEnd; ++i)
+    {
+        const auto& cluster = _clusters.at(i);
+        clusters.emplace_back(std::wstring_view{ _text }.substr(textBegin, cluster.textEnd - textBegin), cluster.columns);
+        textBegin = cluster.textEnd;
+    }
+}
@@ -0,0 +1,76 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- FrameSnapshot.hpp
+
+Abstract:
+- A copy of everything the renderer needs out of the console to paint a frame.
+- It's filled in while the console is locked, and painted from once the lock
+  has been let go of, so that clients can keep writing while engines paint.
+- Its storage is kept from one frame to the next, so once it has grown big
+  enough for the frames being painted, filling it doesn't allocate.
+--*/
+
+#pragma once
+
+#include "../inc/IRenderEngine.hpp"
+
+namespace Microsoft::Console::Render
+{
+    class FrameSnapshot final
+    {
+    public:
+        // The colors to draw with, already looked up in the console's color table.
+        struct Brushes
+        {
+            COLORREF foreground;
+            COLORREF background;
+            WORD legacyAttributes;
+            bool isBold;
+        };
+
+        // A stretch of a line that's all drawn with the same brushes.
+        struct Run
+        {
+            Brushes brushes;
+            IRenderEngine::GridLines lines;
+            COORD target; // where on the screen the run starts
+            size_t columns;
+            size_t clustersEnd; // the run's clusters start where the previous run's end
+        };
+
+        FrameSnapshot();
+
+        void Clear() noexcept;
+
+        void AppendCluster(const std::wstring_view text, const size_t columns);
+        void FinishRun(const Brushes brushes, const IRenderEngine::GridLines lines, const COORD target);
+
+        const std::vector<Run>& GetRuns() const noexcept;
+        void GetClusters(const size_t run, std::vector<Cluster>& clusters) const;
+
+        // The rest of the frame, besides the text.
+        Brushes defaultBrushes;
+        bool isGridLineDrawingAllowed;
+        std::vector<SMALL_RECT> selection; // already trimmed to the dirty area
+        std::optional<IRenderEngine::CursorOptions> cursor;
+        std::wstring title;
+
+    private:
+        struct ClusterData
+        {
+            size_t textEnd; // the cluster's text starts where the previous cluster's ends
+            size_t columns;
+        };
+
+        // The text of every cluster, one after the other.
+        std::wstring _text;
+        std::vector<ClusterData> _clusters;
+        std::vector<Run> _runs;
+
+        // How many columns the clusters since the last run take up.
+        size_t _pendingColumns;
+    };
+}
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "PaintWorkerPool.hpp"
+
+#pragma hdrstop
+
+using namespace Microsoft::Console::Render;
+
+// Routine Description:
+// - constructor
+// Arguments:
+// - <none>
+// Return Value:
+// - a pool with no threads yet
+PaintWorkerPool::PaintWorkerPool() noexcept :
+    _lock{},
+    _jobAvailable{},
+    _idle{},
+    _jobs{},
+    _busyWorkers{ 0 },
+    _stopping{ false },
+    _threads{}
+{
+}
+
+// Routine Description:
+// - Destructor. Lets the jobs that have been submitted finish, then stops the threads.
+PaintWorkerPool::~PaintWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+        _stopping = true;
+    }
+    _jobAvailable.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+// Routine Description:
+// - Runs a job on one of the pool's threads, starting another thread for it if
+//   they're all busy and there's room for one more.
+// Arguments:
+// - job - the work to do. It must not throw.
+// Return Value:
+// - <none>, throws exceptions on failures. If it throws, the job won't run.
+void PaintWorkerPool::Submit(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+
+        const auto idleWorkers = _threads.size() - _busyWorkers;
+        if (idleWorkers <= _jobs.size() && _threads.size() < MaxWorkers)
+        {
+            _threads.emplace_back([this]() { _WorkerThread(); });
+        }
+
+        _jobs.emplace_back(std::move(job));
+    }
+    _jobAvailable.notify_one();
+}
+
+// Routine Description:
+// - Waits until every job that has been submitted has finished.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void PaintWorkerPool::WaitForIdle() noexcept
+{
+    std::unique_lock<std::mutex> lock{ _lock };
+    _idle.wait(lock, [this]() noexcept { return _jobs.empty() && _busyWorkers == 0; });
+}
+
+void PaintWorkerPool::_WorkerThread() noexcept
+{
+    std::unique_lock<std::mutex> lock{ _lock };
+    for (;;)
+    {
+        _jobAvailable.wait(lock, [this]() noexcept { return _stopping || !_jobs.empty(); });
+        if (_jobs.empty())
+        {
+            return;
+        }
+
+        auto job = std::move(_jobs.front());
+        _jobs.pop_front();
+        ++_busyWorkers;
+
+        lock.unlock();
+        job();
+        lock.lock();
+
+        --_busyWorkers;
+        if (_jobs.empty() && _busyWorkers == 0)
+        {
+            _idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,52 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- PaintWorkerPool.hpp
+
+Abstract:
+- A few threads for the renderer to paint engines on, so that engines that
+  can paint at the same time as each other don't have to take turns.
+- Threads are only started when there's work for them, and then kept for
+  the next frame. Most consoles have one engine, and never start any.
+--*/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Microsoft::Console::Render
+{
+    class PaintWorkerPool final
+    {
+    public:
+        // The most threads the pool will start. Jobs beyond that wait their turn.
+        static constexpr size_t MaxWorkers = 4;
+
+        PaintWorkerPool() noexcept;
+        ~PaintWorkerPool();
+
+        PaintWorkerPool(const PaintWorkerPool&) = delete;
+        PaintWorkerPool& operator=(const PaintWorkerPool&) = delete;
+
+        void Submit(std::function<void()> job);
+        void WaitForIdle() noexcept;
+
+    private:
+        void _WorkerThread() noexcept;
+
+        std::mutex _lock;
+        // Signaled when there's a job to run, or the workers should exit.
+        std::condition_variable _jobAvailable;
+        // Signaled when the last running job finishes and there are none waiting.
+        std::condition_variable _idle;
+
+        std::deque<std::function<void()>> _jobs;
+        size_t _busyWorkers;
+        bool _stopping;
+        std::vector<std::thread> _threads;
+    };
+}
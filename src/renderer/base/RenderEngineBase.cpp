@@ -37,3 +37,44 @@ HRESULT RenderEngineBase::UpdateTitle(const std::wstring& newTitle) noexcept
     }
     return hr;
 }
+
+// Routine Description:
+// - Gets the dirty portions of the frame, as rectangles in characters.
+//   Engines that only track a single dirty rectangle don't need to override
+//      this - it's just GetDirtyRectInChars.
+// Arguments:
+// - <none>
+// Return Value:
+// - The dirty areas of the frame. These are Inclusive rects.
+std::vector<SMALL_RECT> RenderEngineBase::GetDirtyArea()
+{
+    return { GetDirtyRectInChars() };
+}
+
+// Routine Description:
+// - Reports whether this engine can paint a frame on another thread, at the
+//   same time as the other engines paint theirs. Engines that paint into a
+//   window or device of their own have to stay on the render thread, so they
+//   say no, unless they override this.
+// Arguments:
+// - <none>
+// Return Value:
+// - false
+bool RenderEngineBase::CanPaintInParallel() noexcept
+{
+    return false;
+}
+
+// Routine Description:
+// - Reports whether this engine has to paint its frame before the renderer lets
+//   go of the console lock. Engines that are written to directly by code that
+//   only holds the console lock, rather than through the renderer, say yes, so
+//   that those writes can't land in the middle of a frame.
+// Arguments:
+// - <none>
+// Return Value:
+// - false
+bool RenderEngineBase::MustPaintUnderConsoleLock() noexcept
+{
+    return false;
+}
@@ -50,11 +50,11 @@ Renderer::~Renderer()
 }
 
 // Routine Description:
-// - Walks through the console data structures to compose a new frame based on the data that has changed since last call and outputs it to the connected rendering engine.
+// - Walks through the console data structures to compose a new frame based on the data that has changed since last call and outputs it to the connected rendering engines.
 // Arguments:
 // - <none>
 // Return Value:
-// - HRESULT S_OK, GDI error, Safe Math error, or state/argument errors.
+// - S_OK, or S_FALSE if the renderer is going away. Errors from the engines are logged.
 [[nodiscard]]
 HRESULT Renderer::PaintFrame()
 {
@@ -63,81 +63,199 @@ HRESULT Renderer::PaintFrame()
         return S_FALSE;
     }
 
-    for (IRenderEngine* const pEngine : _rgpEngines)
-    {
-        LOG_IF_FAILED(_PaintFrameForEngine(pEngine));
-    }
+    _PaintFrameForEngines(nullptr);
 
     return S_OK;
 }
 
-
-[[nodiscard]]
-HRESULT Renderer::_PaintFrameForEngine(_In_ IRenderEngine* const pEngine)
+// Routine Description:
+// - Paints a frame on the engines. What each of them needs is copied out of the
+//   console during a single hold of the lock, so they all show the same state.
+// - Engines that other code writes to while holding only the console lock are
+//   painted before the lock is let go of, so those writes can't land in the
+//   middle of their frame. The rest are painted once it has been.
+// - If more than one of those has something to paint, the ones that can paint
+//   at the same time as each other are painted on the worker threads, while the
+//   rest are painted on this thread, one at a time. The frame takes as long as
+//   the slowest engine, rather than all of them added together.
+// Arguments:
+// - onlyEngine - the engine to paint, or nullptr to paint all of them.
+// Return Value:
+// - <none>. Errors from the engines are logged.
+void Renderer::_PaintFrameForEngines(_In_opt_ IRenderEngine* const onlyEngine)
 {
-    FAIL_FAST_IF_NULL(pEngine); // This is a programming error. Fail fast.
-
     _pData->LockConsole();
     auto unlock = wil::scope_exit([&]()
     {
         _pData->UnlockConsole();
     });
 
+    // Only one frame is painted at a time, whatever thread it's painted on.
+    std::unique_lock<std::mutex> paintLock{ _paintLock };
+
     // Last chance check if anything scrolled without an explicit invalidate notification since the last frame.
     _CheckViewportAndScroll();
 
-    // Try to start painting a frame
-    HRESULT const hr = pEngine->StartPaint();
-    RETURN_IF_FAILED(hr);
+    // Until the frame is done, invalidations are saved up for the next one, so
+    //      that the engines' dirty areas don't change underneath them.
+    _SetPainting(true);
+    auto donePainting = wil::scope_exit([&]()
+    {
+        _SetPainting(false);
+    });
 
-    // Return early if there's nothing to paint.
-    // The renderer itself tracks if there's something to do with the title, the
-    //      engine won't know that.
-    if (S_FALSE == hr)
+    size_t startedFrames = 0;
+    for (auto& frame : _frames)
     {
-        return S_OK;
+        frame.isStarted = false;
+        frame.isSubmitted = false;
+        frame.isPainted = false;
+        frame.hr = S_OK;
+
+        if (onlyEngine != nullptr && frame.engine != onlyEngine)
+        {
+            continue;
+        }
+
+        // Try to start painting a frame
+        frame.hr = frame.engine->StartPaint();
+        LOG_IF_FAILED(frame.hr);
+
+        // Skip the engine if there's nothing to paint.
+        // The renderer itself tracks if there's something to do with the title, the
+        //      engine won't know that.
+        if (S_OK == frame.hr)
+        {
+            frame.isStarted = true;
+            ++startedFrames;
+
+            // Copy out everything in the console that the frame needs...
+            frame.hr = _SnapshotFrame(frame);
+        }
     }
 
-    auto endPaint = wil::scope_exit([&]()
+    for (auto& frame : _frames)
     {
-        LOG_IF_FAILED(pEngine->EndPaint());
-    });
+        if (frame.isStarted && frame.engine->MustPaintUnderConsoleLock())
+        {
+            _PaintEngineFrame(frame);
+            frame.isPainted = true;
+            --startedFrames;
+        }
+    }
 
-    // A. Prep Colors
-    RETURN_IF_FAILED(_UpdateDrawingBrushes(pEngine, _pData->GetDefaultBrushColors(), true));
+    // ...so that we can let go of the global lock, and other threads can run while we paint the rest.
+    unlock.reset();
 
-    // B. Perform Scroll Operations
-    RETURN_IF_FAILED(_PerformScrolling(pEngine));
+    // Hand the engines that can paint at the same time as the others off to the
+    //      workers first, so that they're under way while we paint the rest.
+    // With only one engine to paint, it's quicker to just get on with it here.
+    for (auto& frame : _frames)
+    {
+        if (frame.isStarted && !frame.isPainted && startedFrames > 1 && frame.engine->CanPaintInParallel())
+        {
+            try
+            {
+                _workers.Submit([this, &frame]() noexcept {
+                    _PaintEngineFrame(frame);
+                });
+                frame.isSubmitted = true;
+            }
+            CATCH_LOG();
+        }
+    }
 
-    // 1. Paint Background
-    RETURN_IF_FAILED(_PaintBackground(pEngine));
+    for (auto& frame : _frames)
+    {
+        if (frame.isStarted && !frame.isPainted && !frame.isSubmitted)
+        {
+            _PaintEngineFrame(frame);
+        }
+    }
 
-    // 2. Paint Rows of Text
-    _PaintBufferOutput(pEngine);
+    _workers.WaitForIdle();
 
-    // 3. Paint overlays that reside above the text buffer
-    _PaintOverlays(pEngine);
+    // Presenting can take a while, and needs nothing from us, so let the next frame get going.
+    std::vector<IRenderEngine*> presentEngines;
+    try
+    {
+        for (const auto& frame : _frames)
+        {
+            if (frame.isStarted && SUCCEEDED(frame.hr))
+            {
+                presentEngines.push_back(frame.engine);
+            }
+        }
+    }
+    CATCH_LOG();
 
-    // 4. Paint Selection
-    _PaintSelection(pEngine);
+    donePainting.reset();
+    paintLock.unlock();
 
-    // 5. Paint Cursor
-    _PaintCursor(pEngine);
+    // Trigger presentation for renderers that can support it
+    for (IRenderEngine* const pEngine : presentEngines)
+    {
+        LOG_IF_FAILED(pEngine->Present());
+    }
+}
 
-    // 6. Paint window title
-    RETURN_IF_FAILED(_PaintTitle(pEngine));
+// Routine Description:
+// - Paints the snapshot of one engine's frame, then ends the engine's frame.
+//   It may be called on a worker thread.
+// Arguments:
+// - frame - the engine's frame. It must have been started, and its snapshot taken.
+// Return Value:
+// - <none>. If painting fails, the frame's hr says why.
+void Renderer::_PaintEngineFrame(EngineFrame& frame) noexcept
+{
+    if (SUCCEEDED(frame.hr))
+    {
+        frame.hr = _PaintSnapshot(frame);
+        LOG_IF_FAILED(frame.hr);
+    }
 
-    // Force scope exit end paint to finish up collecting information and possibly painting
-    endPaint.reset();
+    // End paint to finish up collecting information and possibly painting,
+    //      even if the frame couldn't be painted.
+    LOG_IF_FAILED(frame.engine->EndPaint());
+}
 
-    // Force scope exit unlock to let go of global lock so other threads can run
-    unlock.reset();
+// Routine Description:
+// - Paints everything in the snapshot of one engine's frame.
+// Arguments:
+// - frame - the engine's frame
+// Return Value:
+// - S_OK, or the first error the engine returned.
+[[nodiscard]]
+HRESULT Renderer::_PaintSnapshot(EngineFrame& frame) noexcept
+{
+    try
+    {
+        IRenderEngine* const pEngine = frame.engine;
 
-    // Trigger out-of-lock presentation for renderers that can support it
-    RETURN_IF_FAILED(pEngine->Present());
+        // A. Prep Colors
+        RETURN_IF_FAILED(_UpdateDrawingBrushes(pEngine, frame.snapshot.defaultBrushes, true));
 
-    // As we leave the scope, EndPaint will be called (declared above)
-    return S_OK;
+        // B. Perform Scroll Operations
+        RETURN_IF_FAILED(_PerformScrolling(pEngine));
+
+        // 1. Paint Background
+        RETURN_IF_FAILED(_PaintBackground(pEngine));
+
+        // 2. Paint Rows of Text, followed by the overlays that reside above the text buffer
+        _PaintBufferOutput(frame);
+
+        // 3. Paint Selection
+        _PaintSelection(frame);
+
+        // 4. Paint Cursor
+        _PaintCursor(frame);
+
+        // 5. Paint window title
+        RETURN_IF_FAILED(_PaintTitle(frame));
+
+        return S_OK;
+    }
+    CATCH_RETURN();
 }
 
 void Renderer::_NotifyPaintFrame()
@@ -146,6 +264,76 @@ void Renderer::_NotifyPaintFrame()
     _pThread->NotifyPaint();
 }
 
+// Routine Description:
+// - Passes an invalidation on to every engine. While a frame is being painted,
+//   it's saved and passed on just before the next frame instead, so that the
+//   caller doesn't have to wait for painting to finish.
+// Arguments:
+// - invalidate - applies the invalidation to an engine. It may run later, on
+//      another thread, so it must not refer to anything on the caller's stack.
+// Return Value:
+// - <none>
+void Renderer::_InvalidateEngines(std::function<void(IRenderEngine&)> invalidate)
+{
+    try
+    {
+        std::lock_guard<std::mutex> lock{ _invalidationLock };
+
+        if (_painting)
+        {
+            _pendingInvalidations.emplace_back(std::move(invalidate));
+        }
+        else
+        {
+            // Keep the invalidations in the order they came in.
+            _ApplyPendingInvalidations();
+
+            for (IRenderEngine* const pEngine : _rgpEngines)
+            {
+                invalidate(*pEngine);
+            }
+        }
+    }
+    CATCH_LOG();
+}
+
+// Routine Description:
+// - Passes on the invalidations that were saved while a frame was being painted.
+// - The caller must hold _invalidationLock.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Renderer::_ApplyPendingInvalidations()
+{
+    for (const auto& invalidate : _pendingInvalidations)
+    {
+        for (IRenderEngine* const pEngine : _rgpEngines)
+        {
+            invalidate(*pEngine);
+        }
+    }
+    _pendingInvalidations.clear();
+}
+
+// Routine Description:
+// - Marks whether a frame is being painted. Just before a frame starts, the
+//   engines are brought up to date with any invalidations that were saved.
+// Arguments:
+// - painting - true when a frame is starting, false when it's finished
+// Return Value:
+// - <none>
+void Renderer::_SetPainting(const bool painting)
+{
+    std::lock_guard<std::mutex> lock{ _invalidationLock };
+
+    if (painting)
+    {
+        _ApplyPendingInvalidations();
+    }
+    _painting = painting;
+}
+
 // Routine Description:
 // - Called when the system has requested we redraw a portion of the console.
 // Arguments:
@@ -154,8 +342,9 @@ void Renderer::_NotifyPaintFrame()
 // - <none>
 void Renderer::TriggerSystemRedraw(const RECT* const prcDirtyClient)
 {
-    std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-        LOG_IF_FAILED(pEngine->InvalidateSystem(prcDirtyClient));
+    const RECT rcDirtyClient = *prcDirtyClient;
+    _InvalidateEngines([rcDirtyClient](IRenderEngine& engine) {
+        LOG_IF_FAILED(engine.InvalidateSystem(&rcDirtyClient));
     });
 
     _NotifyPaintFrame();
@@ -175,8 +364,8 @@ void Renderer::TriggerRedraw(const Viewport& region)
     if (view.TrimToViewport(&srUpdateRegion))
     {
         view.ConvertToOrigin(&srUpdateRegion);
-        std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-            LOG_IF_FAILED(pEngine->Invalidate(&srUpdateRegion));
+        _InvalidateEngines([srUpdateRegion](IRenderEngine& engine) {
+            LOG_IF_FAILED(engine.Invalidate(&srUpdateRegion));
         });
 
         _NotifyPaintFrame();
@@ -211,17 +400,18 @@ void Renderer::TriggerRedrawCursor(const COORD* const pcoord)
     if (view.IsInBounds(updateCoord))
     {
         view.ConvertToOrigin(&updateCoord);
-        for (IRenderEngine* pEngine : _rgpEngines)
-        {
-            LOG_IF_FAILED(pEngine->InvalidateCursor(&updateCoord));
+        const bool isDoubleWidth = _pData->IsCursorDoubleWidth();
+        _InvalidateEngines([updateCoord, isDoubleWidth](IRenderEngine& engine) {
+            LOG_IF_FAILED(engine.InvalidateCursor(&updateCoord));
 
             // Double-wide cursors need to invalidate the right half as well.
-            if (_pData->IsCursorDoubleWidth())
+            if (isDoubleWidth)
             {
-                updateCoord.X++;
-                LOG_IF_FAILED(pEngine->InvalidateCursor(&updateCoord));
+                COORD rightHalf = updateCoord;
+                rightHalf.X++;
+                LOG_IF_FAILED(engine.InvalidateCursor(&rightHalf));
             }
-        }
+        });
 
         _NotifyPaintFrame();
     }
@@ -236,8 +426,8 @@ void Renderer::TriggerRedrawCursor(const COORD* const pcoord)
 // - <none>
 void Renderer::TriggerRedrawAll()
 {
-    std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-        LOG_IF_FAILED(pEngine->InvalidateAll());
+    _InvalidateEngines([](IRenderEngine& engine) {
+        LOG_IF_FAILED(engine.InvalidateAll());
     });
 
     _NotifyPaintFrame();
@@ -259,12 +449,16 @@ void Renderer::TriggerTeardown()
     for (IRenderEngine* const pEngine : _rgpEngines)
     {
         bool fEngineRequestsRepaint = false;
-        HRESULT hr = pEngine->PrepareForTeardown(&fEngineRequestsRepaint);
+        HRESULT hr = S_OK;
+        {
+            std::lock_guard<std::mutex> paintLock{ _paintLock };
+            hr = pEngine->PrepareForTeardown(&fEngineRequestsRepaint);
+        }
         LOG_IF_FAILED(hr);
 
         if (SUCCEEDED(hr) && fEngineRequestsRepaint)
         {
-            LOG_IF_FAILED(_PaintFrameForEngine(pEngine));
+            _PaintFrameForEngines(pEngine);
         }
     }
 }
@@ -282,9 +476,9 @@ void Renderer::TriggerSelection()
         // Get selection rectangles
         const auto rects = _GetSelectionRects();
 
-        std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-            LOG_IF_FAILED(pEngine->InvalidateSelection(_previousSelection));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(rects));
+        _InvalidateEngines([previous = _previousSelection, rects](IRenderEngine& engine) {
+            LOG_IF_FAILED(engine.InvalidateSelection(previous));
+            LOG_IF_FAILED(engine.InvalidateSelection(rects));
         });
 
         _previousSelection = rects;
@@ -309,9 +503,9 @@ bool Renderer::_CheckViewportAndScroll()
     coordDelta.X = srOldViewport.Left - srNewViewport.Left;
     coordDelta.Y = srOldViewport.Top - srNewViewport.Top;
 
-    std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-        LOG_IF_FAILED(pEngine->UpdateViewport(srNewViewport));
-        LOG_IF_FAILED(pEngine->InvalidateScroll(&coordDelta));
+    _InvalidateEngines([srNewViewport, coordDelta](IRenderEngine& engine) {
+        LOG_IF_FAILED(engine.UpdateViewport(srNewViewport));
+        LOG_IF_FAILED(engine.InvalidateScroll(&coordDelta));
     });
     _srViewportPrevious = srNewViewport;
 
@@ -344,8 +538,9 @@ void Renderer::TriggerScroll()
 // - <none>
 void Renderer::TriggerScroll(const COORD* const pcoordDelta)
 {
-    std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-        LOG_IF_FAILED(pEngine->InvalidateScroll(pcoordDelta));
+    const COORD coordDelta = *pcoordDelta;
+    _InvalidateEngines([coordDelta](IRenderEngine& engine) {
+        LOG_IF_FAILED(engine.InvalidateScroll(&coordDelta));
     });
 
     _NotifyPaintFrame();
@@ -363,12 +558,17 @@ void Renderer::TriggerCircling()
     for (IRenderEngine* const pEngine : _rgpEngines)
     {
         bool fEngineRequestsRepaint = false;
-        HRESULT hr = pEngine->InvalidateCircling(&fEngineRequestsRepaint);
+        HRESULT hr = S_OK;
+        {
+            // This needs an answer now, so wait for any frame that's being painted.
+            std::lock_guard<std::mutex> paintLock{ _paintLock };
+            hr = pEngine->InvalidateCircling(&fEngineRequestsRepaint);
+        }
         LOG_IF_FAILED(hr);
 
         if (SUCCEEDED(hr) && fEngineRequestsRepaint)
         {
-            LOG_IF_FAILED(_PaintFrameForEngine(pEngine));
+            _PaintFrameForEngines(pEngine);
         }
     }
 }
@@ -383,23 +583,21 @@ void Renderer::TriggerCircling()
 void Renderer::TriggerTitleChange()
 {
     const std::wstring newTitle = _pData->GetConsoleTitle();
-    for (IRenderEngine* const pEngine : _rgpEngines)
-    {
-        LOG_IF_FAILED(pEngine->InvalidateTitle(newTitle));
-    }
+    _InvalidateEngines([newTitle](IRenderEngine& engine) {
+        LOG_IF_FAILED(engine.InvalidateTitle(newTitle));
+    });
     _NotifyPaintFrame();
 }
 
 // Routine Description:
 // - Update the title for a particular engine.
 // Arguments:
-// - pEngine: the engine to update the title for.
+// - frame: the frame of the engine to update the title for.
 // Return Value:
 // - the HRESULT of the underlying engine's UpdateTitle call.
-HRESULT Renderer::_PaintTitle(IRenderEngine* const pEngine)
+HRESULT Renderer::_PaintTitle(const EngineFrame& frame)
 {
-    const std::wstring newTitle = _pData->GetConsoleTitle();
-    return pEngine->UpdateTitle(newTitle);
+    return frame.engine->UpdateTitle(frame.snapshot.title);
 }
 
 // Routine Description:
@@ -412,14 +610,33 @@ HRESULT Renderer::_PaintTitle(IRenderEngine* const pEngine)
 // - <none>
 void Renderer::TriggerFontChange(const int iDpi, const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo)
 {
-    std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-        LOG_IF_FAILED(pEngine->UpdateDpi(iDpi));
-        LOG_IF_FAILED(pEngine->UpdateFont(FontInfoDesired, FontInfo));
-    });
+    {
+        // The caller needs the font back, so wait for any frame that's being painted.
+        std::lock_guard<std::mutex> paintLock{ _paintLock };
+        std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
+            LOG_IF_FAILED(pEngine->UpdateDpi(iDpi));
+            LOG_IF_FAILED(pEngine->UpdateFont(FontInfoDesired, FontInfo));
+        });
+    }
 
     _NotifyPaintFrame();
 }
 
+// Routine Description:
+// - Changes an engine's settings, like the size of its window, that it also uses
+//   to paint. Frames are painted after the console lock has been let go of, so
+//   holding that isn't enough to keep the change from landing mid-frame. This
+//   waits for any frame that's being painted instead.
+// Arguments:
+// - update - Makes the change to the engine.
+// Return Value:
+// - <none>
+void Renderer::UpdateEngine(const std::function<void()>& update)
+{
+    std::lock_guard<std::mutex> paintLock{ _paintLock };
+    update();
+}
+
 // Routine Description:
 // - Get the information on what font we would be using if we decided to create a font with the given parameters
 // - This is for use with speculative calculations.
@@ -446,6 +663,7 @@ HRESULT Renderer::GetProposedFont(const int iDpi, const FontInfoDesired& FontInf
     //      Only return the result of the successful one if it's not S_FALSE (which is the VT renderer)
     // TODO: 14560740 - The Window might be able to get at this info in a more sane manner
     FAIL_FAST_IF(!(_rgpEngines.size() <= 2));
+    std::lock_guard<std::mutex> paintLock{ _paintLock };
     for (IRenderEngine* const pEngine : _rgpEngines)
     {
         const HRESULT hr = LOG_IF_FAILED(pEngine->GetProposedFont(FontInfoDesired, FontInfo, iDpi));
@@ -478,6 +696,7 @@ bool Renderer::IsGlyphWideByFont(const std::wstring_view glyph)
     //      Only return the result of the successful one if it's not S_FALSE (which is the VT renderer)
     // TODO: 14560740 - The Window might be able to get at this info in a more sane manner
     FAIL_FAST_IF(!(_rgpEngines.size() <= 2));
+    std::lock_guard<std::mutex> paintLock{ _paintLock };
     for (IRenderEngine* const pEngine : _rgpEngines)
     {
         const HRESULT hr = LOG_IF_FAILED(pEngine->IsGlyphWideByFont(glyph, &fIsFullWidth));
@@ -516,50 +735,76 @@ void Renderer::WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs)
 }
 
 // Routine Description:
-// - Paint helper to fill in the background color of the invalid area within the frame.
+// - Copies everything the frame needs out of the console, so that it can be
+//   painted after the console has been unlocked.
+// - Only the parts of the buffer that the engine has marked dirty are copied.
 // Arguments:
-// - <none>
+// - frame - the frame of the engine to copy for. The engine must have started painting.
 // Return Value:
-// - <none>
+// - S_OK, or an error if the snapshot couldn't be taken.
 [[nodiscard]]
-HRESULT Renderer::_PaintBackground(_In_ IRenderEngine* const pEngine)
+HRESULT Renderer::_SnapshotFrame(EngineFrame& frame) noexcept
 {
-    return pEngine->PaintBackground();
+    try
+    {
+        auto& snapshot = frame.snapshot;
+        snapshot.Clear();
+
+        snapshot.defaultBrushes = _GetBrushes(_pData->GetDefaultBrushColors());
+        snapshot.isGridLineDrawingAllowed = _pData->IsGridLineDrawingAllowed();
+
+        _SnapshotBufferOutput(frame);
+        _SnapshotOverlays(frame);
+        _SnapshotSelection(frame);
+        _SnapshotCursor(snapshot);
+
+        snapshot.title = _pData->GetConsoleTitle();
+
+        return S_OK;
+    }
+    CATCH_RETURN();
 }
 
 // Routine Description:
-// - Paint helper to copy the primary console buffer text onto the screen.
+// - Snapshot helper to copy the primary console buffer text out for painting.
 // - This portion primarily handles figuring the current viewport, comparing it/trimming it versus the invalid portion of the frame, and queuing up, row by row, which pieces of text need to be further processed.
 // - See also: Helper functions that seperate out each complexity of text rendering.
 // Arguments:
-// - <none>
+// - frame - the frame of the engine to copy for
 // Return Value:
 // - <none>
-void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
+void Renderer::_SnapshotBufferOutput(EngineFrame& frame)
 {
     // This is the subsection of the entire screen buffer that is currently being presented.
     // It can move left/right or top/bottom depending on how the viewport is scrolled
     // relative to the entire buffer.
     const auto view = _pData->GetViewport();
 
-    // This is effectively the number of cells on the visible screen that need to be redrawn.
+    // Retrieve the text buffer so we can read information out of it.
+    const auto& buffer = _pData->GetTextBuffer();
+
+    // This is effectively the set of cells on the visible screen that need to be redrawn.
     // The origin is always 0, 0 because it represents the screen itself, not the underlying buffer.
-    auto dirty = Viewport::FromInclusive(pEngine->GetDirtyRectInChars());
+    // Engines that track more than one dirty region give us each of them, so
+    // that we don't redraw the rows in between.
+    for (const auto& dirtyRect : frame.engine->GetDirtyArea())
+    {
+        auto dirty = Viewport::FromInclusive(dirtyRect);
 
-    // Shift the origin of the dirty region to match the underlying buffer so we can
-    // compare the two regions directly for intersection.
-    dirty = Viewport::Offset(dirty, view.Origin());
+        // Shift the origin of the dirty region to match the underlying buffer so we can
+        // compare the two regions directly for intersection.
+        dirty = Viewport::Offset(dirty, view.Origin());
 
-    // The intersection between what is dirty on the screen (in need of repaint)
-    // and what is supposed to be visible on the screen (the viewport) is what
-    // we need to walk through line-by-line and repaint onto the screen.
-    const auto redraw = Viewport::Intersect(dirty, view);
+        // The intersection between what is dirty on the screen (in need of repaint)
+        // and what is supposed to be visible on the screen (the viewport) is what
+        // we need to walk through line-by-line and repaint onto the screen.
+        const auto redraw = Viewport::Intersect(dirty, view);
 
-    // Shortcut: don't bother redrawing if the width is 0.
-    if (redraw.Width() > 0)
-    {
-        // Retrieve the text buffer so we can read information out of it.
-        const auto& buffer = _pData->GetTextBuffer();
+        // Shortcut: don't bother redrawing if the width is 0.
+        if (redraw.Width() <= 0)
+        {
+            continue;
+        }
 
         // Now walk through each row of text that we need to redraw.
         for (auto row = redraw.Top(); row < redraw.BottomExclusive(); row++)
@@ -575,153 +820,209 @@ void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
             // This means that we need 14,27 out of the backing buffer to fill in the 1,1 cell of the screen.
             const auto screenLine = Viewport::Offset(bufferLine, -view.Origin());
 
-            // Retrieve the cell information iterator limited to just this line we want to redraw.
-            auto it = buffer.GetCellDataAt(bufferLine.Origin(), bufferLine);
-
-            // Ask the helper to paint through this specific line.
-            _PaintBufferOutputHelper(pEngine, it, screenLine.Origin());
+            // Ask the helper to copy out this specific line, straight from the row that holds it.
+            _SnapshotBufferRow(frame.snapshot,
+                               buffer.GetRowByOffset(row),
+                               bufferLine.Left(),
+                               bufferLine.RightExclusive(),
+                               screenLine.Origin());
         }
     }
 }
 
-void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
-                                        TextBufferCellIterator it,
-                                        const COORD target)
+// Routine Description:
+// - Snapshot helper that copies part of one row of text, split into runs of the same color.
+// - The text comes straight out of the row's cells, and the colors out of its
+//   attribute runs, so each attribute is only looked at once per run rather than once per cell.
+// Arguments:
+// - snapshot - the snapshot to copy the row into
+// - row - the row to copy from
+// - left - the first column to copy
+// - right - the column just past the last one to copy
+// - target - where on the screen the first column goes
+// Return Value:
+// - <none>
+void Renderer::_SnapshotBufferRow(FrameSnapshot& snapshot,
+                                  const ROW& row,
+                                  const size_t left,
+                                  const size_t right,
+                                  const COORD target)
 {
-    // If we have valid data, let's figure out how to draw it.
-    if (it)
+    const auto& charRow = row.GetCharRow();
+    const auto& attrRow = row.GetAttrRow();
+    const size_t end = std::min(right, charRow.size());
+    const auto cells = charRow.cbegin();
+
+    // The run of text that's being built up, and where on the screen it starts.
+    const TextAttribute* runAttr = nullptr;
+    COORD runTarget = target;
+    size_t runColumns = 0;
+
+    // The next column to copy. A wide glyph covers two columns, so this can
+    //      land partway into the next attribute run, or past the last column.
+    size_t column = left;
+
+    size_t attrRunBegin = 0;
+    for (const auto& idRun : attrRow.GetIdRuns())
     {
-        // TODO: MSFT: 20961091 -  This is a perf issue. Instead of rebuilding this and allocing memory to hold the reinterpretation,
-        // we should have an iterator/view adapter for the rendering.
-        // That would probably also eliminate the RenderData needing to give us the entire TextBuffer as well...
-        // Retrieve the iterator for one line of information.
-        std::vector<Cluster> clusters;
-        size_t cols = 0;
+        if (attrRunBegin >= end)
+        {
+            break;
+        }
 
-        // Retrieve the first color.
-        auto color = it->TextAttr();
+        const size_t attrRunEnd = std::min(attrRunBegin + idRun.length, end);
+        attrRunBegin += idRun.length;
 
-        // And hold the point where we should start drawing.
-        auto screenPoint = target;
+        if (column >= attrRunEnd)
+        {
+            continue;
+        }
 
-        // This outer loop will continue until we reach the end of the text we are trying to draw.
-        while (it)
+        // When the color changes, the run so far is done.
+        const auto& attr = attrRow.GetAttrById(idRun.id);
+        if (runAttr != nullptr && *runAttr != attr)
         {
-            // Hold onto the current run color right here for the length of the outer loop.
-            // We'll be changing the persistent one as we run through the inner loops to detect
-            // when a run changes, but we will still need to know this color at the bottom
-            // when we go to draw gridlines for the length of the run.
-            const auto currentRunColor = color;
+            snapshot.FinishRun(_GetBrushes(*runAttr), s_GetGridlines(*runAttr), runTarget);
+            runTarget.X += gsl::narrow<SHORT>(runColumns);
+            runColumns = 0;
+        }
+        runAttr = &attr;
 
-            // Update the drawing brushes with our color.
-            THROW_IF_FAILED(_UpdateDrawingBrushes(pEngine, currentRunColor, false));
+        // Walk through the cells and turn them into rendering clusters.
+        while (column < attrRunEnd)
+        {
+            const auto& cell = cells[column];
+            const size_t columnCount = cell.DbcsAttr().IsLeading() ? 2 : 1;
 
-            // Advance the point by however many columns we've just outputted and reset the accumulator.
-            screenPoint.X += gsl::narrow<SHORT>(cols);
-            cols = 0;
+            if (cell.DbcsAttr().IsGlyphStored())
+            {
+                snapshot.AppendCluster(charRow.GlyphAt(column), columnCount);
+            }
+            else
+            {
+                snapshot.AppendCluster({ &cell.Char(), 1 }, columnCount);
+            }
 
-            // Ensure that our cluster vector is clear.
-            clusters.clear();
+            column += columnCount;
+            runColumns += columnCount;
+        }
+    }
 
-            // This inner loop will accumulate clusters until the color changes.
-            // When the color changes, it will save the new color off and break.
-            do
-            {
-                if (color != it->TextAttr())
-                {
-                    color = it->TextAttr();
-                    break;
-                }
+    if (runAttr != nullptr)
+    {
+        snapshot.FinishRun(_GetBrushes(*runAttr), s_GetGridlines(*runAttr), runTarget);
+    }
+}
 
-                // Walk through the text data and turn it into rendering clusters.
-                clusters.emplace_back(it->Chars(), it->Columns());
+// Routine Description:
+// - Snapshot helper to copy out the text that overlays the main buffer to provide user interactivity regions
+// - This supports IME composition.
+// Arguments:
+// - frame - The frame of the render engine that we're targeting.
+// - overlay - The overlay to copy.
+// Return Value:
+// - <none>
+void Renderer::_SnapshotOverlay(EngineFrame& frame,
+                                const RenderOverlay& overlay)
+{
+    try
+    {
+        // Now get the overlay's viewport and adjust it to where it is supposed to be relative to the window.
 
-                // Advance the cluster and column counts.
-                const auto columnCount = clusters.back().GetColumns();
-                it += columnCount > 0 ? columnCount : 1; // prevent infinite loop for no visible columns
-                cols += columnCount;
+        SMALL_RECT srCaView = overlay.region.ToInclusive();
+        srCaView.Top += overlay.origin.Y;
+        srCaView.Bottom += overlay.origin.Y;
+        srCaView.Left += overlay.origin.X;
+        srCaView.Right += overlay.origin.X;
 
-            } while (it);
+        // Set it up in a Viewport helper structure and trim it the IME viewport to be within the full console viewport.
+        Viewport viewConv = Viewport::FromInclusive(srCaView);
+
+        SMALL_RECT srDirty = frame.engine->GetDirtyRectInChars();
 
-            // Do the painting.
-            // TODO: Calculate when trim left should be TRUE
-            THROW_IF_FAILED(pEngine->PaintBufferLine({ clusters.data(), clusters.size() }, screenPoint, false));
+        // Dirty is an inclusive rectangle, but oddly enough the IME was an exclusive one, so correct it.
+        srDirty.Bottom++;
+        srDirty.Right++;
 
-            // If we're allowed to do grid drawing, draw that now too (since it will be coupled with the color data)
-            if (_pData->IsGridLineDrawingAllowed())
+        if (viewConv.TrimToViewport(&srDirty))
+        {
+            Viewport viewDirty = Viewport::FromInclusive(srDirty);
+
+            for (SHORT iRow = viewDirty.Top(); iRow < viewDirty.BottomInclusive(); iRow++)
             {
-                // We're only allowed to draw the grid lines under certain circumstances.
-                _PaintBufferOutputGridLineHelper(pEngine, currentRunColor, cols, screenPoint);
+                const COORD target{ viewDirty.Left(), iRow };
+                const auto source = target - overlay.origin;
+
+                // The overlay's line runs from the source to the right edge of its buffer.
+                const auto overlaySize = overlay.buffer.GetSize();
+                THROW_HR_IF(E_INVALIDARG, !overlaySize.IsInBounds(source));
+
+                _SnapshotBufferRow(frame.snapshot,
+                                   overlay.buffer.GetRowByOffset(source.Y),
+                                   source.X,
+                                   overlaySize.RightExclusive(),
+                                   target);
             }
         }
     }
+    CATCH_LOG();
 }
 
-// Method Description:
-// - Generates a IRenderEngine::GridLines structure from the values in the
-//      provided textAttribute
+// Routine Description:
+// - Snapshot helper to copy out the composition string portion of the IME.
+// - This specifically is the string that appears at the cursor on the input line showing what the user is currently typing.
+// - The overlays are painted after the buffer text, so they must be copied after it too.
 // Arguments:
-// - textAttribute: the TextAttribute to generate GridLines from.
+// - frame - the frame of the engine to copy for
 // Return Value:
-// - a GridLines containing all the gridline info from the TextAtribute
-IRenderEngine::GridLines Renderer::s_GetGridlines(const TextAttribute& textAttribute) noexcept
+// - <none>
+void Renderer::_SnapshotOverlays(EngineFrame& frame)
 {
-    // Convert console grid line representations into rendering engine enum representations.
-    IRenderEngine::GridLines lines = IRenderEngine::GridLines::None;
-
-    if (textAttribute.IsTopHorizontalDisplayed())
-    {
-        lines |= IRenderEngine::GridLines::Top;
-    }
-
-    if (textAttribute.IsBottomHorizontalDisplayed())
-    {
-        lines |= IRenderEngine::GridLines::Bottom;
-    }
-
-    if (textAttribute.IsLeftVerticalDisplayed())
+    try
     {
-        lines |= IRenderEngine::GridLines::Left;
-    }
+        const auto overlays = _pData->GetOverlays();
 
-    if (textAttribute.IsRightVerticalDisplayed())
-    {
-        lines |= IRenderEngine::GridLines::Right;
+        for (const auto& overlay : overlays)
+        {
+            _SnapshotOverlay(frame, overlay);
+        }
     }
-    return lines;
+    CATCH_LOG();
 }
 
 // Routine Description:
-// - Paint helper for primary buffer output function.
-// - This particular helper sets up the various box drawing lines that can be inscribed around any character in the buffer (left, right, top, underline).
-// - See also: All related helpers and buffer output functions.
+// - Snapshot helper to copy out the parts of the selected area that need painting.
 // Arguments:
-// - textAttribute - The line/box drawing attributes to use for this particular run.
-// - cchLine - The length of both pwsLine and pbKAttrsLine.
-// - coordTarget - The X/Y coordinate position in the buffer which we're attempting to start rendering from.
+// - frame - the frame of the engine to copy for
 // Return Value:
 // - <none>
-void Renderer::_PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine,
-                                                const TextAttribute textAttribute,
-                                                const size_t cchLine,
-                                                const COORD coordTarget)
+void Renderer::_SnapshotSelection(EngineFrame& frame)
 {
-    const COLORREF rgb = _pData->GetForegroundColor(textAttribute);
-
-    // Convert console grid line representations into rendering engine enum representations.
-    IRenderEngine::GridLines lines = Renderer::s_GetGridlines(textAttribute);
+    try
+    {
+        SMALL_RECT srDirty = frame.engine->GetDirtyRectInChars();
+        Viewport dirtyView = Viewport::FromInclusive(srDirty);
 
-    // Draw the lines
-    LOG_IF_FAILED(pEngine->PaintBufferGridLines(lines, rgb, cchLine, coordTarget));
+        // Get selection rectangles
+        const auto rectangles = _GetSelectionRects();
+        for (auto rect : rectangles)
+        {
+            if (dirtyView.TrimToViewport(&rect))
+            {
+                frame.snapshot.selection.push_back(rect);
+            }
+        }
+    }
+    CATCH_LOG();
 }
 
 // Routine Description:
-// - Paint helper to draw the cursor within the buffer.
+// - Snapshot helper to copy out how to draw the cursor, if it's visible.
 // Arguments:
-// - <none>
+// - snapshot - the snapshot to copy the cursor into
 // Return Value:
 // - <none>
-void Renderer::_PaintCursor(_In_ IRenderEngine* const pEngine)
+void Renderer::_SnapshotCursor(FrameSnapshot& snapshot)
 {
     if (_pData->IsCursorVisible())
     {
@@ -745,116 +1046,138 @@ void Renderer::_PaintCursor(_In_ IRenderEngine* const pEngine)
         options.cursorColor = cursorColor;
         options.isOn = _pData->IsCursorOn();
 
-        // Draw it within the viewport
-        LOG_IF_FAILED(pEngine->PaintCursor(options));
-
+        snapshot.cursor = options;
     }
 }
 
 // Routine Description:
-// - Paint helper to draw text that overlays the main buffer to provide user interactivity regions
-// - This supports IME composition.
+// - Looks up the colors to draw text with the given attributes in.
+// Arguments:
+// - textAttribute - The 16 color foreground/background combination to look up
+// Return Value:
+// - the brushes to draw with
+FrameSnapshot::Brushes Renderer::_GetBrushes(const TextAttribute& textAttribute) const noexcept
+{
+    FrameSnapshot::Brushes brushes;
+    brushes.foreground = _pData->GetForegroundColor(textAttribute);
+    brushes.background = _pData->GetBackgroundColor(textAttribute);
+    brushes.legacyAttributes = textAttribute.GetLegacyAttributes();
+    brushes.isBold = textAttribute.IsBold();
+    return brushes;
+}
+
+// Routine Description:
+// - Paint helper to fill in the background color of the invalid area within the frame.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+[[nodiscard]]
+HRESULT Renderer::_PaintBackground(_In_ IRenderEngine* const pEngine)
+{
+    return pEngine->PaintBackground();
+}
+
+// Routine Description:
+// - Paint helper to copy the snapshot of the buffer text, and the overlays above it, onto the screen.
+// - Each run is painted with its own brushes, along with its grid lines if we're allowed to draw them.
 // Arguments:
-// - engine - The render engine that we're targeting.
-// - overlay - The overlay to draw.
+// - frame - the frame of the engine to paint
 // Return Value:
 // - <none>
-void Renderer::_PaintOverlay(IRenderEngine& engine,
-                             const RenderOverlay& overlay)
+void Renderer::_PaintBufferOutput(EngineFrame& frame)
 {
-    try
+    IRenderEngine* const pEngine = frame.engine;
+    const auto& runs = frame.snapshot.GetRuns();
+    for (size_t i = 0; i < runs.size(); ++i)
     {
-        // First get the screen buffer's viewport.
-        Viewport view = _pData->GetViewport();
+        const auto& run = runs[i];
 
-        // Now get the overlay's viewport and adjust it to where it is supposed to be relative to the window.
+        // Update the drawing brushes with our color.
+        THROW_IF_FAILED(_UpdateDrawingBrushes(pEngine, run.brushes, false));
 
-        SMALL_RECT srCaView = overlay.region.ToInclusive();
-        srCaView.Top += overlay.origin.Y;
-        srCaView.Bottom += overlay.origin.Y;
-        srCaView.Left += overlay.origin.X;
-        srCaView.Right += overlay.origin.X;
+        frame.snapshot.GetClusters(i, frame.clusters);
 
-        // Set it up in a Viewport helper structure and trim it the IME viewport to be within the full console viewport.
-        Viewport viewConv = Viewport::FromInclusive(srCaView);
+        // Do the painting.
+        // TODO: Calculate when trim left should be TRUE
+        THROW_IF_FAILED(pEngine->PaintBufferLine({ frame.clusters.data(), frame.clusters.size() }, run.target, false));
 
-        SMALL_RECT srDirty = engine.GetDirtyRectInChars();
+        // If we're allowed to do grid drawing, draw that now too (since it will be coupled with the color data)
+        if (frame.snapshot.isGridLineDrawingAllowed)
+        {
+            LOG_IF_FAILED(pEngine->PaintBufferGridLines(run.lines, run.brushes.foreground, run.columns, run.target));
+        }
+    }
+}
 
-        // Dirty is an inclusive rectangle, but oddly enough the IME was an exclusive one, so correct it.
-        srDirty.Bottom++;
-        srDirty.Right++;
+// Method Description:
+// - Generates a IRenderEngine::GridLines structure from the values in the
+//      provided textAttribute
+// Arguments:
+// - textAttribute: the TextAttribute to generate GridLines from.
+// Return Value:
+// - a GridLines containing all the gridline info from the TextAtribute
+IRenderEngine::GridLines Renderer::s_GetGridlines(const TextAttribute& textAttribute) noexcept
+{
+    // Convert console grid line representations into rendering engine enum representations.
+    IRenderEngine::GridLines lines = IRenderEngine::GridLines::None;
 
-        if (viewConv.TrimToViewport(&srDirty))
-        {
-            Viewport viewDirty = Viewport::FromInclusive(srDirty);
+    if (textAttribute.IsTopHorizontalDisplayed())
+    {
+        lines |= IRenderEngine::GridLines::Top;
+    }
 
-            for (SHORT iRow = viewDirty.Top(); iRow < viewDirty.BottomInclusive(); iRow++)
-            {
-                const COORD target{ viewDirty.Left(), iRow };
-                const auto source = target - overlay.origin;
+    if (textAttribute.IsBottomHorizontalDisplayed())
+    {
+        lines |= IRenderEngine::GridLines::Bottom;
+    }
 
-                auto it = overlay.buffer.GetCellLineDataAt(source);
+    if (textAttribute.IsLeftVerticalDisplayed())
+    {
+        lines |= IRenderEngine::GridLines::Left;
+    }
 
-                _PaintBufferOutputHelper(&engine, it, target);
-            }
-        }
+    if (textAttribute.IsRightVerticalDisplayed())
+    {
+        lines |= IRenderEngine::GridLines::Right;
     }
-    CATCH_LOG();
+    return lines;
 }
 
 // Routine Description:
-// - Paint helper to draw the composition string portion of the IME.
-// - This specifically is the string that appears at the cursor on the input line showing what the user is currently typing.
-// - See also: Generic Paint IME helper method.
+// - Paint helper to draw the cursor within the buffer.
 // Arguments:
-// - <none>
+// - frame - the frame of the engine to paint
 // Return Value:
 // - <none>
-void Renderer::_PaintOverlays(_In_ IRenderEngine* const pEngine)
+void Renderer::_PaintCursor(const EngineFrame& frame)
 {
-    try
+    if (frame.snapshot.cursor.has_value())
     {
-        const auto overlays = _pData->GetOverlays();
-
-        for (const auto& overlay : overlays)
-        {
-            _PaintOverlay(*pEngine, overlay);
-        }
+        // Draw it within the viewport
+        LOG_IF_FAILED(frame.engine->PaintCursor(frame.snapshot.cursor.value()));
     }
-    CATCH_LOG();
 }
 
 // Routine Description:
 // - Paint helper to draw the selected area of the window.
 // Arguments:
-// - <none>
+// - frame - the frame of the engine to paint
 // Return Value:
 // - <none>
-void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
+void Renderer::_PaintSelection(const EngineFrame& frame)
 {
-    try
+    for (const auto& rect : frame.snapshot.selection)
     {
-        SMALL_RECT srDirty = pEngine->GetDirtyRectInChars();
-        Viewport dirtyView = Viewport::FromInclusive(srDirty);
-
-        // Get selection rectangles
-        const auto rectangles = _GetSelectionRects();
-        for (auto rect : rectangles)
-        {
-            if (dirtyView.TrimToViewport(&rect))
-            {
-                LOG_IF_FAILED(pEngine->PaintSelection(rect));
-            }
-        }
+        LOG_IF_FAILED(frame.engine->PaintSelection(rect));
     }
-    CATCH_LOG();
 }
 
 // Routine Description:
-// - Helper to convert the text attributes to actual RGB colors and update the rendering pen/brush within the rendering engine before the next draw operation.
+// - Helper to update the rendering pen/brush within the rendering engine before the next draw operation.
 // Arguments:
 // - pEngine - Which engine is being updated
-// - textAttributes - The 16 color foreground/background combination to set
+// - brushes - The colors to set, already looked up in the color table
 // - isSettingDefaultBrushes - Alerts that the default brushes are being set which will
 //                             impact whether or not to include the hung window/erase window brushes in this operation
 //                             and can affect other draw state that wants to know the default color scheme.
@@ -862,16 +1185,11 @@ void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
 // Return Value:
 // - <none>
 [[nodiscard]]
-HRESULT Renderer::_UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine, const TextAttribute textAttributes, const bool isSettingDefaultBrushes)
+HRESULT Renderer::_UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine, const FrameSnapshot::Brushes brushes, const bool isSettingDefaultBrushes)
 {
-    const COLORREF rgbForeground = _pData->GetForegroundColor(textAttributes);
-    const COLORREF rgbBackground = _pData->GetBackgroundColor(textAttributes);
-    const WORD legacyAttributes = textAttributes.GetLegacyAttributes();
-    const bool isBold = textAttributes.IsBold();
-
     // The last color need's to be each engine's responsibility. If it's local to this function,
     //      then on the next engine we might not update the color.
-    RETURN_IF_FAILED(pEngine->UpdateDrawingBrushes(rgbForeground, rgbBackground, legacyAttributes, isBold, isSettingDefaultBrushes));
+    RETURN_IF_FAILED(pEngine->UpdateDrawingBrushes(brushes.foreground, brushes.background, brushes.legacyAttributes, brushes.isBold, isSettingDefaultBrushes));
 
     return S_OK;
 }
@@ -928,5 +1246,9 @@ std::vector<SMALL_RECT> Renderer::_GetSelectionRects() const
 void Renderer::AddRenderEngine(_In_ IRenderEngine* const pEngine)
 {
     THROW_IF_NULL_ALLOC(pEngine);
+
+    std::lock_guard<std::mutex> paintLock{ _paintLock };
+    std::lock_guard<std::mutex> invalidationLock{ _invalidationLock };
+    _frames.push_back({ pEngine, {}, {}, false, false, false, S_OK });
     _rgpEngines.push_back(pEngine);
 }
@@ -21,6 +21,8 @@ Author(s):
 #include "../inc/IRenderData.hpp"
 
 #include "thread.hpp"
+#include "FrameSnapshot.hpp"
+#include "PaintWorkerPool.hpp"
 
 #include "../../buffer/out/textBuffer.hpp"
 #include "../../buffer/out/CharRow.hpp"
@@ -50,6 +52,8 @@ namespace Microsoft::Console::Render
         [[nodiscard]]
         HRESULT PaintFrame();
 
+        void UpdateEngine(const std::function<void()>& update);
+
         void TriggerSystemRedraw(const RECT* const prcDirtyClient) override;
         void TriggerRedraw(const Microsoft::Console::Types::Viewport& region) override;
         void TriggerRedraw(const COORD* const pcoord) override;
@@ -88,37 +92,80 @@ namespace Microsoft::Console::Render
         std::unique_ptr<IRenderThread> _pThread;
         bool _destructing = false;
 
+        // Held by whichever thread is painting a frame, and by anything else that
+        //      needs an engine to itself. Always taken after the console lock.
+        std::mutex _paintLock;
+
+        // Guards _painting and _pendingInvalidations. Never held for long.
+        std::mutex _invalidationLock;
+        bool _painting = false;
+        std::vector<std::function<void(IRenderEngine&)>> _pendingInvalidations;
+
+        // What the frame being painted on one engine looks like, copied out of
+        //      the console, and how painting it has gone.
+        struct EngineFrame
+        {
+            IRenderEngine* engine;
+            FrameSnapshot snapshot;
+            std::vector<Cluster> clusters;
+            bool isStarted;
+            bool isSubmitted; // to the workers, rather than painted on the calling thread
+            bool isPainted; // already, while the console was still locked
+            HRESULT hr;
+        };
+
+        // One for each engine, in the same order as _rgpEngines. Guarded by _paintLock.
+        std::deque<EngineFrame> _frames;
+
+        // Paints the engines that can paint at the same time as each other.
+        //      Declared after _frames so that it's stopped before they go away.
+        PaintWorkerPool _workers;
+
         void _NotifyPaintFrame();
 
+        void _PaintFrameForEngines(_In_opt_ IRenderEngine* const onlyEngine);
+        void _PaintEngineFrame(EngineFrame& frame) noexcept;
+
         [[nodiscard]]
-        HRESULT _PaintFrameForEngine(_In_ IRenderEngine* const pEngine);
+        HRESULT _PaintSnapshot(EngineFrame& frame) noexcept;
+
+        void _InvalidateEngines(std::function<void(IRenderEngine&)> invalidate);
+        void _ApplyPendingInvalidations();
+        void _SetPainting(const bool painting);
 
         bool _CheckViewportAndScroll();
 
         [[nodiscard]]
-        HRESULT _PaintBackground(_In_ IRenderEngine* const pEngine);
+        HRESULT _SnapshotFrame(EngineFrame& frame) noexcept;
 
-        void _PaintBufferOutput(_In_ IRenderEngine* const pEngine);
+        void _SnapshotBufferOutput(EngineFrame& frame);
 
-        void _PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
-                                      TextBufferCellIterator it,
-                                      const COORD target);
+        void _SnapshotBufferRow(FrameSnapshot& snapshot,
+                                const ROW& row,
+                                const size_t left,
+                                const size_t right,
+                                const COORD target);
 
-        static IRenderEngine::GridLines s_GetGridlines(const TextAttribute& textAttribute) noexcept;
+        void _SnapshotOverlays(EngineFrame& frame);
+        void _SnapshotOverlay(EngineFrame& frame, const RenderOverlay& overlay);
 
-        void _PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine,
-                                              const TextAttribute textAttribute,
-                                              const size_t cchLine,
-                                              const COORD coordTarget);
+        void _SnapshotSelection(EngineFrame& frame);
+        void _SnapshotCursor(FrameSnapshot& snapshot);
 
-        void _PaintSelection(_In_ IRenderEngine* const pEngine);
-        void _PaintCursor(_In_ IRenderEngine* const pEngine);
+        FrameSnapshot::Brushes _GetBrushes(const TextAttribute& textAttribute) const noexcept;
+
+        [[nodiscard]]
+        HRESULT _PaintBackground(_In_ IRenderEngine* const pEngine);
+
+        void _PaintBufferOutput(EngineFrame& frame);
+
+        static IRenderEngine::GridLines s_GetGridlines(const TextAttribute& textAttribute) noexcept;
 
-        void _PaintOverlays(_In_ IRenderEngine* const pEngine);
-        void _PaintOverlay(IRenderEngine& engine, const RenderOverlay& overlay);
+        void _PaintSelection(const EngineFrame& frame);
+        void _PaintCursor(const EngineFrame& frame);
 
         [[nodiscard]]
-        HRESULT _UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine, const TextAttribute attr, const bool isSettingDefaultBrushes);
+        HRESULT _UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine, const FrameSnapshot::Brushes brushes, const bool isSettingDefaultBrushes);
 
         [[nodiscard]]
         HRESULT _PerformScrolling(_In_ IRenderEngine* const pEngine);
@@ -129,7 +176,7 @@ namespace Microsoft::Console::Render
         std::vector<SMALL_RECT> _previousSelection;
 
         [[nodiscard]]
-        HRESULT _PaintTitle(IRenderEngine* const pEngine);
+        HRESULT _PaintTitle(const EngineFrame& frame);
 
         // Helper functions to diagnose issues with painting and layout.
         // These are only actually effective/on in Debug builds when the flag is set using an attached debugger.
@@ -16,7 +16,8 @@ RenderThread::RenderThread() :
     _hEvent(INVALID_HANDLE_VALUE),
     _hPaintCompletedEvent(INVALID_HANDLE_VALUE),
     _fKeepRunning(true),
-    _hPaintEnabledEvent(INVALID_HANDLE_VALUE)
+    _hPaintEnabledEvent(INVALID_HANDLE_VALUE),
+    _pacer()
 {
 
 }
@@ -162,18 +163,37 @@ DWORD WINAPI RenderThread::_ThreadProc()
     {
         WaitForSingleObject(_hPaintEnabledEvent, INFINITE);
         WaitForSingleObject(_hEvent, INFINITE);
+        const auto requested = FramePacer::clock::now();
 
+        // From here on, anyone disabling painting has to wait for us, either
+        //      to paint the frame or to decide not to.
         ResetEvent(_hPaintCompletedEvent);
 
+        // If we painted only a moment ago, hold off so that whatever else is
+        //      about to change lands in the same frame. Don't hold up the final paint.
+        const auto delay = _pacer.GetDelayBeforePaint(requested);
+        if (delay > FramePacer::clock::duration::zero() && _fKeepRunning)
+        {
+            Sleep(gsl::narrow_cast<DWORD>(std::chrono::ceil<std::chrono::milliseconds>(delay).count()));
+
+            // Anything that asked for a paint while we waited is covered by this one.
+            ResetEvent(_hEvent);
+
+            // Painting may have been disabled while we slept. If so, leave the
+            //      frame for when it's enabled again.
+            if (WaitForSingleObject(_hPaintEnabledEvent, 0) != WAIT_OBJECT_0)
+            {
+                SetEvent(_hEvent);
+                SetEvent(_hPaintCompletedEvent);
+                continue;
+            }
+        }
+
+        const auto start = FramePacer::clock::now();
         LOG_IF_FAILED(_pRenderer->PaintFrame());
+        _pacer.FramePainted(requested, start, FramePacer::clock::now());
 
         SetEvent(_hPaintCompletedEvent);
-
-        // extra check before we sleep since it's a "long" activity, relatively speaking.
-        if (_fKeepRunning)
-        {
-            Sleep(s_FrameLimitMilliseconds);
-        }
     }
 
     return S_OK;
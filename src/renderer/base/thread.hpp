@@ -16,6 +16,7 @@ Author(s):
 
 #include "..\inc\IRenderer.hpp"
 #include "..\inc\IRenderThread.hpp"
+#include "FramePacer.hpp"
 
 namespace Microsoft::Console::Render
 {
@@ -37,8 +38,6 @@ namespace Microsoft::Console::Render
         static DWORD WINAPI s_ThreadProc(_In_ LPVOID lpParameter);
         DWORD WINAPI _ThreadProc();
 
-        static DWORD const s_FrameLimitMilliseconds = 8;
-
         HANDLE _hThread;
         HANDLE _hEvent;
 
@@ -48,5 +47,7 @@ namespace Microsoft::Console::Render
         IRenderer* _pRenderer; // Non-ownership pointer
 
         bool _fKeepRunning;
+
+        FramePacer _pacer;
     };
 }
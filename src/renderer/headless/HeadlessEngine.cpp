@@ -0,0 +1,468 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "HeadlessEngine.hpp"
+
+#pragma hdrstop
+
+using namespace Microsoft::Console::Render;
+using namespace Microsoft::Console::Types;
+
+// Routine Description:
+// - Creates a new headless rendering engine
+// - Nothing has been painted yet, so the whole screen starts out invalid.
+// Arguments:
+// - initialViewport - the size of the "screen", in characters
+// Return Value:
+// - An instance of a headless engine.
+HeadlessEngine::HeadlessEngine(const Viewport initialViewport) :
+    RenderEngineBase(),
+    _viewport{ initialViewport },
+    _invalidRect{ initialViewport.ToOrigin() },
+    _calls{},
+    _text{},
+    _cellsPainted{ 0 },
+    _framesPainted{ 0 }
+{
+}
+
+// Routine Description:
+// - Gets the calls recorded while the last frame was painted, in the order they were made.
+// Arguments:
+// - <none>
+// Return Value:
+// - the calls. They're only valid until the next frame starts.
+const std::vector<HeadlessEngine::Call>& HeadlessEngine::GetCalls() const noexcept
+{
+    return _calls;
+}
+
+// Routine Description:
+// - Gets the text of all the lines painted in the last frame, one after the other.
+//   Each PaintBufferLine call says where its own text ends.
+// Arguments:
+// - <none>
+// Return Value:
+// - the text. It's only valid until the next frame starts.
+std::wstring_view HeadlessEngine::GetText() const noexcept
+{
+    return _text;
+}
+
+// Routine Description:
+// - Gets how many cells of text were painted in the last frame.
+// Arguments:
+// - <none>
+// Return Value:
+// - the number of cells
+size_t HeadlessEngine::GetCellsPainted() const noexcept
+{
+    return _cellsPainted;
+}
+
+// Routine Description:
+// - Gets how many frames have been painted since the engine was created.
+// Arguments:
+// - <none>
+// Return Value:
+// - the number of frames
+size_t HeadlessEngine::GetFramesPainted() const noexcept
+{
+    return _framesPainted;
+}
+
+// Routine Description:
+// - Notifies us that the console has changed the character region specified.
+// Arguments:
+// - psrRegion - Character region (SMALL_RECT) that has been changed
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::Invalidate(const SMALL_RECT* const psrRegion) noexcept
+{
+    _InvalidCombine(Viewport::FromExclusive(*psrRegion));
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that the console has changed the position of the cursor.
+// Arguments:
+// - pcoordCursor - the new position of the cursor
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::InvalidateCursor(const COORD* const pcoordCursor) noexcept
+{
+    _InvalidCombine(Viewport::FromCoord(*pcoordCursor));
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that the system has requested a particular pixel area of the
+//      client rectangle should be redrawn. There are no pixels here, so there's
+//      nothing to do.
+// Arguments:
+// - prcDirtyClient - Pixel region (RECT) that should be repainted on the next frame
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::InvalidateSystem(const RECT* const /*prcDirtyClient*/) noexcept
+{
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that the selection has changed.
+// Arguments:
+// - rectangles - Vector of rectangles to draw, line by line
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::InvalidateSelection(const std::vector<SMALL_RECT>& rectangles) noexcept
+{
+    for (const auto& rect : rectangles)
+    {
+        _InvalidCombine(Viewport::FromExclusive(rect));
+    }
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that the console is attempting to scroll the existing screen
+//      area. There's no last frame to move around, so if it has moved at all,
+//      everything is painted again.
+// Arguments:
+// - pcoordDelta - Pointer to character dimension (COORD) of the distance the
+//      console would like us to move while scrolling.
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::InvalidateScroll(const COORD* const pcoordDelta) noexcept
+{
+    if (pcoordDelta->X != 0 || pcoordDelta->Y != 0)
+    {
+        return InvalidateAll();
+    }
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that the console has changed the whole screen.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::InvalidateAll() noexcept
+{
+    _InvalidCombine(_viewport.ToOrigin());
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that we're about to circle the buffer. Nobody's going to look
+//      at the frame, so there's no need to paint it before the buffer moves.
+// Arguments:
+// - pForcePaint - receives false
+// Return Value:
+// - S_FALSE
+[[nodiscard]]
+HRESULT HeadlessEngine::InvalidateCircling(_Out_ bool* const pForcePaint) noexcept
+{
+    *pForcePaint = false;
+    return S_FALSE;
+}
+
+// Routine Description:
+// - Notifies us that we're about to be torn down. There's nothing to finish showing.
+// Arguments:
+// - pForcePaint - receives false
+// Return Value:
+// - S_FALSE
+[[nodiscard]]
+HRESULT HeadlessEngine::PrepareForTeardown(_Out_ bool* const pForcePaint) noexcept
+{
+    *pForcePaint = false;
+    return S_FALSE;
+}
+
+// Routine Description:
+// - Starts a frame, if there's anything to paint. The record of the last frame
+//      is thrown away, but its storage is kept for this one.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK, or S_FALSE if there's nothing to paint
+[[nodiscard]]
+HRESULT HeadlessEngine::StartPaint() noexcept
+{
+    if (!_invalidRect.IsValid() && !_titleChanged)
+    {
+        return S_FALSE;
+    }
+
+    _calls.clear();
+    _text.clear();
+    _cellsPainted = 0;
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Ends the frame. Everything that was invalid has been painted.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::EndPaint() noexcept
+{
+    _invalidRect = Viewport::Empty();
+    _framesPainted++;
+
+    return S_OK;
+}
+
+// Routine Description:
+// - There's nowhere to present the frame to.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::Present() noexcept
+{
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::ScrollFrame() noexcept
+{
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::PaintBackground() noexcept
+{
+    return S_OK;
+}
+
+// Routine Description:
+// - Records a line of text.
+// Arguments:
+// - clusters - text and column counts for each piece of text.
+// - coord - character coordinate target to render within viewport
+// - trimLeft - This specifies whether to trim one character width off the left
+//      side of the output. Used for drawing the right-half only of a
+//      double-wide character.
+// Return Value:
+// - S_OK or suitable HRESULT error from recording it.
+[[nodiscard]]
+HRESULT HeadlessEngine::PaintBufferLine(std::basic_string_view<Cluster> const clusters,
+                                        const COORD coord,
+                                        const bool /*trimLeft*/) noexcept
+{
+    try
+    {
+        size_t columns = 0;
+        for (const auto& cluster : clusters)
+        {
+            _text.append(cluster.GetText());
+            columns += cluster.GetColumns();
+        }
+
+        _calls.push_back({ CallType::PaintBufferLine, coord, 0, 0, columns, _text.size() });
+        _cellsPainted += columns;
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::PaintBufferGridLines(const GridLines /*lines*/,
+                                             const COLORREF /*color*/,
+                                             const size_t /*cchLine*/,
+                                             const COORD /*coordTarget*/) noexcept
+{
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::PaintSelection(const SMALL_RECT /*rect*/) noexcept
+{
+    return S_OK;
+}
+
+// Routine Description:
+// - Records where the cursor was drawn.
+// Arguments:
+// - options - Parameters that affect the way that the cursor is drawn
+// Return Value:
+// - S_OK or suitable HRESULT error from recording it.
+[[nodiscard]]
+HRESULT HeadlessEngine::PaintCursor(const IRenderEngine::CursorOptions& options) noexcept
+{
+    try
+    {
+        const size_t columns = options.fIsDoubleWidth ? 2 : 1;
+        _calls.push_back({ CallType::PaintCursor, options.coordCursor, 0, 0, columns, _text.size() });
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Records the colors the text that follows will be drawn with.
+// Arguments:
+// - colorForeground - Foreground brush color
+// - colorBackground - Background brush color
+// - legacyColorAttribute - <unused>
+// - isBold - <unused>
+// - isSettingDefaultBrushes - <unused>
+// Return Value:
+// - S_OK or suitable HRESULT error from recording it.
+[[nodiscard]]
+HRESULT HeadlessEngine::UpdateDrawingBrushes(const COLORREF colorForeground,
+                                             const COLORREF colorBackground,
+                                             const WORD /*legacyColorAttribute*/,
+                                             const bool /*isBold*/,
+                                             const bool /*isSettingDefaultBrushes*/) noexcept
+{
+    try
+    {
+        _calls.push_back({ CallType::UpdateDrawingBrushes, {}, colorForeground, colorBackground, 0, _text.size() });
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - There's no font, so whatever was asked for is fine, at one pixel per cell.
+// Arguments:
+// - fiFontInfoDesired - <unused>
+// - fiFontInfo - receives the font
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::UpdateFont(const FontInfoDesired& /*fiFontInfoDesired*/, FontInfo& fiFontInfo) noexcept
+{
+    COORD coordSize = { 0 };
+    LOG_IF_FAILED(GetFontSize(&coordSize));
+
+    fiFontInfo.SetFromEngine(fiFontInfo.GetFaceName(),
+                             fiFontInfo.GetFamily(),
+                             fiFontInfo.GetWeight(),
+                             fiFontInfo.IsTrueTypeFont(),
+                             coordSize,
+                             coordSize);
+
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::UpdateDpi(const int /*iDpi*/) noexcept
+{
+    return S_OK;
+}
+
+// Routine Description:
+// - Notifies us that the viewport may have changed. If it's changed size, the
+//      whole of the new one needs painting. Where it is in the buffer doesn't
+//      matter here, InvalidateScroll hears about that.
+// Arguments:
+// - srNewViewport - The bounds of the new viewport.
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::UpdateViewport(const SMALL_RECT srNewViewport) noexcept
+{
+    const auto newViewport = Viewport::FromInclusive(srNewViewport);
+    const bool resized = newViewport.Dimensions() != _viewport.Dimensions();
+    _viewport = newViewport;
+
+    if (resized)
+    {
+        return InvalidateAll();
+    }
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::GetProposedFont(const FontInfoDesired& /*fiFontInfoDesired*/,
+                                        FontInfo& /*fiFontInfo*/,
+                                        const int /*iDpi*/) noexcept
+{
+    return S_OK;
+}
+
+// Routine Description:
+// - Gets the area that's been invalidated since the last frame.
+// Arguments:
+// - <none>
+// Return Value:
+// - the invalid area, in characters, relative to the viewport. This is an Inclusive rect.
+SMALL_RECT HeadlessEngine::GetDirtyRectInChars()
+{
+    return _invalidRect.ToInclusive();
+}
+
+// Routine Description:
+// - The engine keeps to its own record of the frame, so it can paint on any
+//   thread, at the same time as any other engine.
+// Arguments:
+// - <none>
+// Return Value:
+// - true
+bool HeadlessEngine::CanPaintInParallel() noexcept
+{
+    return true;
+}
+
+// Routine Description:
+// - Gets the size of a cell. There are no pixels, so a cell is one of them.
+// Arguments:
+// - pFontSize - receives the size of a cell
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::GetFontSize(_Out_ COORD* const pFontSize) noexcept
+{
+    *pFontSize = { 1, 1 };
+    return S_OK;
+}
+
+// Routine Description:
+// - There's no font to ask, so no glyph is wide because of it.
+// Arguments:
+// - glyph - <unused>
+// - pResult - receives false
+// Return Value:
+// - S_OK
+[[nodiscard]]
+HRESULT HeadlessEngine::IsGlyphWideByFont(const std::wstring_view /*glyph*/, _Out_ bool* const pResult) noexcept
+{
+    *pResult = false;
+    return S_OK;
+}
+
+[[nodiscard]]
+HRESULT HeadlessEngine::_DoUpdateTitle(const std::wstring& /*newTitle*/) noexcept
+{
+    return S_OK;
+}
+
+// Routine Description:
+// - Adds an area to the one that needs painting, keeping it within the viewport.
+// Arguments:
+// - invalid - the area that's changed, relative to the viewport
+// Return Value:
+// - <none>
+void HeadlessEngine::_InvalidCombine(const Viewport invalid) noexcept
+{
+    _invalidRect = Viewport::Intersect(Viewport::Union(_invalidRect, invalid), _viewport.ToOrigin());
+}
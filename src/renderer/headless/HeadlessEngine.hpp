@@ -0,0 +1,142 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- HeadlessEngine.hpp
+
+Abstract:
+- A render engine that doesn't draw anything. It keeps a record of the text,
+  colors and cursor it was asked to paint in the last frame instead, so the
+  renderer can be driven, measured and checked without a window or a display.
+- The record is kept in storage that's reused from one frame to the next, so
+  once it has grown to fit, painting doesn't allocate, and doesn't get in the
+  way of measuring the renderer.
+--*/
+
+#pragma once
+
+#include "..\inc\RenderEngineBase.hpp"
+#include "..\..\types\inc\Viewport.hpp"
+
+namespace Microsoft::Console::Render
+{
+    class HeadlessEngine final : public RenderEngineBase
+    {
+    public:
+        // The calls the engine keeps a record of.
+        enum class CallType : BYTE
+        {
+            PaintBufferLine,
+            UpdateDrawingBrushes,
+            PaintCursor
+        };
+
+        // One recorded call. A line's text isn't kept with it. Instead, all
+        //      the lines' text goes into GetText, one line after the other.
+        struct Call
+        {
+            CallType type;
+            COORD coord; // where the line starts, or where the cursor is
+            COLORREF foreground; // the brushes' colors
+            COLORREF background;
+            size_t columns; // how many cells the line or the cursor covers
+            size_t textEnd; // the line's text starts where the previous line's ends
+        };
+
+        HeadlessEngine(const Microsoft::Console::Types::Viewport initialViewport);
+        ~HeadlessEngine() override = default;
+
+        const std::vector<Call>& GetCalls() const noexcept;
+        std::wstring_view GetText() const noexcept;
+        size_t GetCellsPainted() const noexcept;
+        size_t GetFramesPainted() const noexcept;
+
+        // IRenderEngine Members
+        [[nodiscard]]
+        HRESULT Invalidate(const SMALL_RECT* const psrRegion) noexcept override;
+        [[nodiscard]]
+        HRESULT InvalidateCursor(const COORD* const pcoordCursor) noexcept override;
+        [[nodiscard]]
+        HRESULT InvalidateSystem(const RECT* const prcDirtyClient) noexcept override;
+        [[nodiscard]]
+        HRESULT InvalidateSelection(const std::vector<SMALL_RECT>& rectangles) noexcept override;
+        [[nodiscard]]
+        HRESULT InvalidateScroll(const COORD* const pcoordDelta) noexcept override;
+        [[nodiscard]]
+        HRESULT InvalidateAll() noexcept override;
+        [[nodiscard]]
+        HRESULT InvalidateCircling(_Out_ bool* const pForcePaint) noexcept override;
+        [[nodiscard]]
+        HRESULT PrepareForTeardown(_Out_ bool* const pForcePaint) noexcept override;
+
+        [[nodiscard]]
+        HRESULT StartPaint() noexcept override;
+        [[nodiscard]]
+        HRESULT EndPaint() noexcept override;
+        [[nodiscard]]
+        HRESULT Present() noexcept override;
+
+        [[nodiscard]]
+        HRESULT ScrollFrame() noexcept override;
+
+        [[nodiscard]]
+        HRESULT PaintBackground() noexcept override;
+        [[nodiscard]]
+        HRESULT PaintBufferLine(std::basic_string_view<Cluster> const clusters,
+                                const COORD coord,
+                                const bool trimLeft) noexcept override;
+        [[nodiscard]]
+        HRESULT PaintBufferGridLines(const GridLines lines,
+                                     const COLORREF color,
+                                     const size_t cchLine,
+                                     const COORD coordTarget) noexcept override;
+        [[nodiscard]]
+        HRESULT PaintSelection(const SMALL_RECT rect) noexcept override;
+
+        [[nodiscard]]
+        HRESULT PaintCursor(const CursorOptions& options) noexcept override;
+
+        [[nodiscard]]
+        HRESULT UpdateDrawingBrushes(const COLORREF colorForeground,
+                                     const COLORREF colorBackground,
+                                     const WORD legacyColorAttribute,
+                                     const bool isBold,
+                                     const bool isSettingDefaultBrushes) noexcept override;
+        [[nodiscard]]
+        HRESULT UpdateFont(const FontInfoDesired& fiFontInfoDesired, FontInfo& fiFontInfo) noexcept override;
+        [[nodiscard]]
+        HRESULT UpdateDpi(const int iDpi) noexcept override;
+        [[nodiscard]]
+        HRESULT UpdateViewport(const SMALL_RECT srNewViewport) noexcept override;
+
+        [[nodiscard]]
+        HRESULT GetProposedFont(const FontInfoDesired& fiFontInfoDesired,
+                                FontInfo& fiFontInfo,
+                                const int iDpi) noexcept override;
+
+        SMALL_RECT GetDirtyRectInChars() override;
+        bool CanPaintInParallel() noexcept override;
+        [[nodiscard]]
+        HRESULT GetFontSize(_Out_ COORD* const pFontSize) noexcept override;
+        [[nodiscard]]
+        HRESULT IsGlyphWideByFont(const std::wstring_view glyph, _Out_ bool* const pResult) noexcept override;
+
+    protected:
+        [[nodiscard]]
+        HRESULT _DoUpdateTitle(const std::wstring& newTitle) noexcept override;
+
+    private:
+        void _InvalidCombine(const Microsoft::Console::Types::Viewport invalid) noexcept;
+
+        Microsoft::Console::Types::Viewport _viewport;
+        Microsoft::Console::Types::Viewport _invalidRect;
+
+        // The record of the frame being painted, or the last one painted.
+        std::vector<Call> _calls;
+        std::wstring _text;
+        size_t _cellsPainted;
+
+        size_t _framesPainted;
+    };
+}
@@ -33,6 +33,10 @@ namespace Microsoft::Console::Render
         [[nodiscard]]
         HRESULT UpdateTitle(const std::wstring& newTitle) noexcept override;
 
+        std::vector<SMALL_RECT> GetDirtyArea() override;
+        bool CanPaintInParallel() noexcept override;
+        bool MustPaintUnderConsoleLock() noexcept override;
+
     protected:
         [[nodiscard]]
         virtual HRESULT _DoUpdateTitle(const std::wstring& newTitle) noexcept = 0;
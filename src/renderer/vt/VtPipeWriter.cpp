@@ -0,0 +1,236 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "VtPipeWriter.hpp"
+
+#pragma hdrstop
+
+using namespace Microsoft::Console::Render;
+
+VtFileOutputSink::VtFileOutputSink(wil::unique_hfile hFile) noexcept :
+    _hFile(std::move(hFile)),
+    _canceled(false)
+{
+}
+
+// Method Description:
+// - Writes the bytes to our file handle.
+// Arguments:
+// - bytes: The bytes to write. Might have nulls in it.
+// Return Value:
+// - S_OK or suitable HRESULT error from writing the file. If we've been
+//      canceled, ERROR_OPERATION_ABORTED.
+[[nodiscard]]
+HRESULT VtFileOutputSink::Write(const std::string_view bytes) noexcept
+{
+    size_t cbWritten = 0;
+    while (cbWritten < bytes.size())
+    {
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_OPERATION_ABORTED), _canceled.load());
+
+        const DWORD cbChunk = gsl::narrow_cast<DWORD>(std::min<size_t>(bytes.size() - cbWritten, MAXDWORD));
+        DWORD cbThisWrite = 0;
+        RETURN_IF_WIN32_BOOL_FALSE(WriteFile(_hFile.get(), bytes.data() + cbWritten, cbChunk, &cbThisWrite, nullptr));
+        cbWritten += cbThisWrite;
+    }
+    return S_OK;
+}
+
+// Method Description:
+// - Makes the next Write give up before it writes anything. A WriteFile that's
+//      already blocked is canceled by the VtPipeWriter, which knows which
+//      thread it's blocked on.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void VtFileOutputSink::Cancel() noexcept
+{
+    _canceled = true;
+}
+
+// Routine Description:
+// - Creates a writer, and starts the thread that writes to the sink.
+// - NOTE: Will throw if the thread can't be created. Caller must catch.
+// Arguments:
+// - sink: Where to write the bytes given to Submit.
+// - cbMaxPending: How many bytes may be waiting to be written before Submit
+//      blocks.
+// - maxWait: How long Submit, and teardown, wait on the sink before giving up.
+VtPipeWriter::VtPipeWriter(std::unique_ptr<IVtOutputSink> sink,
+                           const size_t cbMaxPending,
+                           const std::chrono::milliseconds maxWait) :
+    _sink(std::move(sink)),
+    _cbMaxPending(cbMaxPending),
+    _maxWait(maxWait),
+    _lock{},
+    _pendingAvailable{},
+    _pendingTaken{},
+    _pending{},
+    _writing{},
+    _isWriting(false),
+    _stopping(false),
+    _result(S_OK),
+    _thread{}
+{
+    _thread = std::thread([this]() { _WriterThread(); });
+}
+
+// Routine Description:
+// - Writes out everything that was already submitted, then stops the writer
+//      thread.
+// - If the sink doesn't take it all in time, the terminal has probably stopped
+//      reading, and waiting on it could hang us forever. Whatever's left is
+//      dropped, and the write that's stuck is canceled.
+VtPipeWriter::~VtPipeWriter()
+{
+    bool drained = true;
+    {
+        std::unique_lock<std::mutex> lock{ _lock };
+        _stopping = true;
+        _pendingAvailable.notify_all();
+
+        drained = _pendingTaken.wait_for(lock, _maxWait, [&]() {
+            return FAILED(_result) || (_pending.empty() && !_isWriting);
+        });
+        if (!drained)
+        {
+            _result = HRESULT_FROM_WIN32(ERROR_OPERATION_ABORTED);
+            _pending.clear();
+        }
+    }
+
+    if (_thread.joinable())
+    {
+        if (!drained)
+        {
+            _sink->Cancel();
+
+            // The writer thread might be just about to start a WriteFile when
+            //      we cancel it, so keep canceling until it's gone.
+            const HANDLE thread = _thread.native_handle();
+            while (WaitForSingleObject(thread, 10) == WAIT_TIMEOUT)
+            {
+                CancelSynchronousIo(thread);
+            }
+        }
+        _thread.join();
+    }
+}
+
+// Method Description:
+// - Hands the contents of buffer to the writer thread. If there's nothing
+//      waiting to be written, the buffers are just swapped, so buffer comes
+//      back empty with the capacity of one we wrote earlier. Otherwise the
+//      bytes are appended to what's waiting.
+// - If the writer has fallen more than the limit behind, this blocks until it
+//      catches up, or until it has waited as long as it's allowed to.
+// Arguments:
+// - buffer: The bytes to write. Empty when this returns, unless it timed out.
+// - wait: If false, and the writer is too far behind, give up right away
+//      instead of waiting for it.
+// Return Value:
+// - S_OK, or the error the sink failed with. Once the sink has failed, the
+//      bytes are discarded.
+// - ERROR_TIMEOUT if the writer didn't catch up in time. The bytes are left in
+//      buffer, for the caller to submit again later along with whatever it
+//      adds to them.
+[[nodiscard]]
+HRESULT VtPipeWriter::Submit(std::string& buffer, const bool wait) noexcept
+{
+    try
+    {
+        std::unique_lock<std::mutex> lock{ _lock };
+        const auto canSubmit = [&]() {
+            return FAILED(_result) || _pending.empty() || _pending.size() + buffer.size() <= _cbMaxPending;
+        };
+        const bool hasRoom = wait ? _pendingTaken.wait_for(lock, _maxWait, canSubmit) : canSubmit();
+        if (!hasRoom)
+        {
+            return HRESULT_FROM_WIN32(ERROR_TIMEOUT);
+        }
+
+        if (FAILED(_result))
+        {
+            buffer.clear();
+            return _result;
+        }
+
+        if (_pending.empty())
+        {
+            _pending.swap(buffer);
+        }
+        else
+        {
+            _pending.append(buffer);
+        }
+        buffer.clear();
+    }
+    CATCH_RETURN();
+
+    _pendingAvailable.notify_one();
+    return S_OK;
+}
+
+// Method Description:
+// - Blocks until everything that was submitted has been written to the sink.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK, or the error the sink failed with.
+[[nodiscard]]
+HRESULT VtPipeWriter::WaitForDrain() noexcept
+{
+    try
+    {
+        std::unique_lock<std::mutex> lock{ _lock };
+        _pendingTaken.wait(lock, [&]() {
+            return FAILED(_result) || (_pending.empty() && !_isWriting);
+        });
+        return _result;
+    }
+    CATCH_RETURN();
+}
+
+// Method Description:
+// - The writer thread. Takes whatever is pending, and writes it to the sink
+//      outside of the lock, so the renderer can keep submitting frames in the
+//      meantime.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void VtPipeWriter::_WriterThread() noexcept
+{
+    std::unique_lock<std::mutex> lock{ _lock };
+    for (;;)
+    {
+        _pendingAvailable.wait(lock, [&]() {
+            return _stopping || !_pending.empty();
+        });
+
+        if (_pending.empty() || FAILED(_result))
+        {
+            // We're stopping, and there's nothing left that we can write.
+            break;
+        }
+
+        _writing.swap(_pending);
+        _isWriting = true;
+        lock.unlock();
+        _pendingTaken.notify_all();
+
+        const HRESULT hr = _sink->Write(_writing);
+        _writing.clear();
+
+        lock.lock();
+        _isWriting = false;
+        if (FAILED(hr))
+        {
+            _result = hr;
+            _pending.clear();
+        }
+        _pendingTaken.notify_all();
+    }
+}
@@ -0,0 +1,122 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- VtPipeWriter.hpp
+
+Abstract:
+- Moves the VtEngine's writes to the terminal off of the rendering thread.
+    The VtEngine fills a buffer while it paints a frame (under the console
+    lock), then hands it to the VtPipeWriter, which swaps it for an empty one
+    and writes it to the sink on its own thread. How quickly the terminal
+    reads its end of the pipe no longer affects how long the lock is held.
+
+    The amount of data waiting to be written is bounded. Once the terminal
+    falls that far behind, Submit blocks until the writer catches up, so a
+    terminal that stops reading slows down the console instead of using up
+    all its memory.
+
+    Nothing waits on the terminal forever, though. Submit gives up after a
+    while and leaves the bytes with the caller to try again (or, if asked,
+    doesn't wait at all), and teardown
+    gives the terminal a while to read what's left, then cancels the write
+    that's stuck.
+
+- IVtOutputSink abstracts the destination of the bytes, so tests can supply
+    an in-memory stand-in for the pipe.
+--*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace Microsoft::Console::Render
+{
+    class IVtOutputSink
+    {
+    public:
+        virtual ~IVtOutputSink() = default;
+
+        // Writes all of the given bytes, blocking until they've been accepted.
+        [[nodiscard]]
+        virtual HRESULT Write(const std::string_view bytes) noexcept = 0;
+
+        // Called from another thread to make the Write that's blocked, and any
+        //      after it, give up.
+        virtual void Cancel() noexcept = 0;
+    };
+
+    // Writes to a file handle, typically the conpty output pipe.
+    class VtFileOutputSink final : public IVtOutputSink
+    {
+    public:
+        VtFileOutputSink(wil::unique_hfile hFile) noexcept;
+
+        [[nodiscard]]
+        HRESULT Write(const std::string_view bytes) noexcept override;
+        void Cancel() noexcept override;
+
+    private:
+        wil::unique_hfile _hFile;
+        std::atomic<bool> _canceled;
+    };
+
+    class VtPipeWriter final
+    {
+    public:
+        // How many bytes may be waiting for the sink before Submit blocks.
+        static constexpr size_t DefaultMaxPendingBytes = 1024 * 1024;
+        // How long Submit waits for room, and teardown waits for the sink to
+        //      take what's left, before giving up on it.
+        static constexpr std::chrono::milliseconds DefaultMaxWait{ 1000 };
+
+        VtPipeWriter(std::unique_ptr<IVtOutputSink> sink,
+                     const size_t cbMaxPending = DefaultMaxPendingBytes,
+                     const std::chrono::milliseconds maxWait = DefaultMaxWait);
+        ~VtPipeWriter();
+
+        VtPipeWriter(const VtPipeWriter&) = delete;
+        VtPipeWriter& operator=(const VtPipeWriter&) = delete;
+
+        [[nodiscard]]
+        HRESULT Submit(std::string& buffer, const bool wait = true) noexcept;
+
+        [[nodiscard]]
+        HRESULT WaitForDrain() noexcept;
+
+    private:
+        void _WriterThread() noexcept;
+
+        std::unique_ptr<IVtOutputSink> _sink;
+        const size_t _cbMaxPending;
+        const std::chrono::milliseconds _maxWait;
+
+        std::mutex _lock;
+        // Signaled when there's something for the writer thread to write, or
+        //      it should exit.
+        std::condition_variable _pendingAvailable;
+        // Signaled when the writer thread has taken the pending buffer, or
+        //      finished writing it.
+        std::condition_variable _pendingTaken;
+
+        // Bytes submitted, but not yet picked up by the writer thread.
+        std::string _pending;
+        // Bytes the writer thread is currently writing. Only the writer
+        //      thread touches this, outside of the lock.
+        std::string _writing;
+        bool _isWriting;
+        bool _stopping;
+        // The first failure from the sink. Once the sink fails, nothing else
+        //      gets written.
+        HRESULT _result;
+
+        std::thread _thread;
+    };
+}
@@ -0,0 +1,80 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- VtSequenceBuilder.hpp
+
+Abstract:
+- A small, fixed-size buffer for assembling a single VT sequence out of
+    literal pieces and decimal numbers. It lives on the stack and formats
+    numbers with std::to_chars, so building a sequence never touches the heap.
+    The VtEngine then appends the finished sequence to its output buffer.
+--*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <string_view>
+
+namespace Microsoft::Console::Render
+{
+    class VtSequenceBuilder final
+    {
+    public:
+        // The longest sequence we build is an RGB SGR,
+        //      "\x1b[48;2;255;255;255m", at 19 characters.
+        static constexpr size_t MaxLength = 32;
+
+        constexpr VtSequenceBuilder() noexcept :
+            _chars{},
+            _cch{ 0 },
+            _overflowed{ false }
+        {
+        }
+
+        VtSequenceBuilder& Append(const std::string_view str) noexcept
+        {
+            if (str.size() > _chars.size() - _cch)
+            {
+                _overflowed = true;
+                return *this;
+            }
+            std::copy(str.cbegin(), str.cend(), _chars.begin() + _cch);
+            _cch += str.size();
+            return *this;
+        }
+
+        VtSequenceBuilder& Append(const int value) noexcept
+        {
+            char* const pchBegin = _chars.data() + _cch;
+            const auto result = std::to_chars(pchBegin, _chars.data() + _chars.size(), value);
+            if (result.ec != std::errc{})
+            {
+                _overflowed = true;
+                return *this;
+            }
+            _cch += static_cast<size_t>(result.ptr - pchBegin);
+            return *this;
+        }
+
+        // Returns true if something didn't fit, in which case the sequence is
+        //      incomplete and shouldn't be written.
+        constexpr bool Overflowed() const noexcept
+        {
+            return _overflowed;
+        }
+
+        constexpr std::string_view View() const noexcept
+        {
+            return { _chars.data(), _cch };
+        }
+
+    private:
+        std::array<char, MaxLength> _chars;
+        size_t _cch;
+        bool _overflowed;
+    };
+}
@@ -21,7 +21,9 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
     _fUseAsciiOnly(fUseAsciiOnly),
     _previousLineWrapped(false),
     _usingUnderLine(false),
-    _needToDisableCursor(false)
+    _needToDisableCursor(false),
+    _shadowFrame{},
+    _shadowSize{ 0, 0 }
 {
     // Set out initial cursor position to -1, -1. This will force our initial
     //      paint to manually move the cursor to 0, 0, not just ignore it.
@@ -71,6 +73,14 @@ HRESULT XtermEngine::StartPaint() noexcept
         }
     }
 
+    // Whatever we sent the terminal before a clear or a resize is gone, so
+    //      nothing in the shadow frame can be trusted anymore.
+    const auto size = _lastViewport.Dimensions();
+    if (_clearedAllThisFrame || size.X != _shadowSize.X || size.Y != _shadowSize.Y)
+    {
+        _InvalidateShadowFrame();
+    }
+
     if (!_quickReturn)
     {
         if (!_WillWriteSingleChar())
@@ -325,6 +335,15 @@ HRESULT XtermEngine::ScrollFrame() noexcept
         }
     }
 
+    if (SUCCEEDED(hr))
+    {
+        _ScrollShadowFrame(dy);
+    }
+    else
+    {
+        _InvalidateShadowFrame();
+    }
+
     return hr;
 }
 
@@ -377,6 +396,8 @@ HRESULT XtermEngine::InvalidateScroll(const COORD* const pcoordDelta) noexcept
 // - Draws one line of the buffer to the screen. Writes the characters to the
 //      pipe, encoded in UTF-8 or ASCII only, depending on the VtIoMode.
 //      (See descriptions of both implementations for details.)
+//  In UTF-8 mode, only the cells that differ from what we last sent the
+//      terminal are written. See _PaintChangedBufferLine.
 // Arguments:
 // - clusters - text and column counts for each piece of text.
 // - coord - character coordinate target to render within viewport
@@ -392,7 +413,311 @@ HRESULT XtermEngine::PaintBufferLine(std::basic_string_view<Cluster> const clust
 {
     return _fUseAsciiOnly ?
         VtEngine::_PaintAsciiBufferLine(clusters, coord) :
-        VtEngine::_PaintUtf8BufferLine(clusters, coord);
+        _PaintChangedBufferLine(clusters, coord);
+}
+
+// Routine Description:
+// - Returns the number of bytes it takes to encode the given text as UTF-8.
+// Arguments:
+// - text - the text to measure
+// Return Value:
+// - The length of the UTF-8 encoding of text, in bytes.
+static size_t _Utf8Length(const std::wstring_view text) noexcept
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+    const int cb = WideCharToMultiByte(CP_UTF8, 0, text.data(), gsl::narrow_cast<int>(text.size()), nullptr, 0, nullptr, nullptr);
+    return cb > 0 ? static_cast<size_t>(cb) : text.size();
+}
+
+// Routine Description:
+// - Returns the number of bytes in the CUF sequence ("\x1b[%dC") that moves
+//      the cursor forward the given number of columns.
+// Arguments:
+// - columns - the distance to move the cursor
+// Return Value:
+// - The length of the sequence, in bytes.
+static size_t _CursorForwardLength(short columns) noexcept
+{
+    size_t cchDigits = 1;
+    while (columns >= 10)
+    {
+        columns /= 10;
+        cchDigits++;
+    }
+    return 3 + cchDigits;
+}
+
+// Routine Description:
+// - Draws one line of the buffer to the screen, skipping the cells that the
+//      terminal is already displaying. The clusters are compared against the
+//      shadow frame, and the ones that changed are grouped into runs, which
+//      are written with _PaintUtf8BufferLine.
+//  Two runs are only split if moving the cursor over the unchanged cells
+//      between them (with a CUF) is shorter than just writing those cells
+//      again. Otherwise, the unchanged cells are written as part of the run.
+// Arguments:
+// - clusters - text and column counts for each piece of text.
+// - coord - character coordinate target to render within viewport
+// Return Value:
+// - S_OK or suitable HRESULT error from writing pipe.
+[[nodiscard]]
+HRESULT XtermEngine::_PaintChangedBufferLine(std::basic_string_view<Cluster> const clusters,
+                                             const COORD coord) noexcept
+{
+    if (coord.Y < _virtualTop)
+    {
+        return S_OK;
+    }
+
+    size_t runBegin = 0;
+    size_t runEnd = 0;
+    bool haveRun = false;
+    COORD runCoord = coord;
+
+    // The unchanged cells since the end of the current run.
+    size_t cbGap = 0;
+    short gapColumns = 0;
+
+    short column = coord.X;
+    for (size_t i = 0; i < clusters.size(); i++)
+    {
+        const auto& cluster = clusters.at(i);
+        if (!_ShadowMatches(cluster, { column, coord.Y }))
+        {
+            if (haveRun && gapColumns > 0 && cbGap > _CursorForwardLength(gapColumns))
+            {
+                RETURN_IF_FAILED(_PaintUtf8BufferLine({ clusters.data() + runBegin, runEnd - runBegin }, runCoord));
+                haveRun = false;
+            }
+
+            if (!haveRun)
+            {
+                runBegin = i;
+                runCoord = { column, coord.Y };
+                haveRun = true;
+            }
+            runEnd = i + 1;
+            cbGap = 0;
+            gapColumns = 0;
+        }
+        else if (haveRun)
+        {
+            cbGap += _Utf8Length(cluster.GetText());
+            gapColumns += gsl::narrow_cast<short>(cluster.GetColumns());
+        }
+
+        column += gsl::narrow_cast<short>(cluster.GetColumns());
+    }
+
+    if (haveRun)
+    {
+        RETURN_IF_FAILED(_PaintUtf8BufferLine({ clusters.data() + runBegin, runEnd - runBegin }, runCoord));
+    }
+
+    _UpdateShadowFrame(clusters, coord);
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Marks every cell of the shadow frame as unknown, resizing it to match the
+//      current viewport. Everything will be written on the next paint.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void XtermEngine::_InvalidateShadowFrame() noexcept
+{
+    const auto size = _lastViewport.Dimensions();
+    try
+    {
+        _shadowFrame.resize(static_cast<size_t>(size.X) * static_cast<size_t>(size.Y));
+        _shadowSize = size;
+        for (auto& cell : _shadowFrame)
+        {
+            cell.isValid = false;
+        }
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        // With an empty shadow frame, every cell is treated as changed.
+        _shadowFrame.clear();
+        _shadowSize = { 0, 0 };
+    }
+}
+
+// Routine Description:
+// - Moves the rows of the shadow frame to match what ScrollFrame did to the
+//      terminal. The rows scrolled into view are marked as unknown.
+// Arguments:
+// - dy - the number of rows the contents moved down (negative for up)
+// Return Value:
+// - <none>
+void XtermEngine::_ScrollShadowFrame(const short dy) noexcept
+{
+    const size_t width = _shadowSize.X;
+    const size_t height = _shadowSize.Y;
+    const size_t absDy = static_cast<size_t>(abs(dy));
+    if (absDy == 0)
+    {
+        return;
+    }
+
+    const auto invalidate = [](auto begin, auto end) noexcept {
+        std::for_each(begin, end, [](auto& cell) noexcept { cell.isValid = false; });
+    };
+
+    if (absDy >= height)
+    {
+        invalidate(_shadowFrame.begin(), _shadowFrame.end());
+        return;
+    }
+
+    const size_t cellsMoved = absDy * width;
+    if (dy < 0)
+    {
+        std::move(_shadowFrame.begin() + cellsMoved, _shadowFrame.end(), _shadowFrame.begin());
+        invalidate(_shadowFrame.end() - cellsMoved, _shadowFrame.end());
+    }
+    else
+    {
+        std::move_backward(_shadowFrame.begin(), _shadowFrame.end() - cellsMoved, _shadowFrame.end());
+        invalidate(_shadowFrame.begin(), _shadowFrame.begin() + cellsMoved);
+    }
+}
+
+// Routine Description:
+// - Checks whether the terminal is already displaying the given cluster, with
+//      the current drawing attributes, at the given position.
+// Arguments:
+// - cluster - the text and column count to compare
+// - coord - the position of the cluster's first cell
+// Return Value:
+// - true if every cell covered by the cluster matches the shadow frame.
+bool XtermEngine::_ShadowMatches(const Cluster& cluster, const COORD coord) const noexcept
+{
+    const size_t columns = cluster.GetColumns();
+    if (columns == 0 ||
+        coord.X < 0 || coord.Y < 0 ||
+        coord.Y >= _shadowSize.Y ||
+        coord.X + columns > static_cast<size_t>(_shadowSize.X))
+    {
+        return false;
+    }
+
+    const size_t index = static_cast<size_t>(coord.Y) * _shadowSize.X + coord.X;
+    for (size_t i = 0; i < columns; i++)
+    {
+        const auto& cell = _shadowFrame[index + i];
+        const bool textMatches = i == 0 ? cell.text == cluster.GetText() : cell.text.empty();
+        if (!cell.isValid ||
+            !textMatches ||
+            cell.fg != _LastFG ||
+            cell.bg != _LastBG ||
+            cell.isBold != _lastWasBold ||
+            cell.isUnderlined != _usingUnderLine)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Routine Description:
+// - Records that the terminal is now displaying the given clusters, with the
+//      current drawing attributes, starting at the given position. Wide glyphs
+//      that were only partially overwritten are marked as unknown.
+// Arguments:
+// - clusters - text and column counts for each piece of text.
+// - coord - the position of the first cluster
+// Return Value:
+// - <none>
+void XtermEngine::_UpdateShadowFrame(std::basic_string_view<Cluster> const clusters,
+                                     const COORD coord) noexcept
+{
+    if (coord.Y < 0 || coord.Y >= _shadowSize.Y)
+    {
+        return;
+    }
+
+    const auto rowBegin = _shadowFrame.begin() + static_cast<size_t>(coord.Y) * _shadowSize.X;
+    const auto isTrailingHalf = [](const ShadowCell& cell) noexcept {
+        return cell.isValid && cell.text.empty();
+    };
+
+    try
+    {
+        short column = coord.X;
+
+        // Writing over the trailing half of a wide glyph erases its leading half.
+        if (column > 0 && column < _shadowSize.X && isTrailingHalf(rowBegin[column]))
+        {
+            for (short x = gsl::narrow_cast<short>(column - 1); x >= 0; x--)
+            {
+                const bool wasTrailing = isTrailingHalf(rowBegin[x]);
+                rowBegin[x].isValid = false;
+                if (!wasTrailing)
+                {
+                    break;
+                }
+            }
+        }
+
+        for (const auto& cluster : clusters)
+        {
+            const short columns = gsl::narrow_cast<short>(cluster.GetColumns());
+            if (columns == 0)
+            {
+                // A zero-width cluster combines with whatever is before it,
+                //      so we no longer know what that cell looks like.
+                if (column > 0 && column <= _shadowSize.X)
+                {
+                    rowBegin[column - 1].isValid = false;
+                }
+                continue;
+            }
+
+            for (short i = 0; i < columns; i++)
+            {
+                const short x = gsl::narrow_cast<short>(column + i);
+                if (x < 0 || x >= _shadowSize.X)
+                {
+                    continue;
+                }
+                auto& cell = rowBegin[x];
+                if (i == 0)
+                {
+                    cell.text = cluster.GetText();
+                }
+                else
+                {
+                    cell.text.clear();
+                }
+                cell.fg = _LastFG;
+                cell.bg = _LastBG;
+                cell.isBold = _lastWasBold;
+                cell.isUnderlined = _usingUnderLine;
+                cell.isValid = true;
+            }
+            column += columns;
+        }
+
+        // Likewise, writing over the leading half erases the trailing half.
+        for (short x = column; x >= 0 && x < _shadowSize.X && isTrailingHalf(rowBegin[x]); x++)
+        {
+            rowBegin[x].isValid = false;
+        }
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        _shadowFrame.clear();
+        _shadowSize = { 0, 0 };
+    }
 }
 
 // Method Description:
@@ -405,6 +730,9 @@ HRESULT XtermEngine::PaintBufferLine(std::basic_string_view<Cluster> const clust
 [[nodiscard]]
 HRESULT XtermEngine::WriteTerminalW(const std::wstring& wstr) noexcept
 {
+    // We have no idea what this text will do to the terminal's contents.
+    _InvalidateShadowFrame();
+
     return _fUseAsciiOnly ?
         VtEngine::_WriteTerminalAscii(wstr) :
         VtEngine::_WriteTerminalUtf8(wstr);
@@ -68,9 +68,33 @@ namespace Microsoft::Console::Render
         bool _usingUnderLine;
         bool _needToDisableCursor;
 
+        // One cell of the last frame we sent to the terminal. The trailing
+        //      cells of a wide glyph have an empty text and the lead's attributes.
+        struct ShadowCell
+        {
+            std::wstring text;
+            COLORREF fg;
+            COLORREF bg;
+            bool isBold;
+            bool isUnderlined;
+            bool isValid;
+        };
+        std::vector<ShadowCell> _shadowFrame;
+        COORD _shadowSize;
+
         [[nodiscard]]
         HRESULT _MoveCursor(const COORD coord) noexcept override;
 
+        [[nodiscard]]
+        HRESULT _PaintChangedBufferLine(std::basic_string_view<Cluster> const clusters,
+                                        const COORD coord) noexcept;
+
+        void _InvalidateShadowFrame() noexcept;
+        void _ScrollShadowFrame(const short dy) noexcept;
+        bool _ShadowMatches(const Cluster& cluster, const COORD coord) const noexcept;
+        void _UpdateShadowFrame(std::basic_string_view<Cluster> const clusters,
+                                const COORD coord) noexcept;
+
         [[nodiscard]]
         HRESULT _UpdateUnderline(const WORD wLegacyAttrs) noexcept;
 
@@ -157,6 +157,26 @@ HRESULT VtEngine::_InvalidCombine(const Viewport invalid) noexcept
     // Ensure invalid areas remain within bounds of window.
     RETURN_IF_FAILED(_InvalidRestrict());
 
+    // Mark only the rows this covers as dirty, so that an invalidation at the
+    //      top and another at the bottom don't repaint everything in between.
+    SMALL_RECT rows = invalid.ToExclusive();
+    if (_lastViewport.ToOrigin().TrimToViewport(&rows))
+    {
+        for (SHORT row = rows.Top; row < rows.Bottom; row++)
+        {
+            auto& span = _invalidRows[row];
+            if (span.first >= span.second)
+            {
+                span = { rows.Left, rows.Right };
+            }
+            else
+            {
+                span.first = std::min(span.first, rows.Left);
+                span.second = std::max(span.second, rows.Right);
+            }
+        }
+    }
+
     return S_OK;
 }
 
@@ -182,6 +202,39 @@ HRESULT VtEngine::_InvalidOffset(const COORD* const pCoord) noexcept
 
             // Ensure invalid areas remain within bounds of window.
             RETURN_IF_FAILED(_InvalidRestrict());
+
+            // Do the same for each dirty row. Walk away from the direction we're
+            //      moving in, so that a row is always read before it's added to.
+            const SHORT width = _lastViewport.Width();
+            const SHORT height = gsl::narrow<SHORT>(_invalidRows.size());
+            for (SHORT i = 0; i < height; i++)
+            {
+                const SHORT row = pCoord->Y > 0 ? gsl::narrow_cast<SHORT>(height - 1 - i) : i;
+                const SHORT newRow = gsl::narrow_cast<SHORT>(row + pCoord->Y);
+                const auto span = _invalidRows[row];
+                if (span.first >= span.second || newRow < 0 || newRow >= height)
+                {
+                    continue;
+                }
+
+                const SHORT left = std::max<SHORT>(gsl::narrow_cast<SHORT>(span.first + pCoord->X), 0);
+                const SHORT right = std::min<SHORT>(gsl::narrow_cast<SHORT>(span.second + pCoord->X), width);
+                if (left >= right)
+                {
+                    continue;
+                }
+
+                auto& newSpan = _invalidRows[newRow];
+                if (newSpan.first >= newSpan.second)
+                {
+                    newSpan = { left, right };
+                }
+                else
+                {
+                    newSpan.first = std::min(newSpan.first, left);
+                    newSpan.second = std::max(newSpan.second, right);
+                }
+            }
         }
         CATCH_RETURN();
     }
@@ -204,5 +257,13 @@ HRESULT VtEngine::_InvalidRestrict() noexcept
 
     _invalidRect = Viewport::FromExclusive(oldInvalid);
 
+    // Keep a dirty span for every row of the viewport.
+    //      Anything beyond its width is trimmed off in GetDirtyArea.
+    try
+    {
+        _invalidRows.resize(_lastViewport.Height());
+    }
+    CATCH_RETURN();
+
     return S_OK;
 }
@@ -27,6 +27,49 @@ SMALL_RECT VtEngine::GetDirtyRectInChars()
     return dirty;
 }
 
+// Routine Description:
+// - Gets the dirty portions of the frame, as rectangles in characters.
+//   Unlike GetDirtyRectInChars, rows that weren't invalidated aren't included
+//      just because they're between two rows that were. Consecutive rows that
+//      are dirty in the same columns are combined into a single rectangle.
+// Arguments:
+// - <none>
+// Return Value:
+// - The dirty areas of the frame, from top to bottom. These are Inclusive rects.
+std::vector<SMALL_RECT> VtEngine::GetDirtyArea()
+{
+    std::vector<SMALL_RECT> dirtyArea;
+    if (!_fInvalidRectUsed)
+    {
+        return dirtyArea;
+    }
+
+    const SHORT width = _lastViewport.Width();
+    const SHORT height = gsl::narrow<SHORT>(std::min<size_t>(_invalidRows.size(), _lastViewport.Height()));
+    for (SHORT row = std::max<SHORT>(_virtualTop, 0); row < height; row++)
+    {
+        const auto& span = _invalidRows[row];
+        const SHORT left = std::max<SHORT>(span.first, 0);
+        const SHORT right = std::min<SHORT>(span.second, width);
+        if (left >= right)
+        {
+            continue;
+        }
+
+        if (!dirtyArea.empty())
+        {
+            auto& last = dirtyArea.back();
+            if (last.Bottom == row - 1 && last.Left == left && last.Right == right - 1)
+            {
+                last.Bottom = row;
+                continue;
+            }
+        }
+        dirtyArea.push_back({ left, row, gsl::narrow_cast<SHORT>(right - 1), row });
+    }
+    return dirtyArea;
+}
+
 // Routine Description:
 // - Uses the currently selected font to determine how wide the given character will be when renderered.
 // - NOTE: Only supports determining half-width/full-width status for CJK-type languages (e.g. is it 1 character wide or 2. a.k.a. is it a rectangle or square.)
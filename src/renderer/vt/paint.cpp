@@ -53,6 +53,7 @@ HRESULT VtEngine::EndPaint() noexcept
     _trace.TraceEndPaint();
 
     _invalidRect = Viewport::Empty();
+    std::fill(_invalidRows.begin(), _invalidRows.end(), std::pair<SHORT, SHORT>{ 0, 0 });
     _fInvalidRectUsed = false;
     _scrollDelta = {0};
     _clearedAllThisFrame = false;
@@ -79,8 +80,13 @@ HRESULT VtEngine::EndPaint() noexcept
         RETURN_IF_FAILED(_MoveCursor(_deferredCursorPos));
     }
 
-    RETURN_IF_FAILED(_Flush());
+    const HRESULT hr = _Flush();
 
+    // We're painted before the renderer lets go of the console lock, so this
+    //      is a safe place to tell the terminal owner if the pipe broke.
+    _CloseOutputIfPipeBroken();
+
+    RETURN_IF_FAILED(hr);
     return S_OK;
 }
 
@@ -353,17 +359,16 @@ HRESULT VtEngine::_PaintAsciiBufferLine(std::basic_string_view<Cluster> const cl
     {
         RETURN_IF_FAILED(_MoveCursor(coord));
 
-        std::wstring wstr;
-        wstr.reserve(clusters.size());
+        _clusterText.clear();
 
         short totalWidth = 0;
         for (const auto& cluster : clusters)
         {
-            wstr.append(cluster.GetText());
+            _clusterText.append(cluster.GetText());
             RETURN_IF_FAILED(ShortAdd(totalWidth, gsl::narrow<short>(cluster.GetColumns()), &totalWidth));
         }
 
-        RETURN_IF_FAILED(VtEngine::_WriteTerminalAscii(wstr));
+        RETURN_IF_FAILED(VtEngine::_WriteTerminalAscii(_clusterText));
 
         // Update our internal tracker of the cursor's position
         _lastText.X += totalWidth;
@@ -392,14 +397,20 @@ HRESULT VtEngine::_PaintUtf8BufferLine(std::basic_string_view<Cluster> const clu
 
     RETURN_IF_FAILED(_MoveCursor(coord));
 
-    std::wstring unclusteredString;
-    unclusteredString.reserve(clusters.size());
+    // _clusterText keeps its capacity from line to line, so this only
+    //      allocates when we see a line longer than any before it.
     short totalWidth = 0;
-    for (const auto& cluster : clusters)
+    try
     {
-        unclusteredString.append(cluster.GetText());
-        RETURN_IF_FAILED(ShortAdd(totalWidth, static_cast<short>(cluster.GetColumns()), &totalWidth));
+        _clusterText.clear();
+        for (const auto& cluster : clusters)
+        {
+            _clusterText.append(cluster.GetText());
+            RETURN_IF_FAILED(ShortAdd(totalWidth, static_cast<short>(cluster.GetColumns()), &totalWidth));
+        }
     }
+    CATCH_RETURN();
+    const std::wstring_view unclusteredString{ _clusterText };
     const size_t cchLine = unclusteredString.size();
 
     bool foundNonspace = false;
@@ -460,8 +471,7 @@ HRESULT VtEngine::_PaintUtf8BufferLine(std::basic_string_view<Cluster> const clu
                                     totalWidth;
 
     // Write the actual text string
-    std::wstring wstr = std::wstring(unclusteredString.data(), cchActual);
-    RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8(wstr));
+    RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8(unclusteredString.substr(0, cchActual)));
 
     // Update our internal tracker of the cursor's position.
     // See MSFT:20266233
@@ -508,8 +518,9 @@ HRESULT VtEngine::_PaintUtf8BufferLine(std::basic_string_view<Cluster> const clu
         }
         else
         {
-            std::wstring spaces = std::wstring(numSpaces, L' ');
-            RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8(spaces));
+            // There are at most ERASE_CHARACTER_STRING_LENGTH of them here.
+            static constexpr std::string_view spaces{ "                " };
+            RETURN_IF_FAILED(_Write(spaces.substr(0, numSpaces)));
 
             _lastText.X += static_cast<short>(numSpaces);
         }
@@ -6,10 +6,6 @@
 #include "../../inc/conattrs.hpp"
 #include "../../types/inc/convert.hpp"
 
-// For _vcprintf
-#include <conio.h>
-#include <stdarg.h>
-
 #pragma hdrstop
 
 using namespace Microsoft::Console;
@@ -29,13 +25,17 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
                    const IDefaultColorProvider& colorProvider,
                    const Viewport initialViewport) :
     RenderEngineBase(),
-    _hFile(std::move(pipe)),
+    _writer{},
+    _buffer{},
+    _clusterText{},
+    _convertedText{},
     _colorProvider(colorProvider),
     _LastFG(INVALID_COLOR),
     _LastBG(INVALID_COLOR),
     _lastWasBold(false),
     _lastViewport(initialViewport),
     _invalidRect(Viewport::Empty()),
+    _invalidRows(initialViewport.Height()),
     _fInvalidRectUsed(false),
     _lastRealCursor({0}),
     _lastText({0}),
@@ -50,6 +50,8 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
     _firstPaint(true),
     _skipCursor(false),
     _pipeBroken(false),
+    _writerBehind(false),
+    _outputClosed(false),
     _exitResult{ S_OK },
     _terminalOwner{ nullptr },
     _newBottomLine{ false },
@@ -58,11 +60,16 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
 {
 #ifndef UNIT_TESTING
     // When unit testing, we can instantiate a VtEngine without a pipe.
-    THROW_HR_IF(E_HANDLE, _hFile.get() == INVALID_HANDLE_VALUE);
+    THROW_HR_IF(E_HANDLE, pipe.get() == INVALID_HANDLE_VALUE);
 #else
     // member is only defined when UNIT_TESTING is.
     _usingTestCallback = false;
 #endif
+
+    if (pipe)
+    {
+        _writer = std::make_unique<VtPipeWriter>(std::make_unique<VtFileOutputSink>(std::move(pipe)));
+    }
 }
 
 // Method Description:
@@ -94,11 +101,25 @@ HRESULT VtEngine::_Write(std::string_view const str) noexcept
     CATCH_RETURN();
 }
 
+// Method Description:
+// - Hands everything we've written since the last flush to the pipe writer.
+//      The actual write to the pipe happens on the writer's thread, so this
+//      only blocks if the terminal has fallen far behind in reading. Once it
+//      has, we stop waiting on it, and keep what we write until it catches up.
+//      If it falls so far behind that we're holding more than
+//      MaxBufferedBytes, we throw it all away, and repaint everything instead.
+//   If the writer reports that the pipe broke, we remember it. The terminal
+//      owner is told by _CloseOutputIfPipeBroken, once we're somewhere that
+//      holds the console lock.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK or suitable HRESULT error from writing pipe.
 [[nodiscard]]
 HRESULT VtEngine::_Flush() noexcept
 {
 #ifdef UNIT_TESTING
-    if (_hFile.get() == INVALID_HANDLE_VALUE)
+    if (!_writer)
     {
         // Do not flush during Unit Testing because we won't have a valid file.
         return S_OK;
@@ -107,16 +128,33 @@ HRESULT VtEngine::_Flush() noexcept
 
     if (!_pipeBroken)
     {
-        bool fSuccess = !!WriteFile(_hFile.get(), _buffer.data(), static_cast<DWORD>(_buffer.size()), nullptr, nullptr);
-        _buffer.clear();
-        if (!fSuccess)
+        const HRESULT hr = _writer->Submit(_buffer, !_writerBehind);
+        if (hr == HRESULT_FROM_WIN32(ERROR_TIMEOUT))
         {
-            _exitResult = HRESULT_FROM_WIN32(GetLastError());
-            _pipeBroken = true;
-            if (_terminalOwner)
+            // The terminal has fallen far behind. Rather than hold up the
+            //      console any longer, keep what we have for the next flush.
+            _writerBehind = true;
+            if (_buffer.size() > MaxBufferedBytes)
             {
-                _terminalOwner->CloseOutput();
+                // We don't know which of what we threw away was what the
+                //      terminal has on screen now, so clear it and start over
+                //      on the next frame, with no cursor position or colors.
+                _buffer.clear();
+                _LastFG = INVALID_COLOR;
+                _LastBG = INVALID_COLOR;
+                _lastWasBold = false;
+                _lastText = INVALID_COORDS;
+                _firstPaint = true;
+                RETURN_IF_FAILED(_SetGraphicsDefault());
+                return InvalidateAll();
             }
+            return S_OK;
+        }
+        _writerBehind = false;
+        if (FAILED(hr))
+        {
+            _exitResult = hr;
+            _pipeBroken = true;
             return _exitResult;
         }
     }
@@ -124,6 +162,27 @@ HRESULT VtEngine::_Flush() noexcept
     return S_OK;
 }
 
+// Method Description:
+// - If the pipe has broken since the last time we were called, tells the
+//      terminal owner that the output is closed. That takes the active screen
+//      buffer's terminal connection away, so it must only be called with the
+//      console locked.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void VtEngine::_CloseOutputIfPipeBroken() noexcept
+{
+    if (_pipeBroken && !_outputClosed)
+    {
+        _outputClosed = true;
+        if (_terminalOwner)
+        {
+            _terminalOwner->CloseOutput();
+        }
+    }
+}
+
 // Method Description:
 // - Wrapper for ITerminalOutputConnection. See _Write.
 [[nodiscard]]
@@ -135,17 +194,31 @@ HRESULT VtEngine::WriteTerminalUtf8(const std::string& str) noexcept
 // Method Description:
 // - Writes a wstring to the tty, encoded as full utf-8. This is one
 //      implementation of the WriteTerminalW method.
+//   The text is converted into _convertedText, which is reused from call to
+//      call, so this won't allocate once that's grown to fit a line.
 // Arguments:
 // - wstr - wstring of text to be written
 // Return Value:
 // - S_OK or suitable HRESULT error from either conversion or writing pipe.
 [[nodiscard]]
-HRESULT VtEngine::_WriteTerminalUtf8(const std::wstring& wstr) noexcept
+HRESULT VtEngine::_WriteTerminalUtf8(const std::wstring_view wstr) noexcept
 {
     try
     {
-        const auto converted = ConvertToA(CP_UTF8, wstr);
-        return _Write(converted);
+        if (wstr.empty())
+        {
+            return _Write({});
+        }
+
+        const int cchSource = gsl::narrow<int>(wstr.size());
+        const int cchNeeded = WideCharToMultiByte(CP_UTF8, 0, wstr.data(), cchSource, nullptr, 0, nullptr, nullptr);
+        RETURN_LAST_ERROR_IF(0 == cchNeeded);
+
+        _convertedText.resize(gsl::narrow_cast<size_t>(cchNeeded));
+        const int cchConverted = WideCharToMultiByte(CP_UTF8, 0, wstr.data(), cchSource, _convertedText.data(), cchNeeded, nullptr, nullptr);
+        RETURN_LAST_ERROR_IF(0 == cchConverted);
+
+        return _Write({ _convertedText.data(), gsl::narrow_cast<size_t>(cchConverted) });
     }
     CATCH_RETURN();
 }
@@ -160,57 +233,38 @@ HRESULT VtEngine::_WriteTerminalUtf8(const std::wstring& wstr) noexcept
 // Return Value:
 // - S_OK or suitable HRESULT error from writing pipe.
 [[nodiscard]]
-HRESULT VtEngine::_WriteTerminalAscii(const std::wstring& wstr) noexcept
+HRESULT VtEngine::_WriteTerminalAscii(const std::wstring_view wstr) noexcept
 {
-    const size_t cchActual = wstr.length();
-
-    std::string needed;
-    needed.reserve(wstr.size());
-    
-    for (const auto& wch : wstr)
+    try
     {
-        // We're explicitly replacing characters outside ASCII with a ? because
-        //      that's what telnet wants.
-        needed.push_back((wch > L'\x7f') ? '?' : static_cast<char>(wch));
-    }
+        _convertedText.clear();
+        _convertedText.reserve(wstr.size());
+
+        for (const auto& wch : wstr)
+        {
+            // We're explicitly replacing characters outside ASCII with a ? because
+            //      that's what telnet wants.
+            _convertedText.push_back((wch > L'\x7f') ? '?' : static_cast<char>(wch));
+        }
 
-    return _Write(needed);
+        return _Write(_convertedText);
+    }
+    CATCH_RETURN();
 }
 
 // Method Description:
-// - Helper for calling _Write with a string for formatting a sequence. Used
-//      extensively by VtSequences.cpp
+// - Helper for calling _Write with a sequence assembled by a
+//      VtSequenceBuilder. Used extensively by VtSequences.cpp
 // Arguments:
-// - pFormat: the pointer to the string to write to the pipe.
-// - ...: a va_list of args to format the string with.
+// - sequence: the sequence to write to the pipe.
 // Return Value:
-// - S_OK, E_INVALIDARG for a invalid format string, or suitable HRESULT error
-//      from writing pipe.
+// - S_OK, E_NOT_SUFFICIENT_BUFFER if the sequence didn't fit in the builder,
+//      or suitable HRESULT error from writing pipe.
 [[nodiscard]]
-HRESULT VtEngine::_WriteFormattedString(const std::string* const pFormat, ...) noexcept
+HRESULT VtEngine::_WriteSequence(const VtSequenceBuilder& sequence) noexcept
 {
-
-    HRESULT hr = E_FAIL;
-    va_list argList;
-    va_start(argList, pFormat);
-
-    int cchNeeded = _scprintf(pFormat->c_str(), argList);
-    // -1 is the _scprintf error case https://msdn.microsoft.com/en-us/library/t32cf9tb.aspx
-    if (cchNeeded > -1)
-    {
-        wistd::unique_ptr<char[]> psz = wil::make_unique_nothrow<char[]>(cchNeeded + 1);
-        RETURN_IF_NULL_ALLOC(psz);
-
-        int cchWritten = _vsnprintf_s(psz.get(), cchNeeded + 1, cchNeeded, pFormat->c_str(), argList);
-        hr = _Write({ psz.get(), gsl::narrow<size_t>(cchWritten) });
-    }
-    else
-    {
-        hr = E_INVALIDARG;
-    }
-
-    va_end(argList);
-    return hr;
+    RETURN_HR_IF(E_NOT_SUFFICIENT_BUFFER, sequence.Overflowed());
+    return _Write(sequence.View());
 }
 
 // Method Description:
@@ -347,6 +401,34 @@ HRESULT VtEngine::GetFontSize(_Out_ COORD* const pFontSize) noexcept
     return S_FALSE;
 }
 
+// Method Description:
+// - Reports whether this engine has to paint before the renderer lets go of the
+//      console lock. Passthrough output, the cursor request and the inherited
+//      cursor are all written into our state by code holding only the console
+//      lock, so they mustn't land in the middle of a frame.
+// Arguments:
+// - <none>
+// Return Value:
+// - true
+bool VtEngine::MustPaintUnderConsoleLock() noexcept
+{
+    return true;
+}
+
+// Method Description:
+// - Reports whether this engine can paint at the same time as the other engines.
+//   Our buffer and the state of the terminal's cursor are also written to by
+//      code that only holds the console lock, not the renderer's, so we paint
+//      on the render thread with the console locked. See MustPaintUnderConsoleLock.
+// Arguments:
+// - <none>
+// Return Value:
+// - false
+bool VtEngine::CanPaintInParallel() noexcept
+{
+    return false;
+}
+
 // Method Description:
 // - Sets the test callback for this instance. Instead of rendering to a pipe,
 //      this instance will instead render to a callback for testing.
@@ -424,6 +506,7 @@ void VtEngine::SetTerminalOwner(Microsoft::Console::ITerminalOwner* const termin
 // - sends a sequence to request the end terminal to tell us the
 //      cursor position. The terminal will reply back on the vt input handle.
 //   Flushes the buffer as well, to make sure the request is sent to the terminal.
+//   Must be called with the console locked.
 // Arguments:
 // - <none>
 // Return Value:
@@ -431,6 +514,8 @@ void VtEngine::SetTerminalOwner(Microsoft::Console::ITerminalOwner* const termin
 HRESULT VtEngine::RequestCursor() noexcept
 {
     RETURN_IF_FAILED(_RequestCursor());
-    RETURN_IF_FAILED(_Flush());
+    const HRESULT hr = _Flush();
+    _CloseOutputIfPipeBroken();
+    RETURN_IF_FAILED(hr);
     return S_OK;
 }
@@ -67,12 +67,17 @@ std::string toPrintableString(const std::string_view& inString)
 void RenderTracing::TraceString(const std::string_view& instr) const
 {
     #ifndef UNIT_TESTING
-    const std::string _seq = toPrintableString(instr);
-    const char* const seq = _seq.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceString",
-                      TraceLoggingString(seq),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    // This is called for every sequence we write. Don't build the printable
+    //      copy of the string unless someone is actually listening.
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+        const std::string _seq = toPrintableString(instr);
+        const char* const seq = _seq.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceString",
+                          TraceLoggingString(seq),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
     #else
     UNREFERENCED_PARAMETER(instr);
     #endif UNIT_TESTING
@@ -117,12 +122,15 @@ std::string _CoordToString(const COORD& c)
 void RenderTracing::TraceInvalidate(const Viewport invalidRect) const
 {
     #ifndef UNIT_TESTING
-    const auto invalidatedStr = _ViewportToString(invalidRect);
-    const auto invalidated = invalidatedStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceInvalidate",
-                      TraceLoggingString(invalidated),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+        const auto invalidatedStr = _ViewportToString(invalidRect);
+        const auto invalidated = invalidatedStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceInvalidate",
+                          TraceLoggingString(invalidated),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
     #else
     UNREFERENCED_PARAMETER(invalidRect);
     #endif UNIT_TESTING
@@ -131,12 +139,15 @@ void RenderTracing::TraceInvalidate(const Viewport invalidRect) const
 void RenderTracing::TraceInvalidateAll(const Viewport viewport) const
 {
     #ifndef UNIT_TESTING
-    const auto invalidatedStr = _ViewportToString(viewport);
-    const auto invalidatedAll = invalidatedStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceInvalidateAll",
-                      TraceLoggingString(invalidatedAll),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+        const auto invalidatedStr = _ViewportToString(viewport);
+        const auto invalidatedAll = invalidatedStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceInvalidateAll",
+                          TraceLoggingString(invalidatedAll),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
     #else
     UNREFERENCED_PARAMETER(viewport);
     #endif UNIT_TESTING
@@ -162,21 +173,24 @@ void RenderTracing::TraceStartPaint(const bool quickReturn,
                                     const bool cursorMoved) const
 {
     #ifndef UNIT_TESTING
-    const auto invalidatedStr = _ViewportToString(invalidRect);
-    const auto invalidated = invalidatedStr.c_str();
-    const auto lastViewStr = _ViewportToString(lastViewport);
-    const auto lastView = lastViewStr.c_str();
-    const auto scrollDeltaStr = _CoordToString(scrollDelt);
-    const auto scrollDelta = scrollDeltaStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceStartPaint",
-                      TraceLoggingBool(quickReturn),
-                      TraceLoggingBool(invalidRectUsed),
-                      TraceLoggingString(invalidated),
-                      TraceLoggingString(lastView),
-                      TraceLoggingString(scrollDelta),
-                      TraceLoggingBool(cursorMoved),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+        const auto invalidatedStr = _ViewportToString(invalidRect);
+        const auto invalidated = invalidatedStr.c_str();
+        const auto lastViewStr = _ViewportToString(lastViewport);
+        const auto lastView = lastViewStr.c_str();
+        const auto scrollDeltaStr = _CoordToString(scrollDelt);
+        const auto scrollDelta = scrollDeltaStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceStartPaint",
+                          TraceLoggingBool(quickReturn),
+                          TraceLoggingBool(invalidRectUsed),
+                          TraceLoggingString(invalidated),
+                          TraceLoggingString(lastView),
+                          TraceLoggingString(scrollDelta),
+                          TraceLoggingBool(cursorMoved),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
     #else
     UNREFERENCED_PARAMETER(quickReturn);
     UNREFERENCED_PARAMETER(invalidRectUsed);
@@ -201,12 +215,15 @@ void RenderTracing::TraceEndPaint() const
 void RenderTracing::TraceLastText(const COORD lastTextPos) const
 {
     #ifndef UNIT_TESTING
-    const auto lastTextStr = _CoordToString(lastTextPos);
-    const auto lastText = lastTextStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceLastText",
-                      TraceLoggingString(lastText),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+        const auto lastTextStr = _CoordToString(lastTextPos);
+        const auto lastText = lastTextStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceLastText",
+                          TraceLoggingString(lastText),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
     #else
     UNREFERENCED_PARAMETER(lastTextPos);
     #endif UNIT_TESTING
@@ -21,6 +21,8 @@ Author(s):
 #include "../../inc/ITerminalOwner.hpp"
 #include "../../types/inc/Viewport.hpp"
 #include "tracing.hpp"
+#include "VtSequenceBuilder.hpp"
+#include "VtPipeWriter.hpp"
 #include <string>
 #include <functional>
 
@@ -32,6 +34,9 @@ namespace Microsoft::Console::Render
         // See _PaintUtf8BufferLine for explanation of this value.
         static const size_t ERASE_CHARACTER_STRING_LENGTH = 8;
         static const COORD INVALID_COORDS;
+        // How much output we'll hold on to while the terminal is behind in
+        //      reading, before we give up on it and repaint from scratch.
+        static constexpr size_t MaxBufferedBytes = VtPipeWriter::DefaultMaxPendingBytes;
 
         VtEngine(_In_ wil::unique_hfile hPipe,
                  const Microsoft::Console::IDefaultColorProvider& colorProvider,
@@ -103,6 +108,9 @@ namespace Microsoft::Console::Render
                                 const int iDpi) noexcept override;
 
         SMALL_RECT GetDirtyRectInChars() override;
+        std::vector<SMALL_RECT> GetDirtyArea() override;
+        bool CanPaintInParallel() noexcept override;
+        bool MustPaintUnderConsoleLock() noexcept override;
         [[nodiscard]]
         HRESULT GetFontSize(_Out_ COORD* const pFontSize) noexcept override;
         [[nodiscard]]
@@ -125,9 +133,16 @@ namespace Microsoft::Console::Render
         void SetTerminalOwner(Microsoft::Console::ITerminalOwner* const terminalOwner);
 
     protected:
-        wil::unique_hfile _hFile;
+        // Writes our frames to the pipe on its own thread. Null when unit
+        //      testing without a pipe.
+        std::unique_ptr<VtPipeWriter> _writer;
         std::string _buffer;
 
+        // Scratch space for painting lines, kept around between frames so
+        //      that painting doesn't need to allocate once they've grown.
+        std::wstring _clusterText;
+        std::string _convertedText;
+
         const Microsoft::Console::IDefaultColorProvider& _colorProvider;
 
         COLORREF _LastFG;
@@ -137,6 +152,11 @@ namespace Microsoft::Console::Render
         Microsoft::Console::Types::Viewport _lastViewport;
         Microsoft::Console::Types::Viewport _invalidRect;
 
+        // The dirty columns of each row of the viewport, as [first, second)
+        //      spans. _invalidRect is the bounds of all of them. Rows with an
+        //      empty span don't need to be repainted.
+        std::vector<std::pair<SHORT, SHORT>> _invalidRows;
+
         bool _fInvalidRectUsed;
         COORD _lastRealCursor;
         COORD _lastText;
@@ -157,6 +177,10 @@ namespace Microsoft::Console::Render
         COORD _deferredCursorPos;
 
         bool _pipeBroken;
+        // The pipe writer timed out the last time we flushed. Until it takes
+        //      a frame again, we don't wait on it.
+        bool _writerBehind;
+        bool _outputClosed; // the terminal owner has been told that the pipe broke
         HRESULT _exitResult;
         Microsoft::Console::ITerminalOwner* _terminalOwner;
 
@@ -165,9 +189,10 @@ namespace Microsoft::Console::Render
         [[nodiscard]]
         HRESULT _Write(std::string_view const str) noexcept;
         [[nodiscard]]
-        HRESULT _WriteFormattedString(const std::string* const pFormat, ...) noexcept;
+        HRESULT _WriteSequence(const VtSequenceBuilder& sequence) noexcept;
         [[nodiscard]]
         HRESULT _Flush() noexcept;
+        void _CloseOutputIfPipeBroken() noexcept;
 
         void _OrRect(_Inout_ SMALL_RECT* const pRectExisting, const SMALL_RECT* const pRectToOr) const;
         [[nodiscard]]
@@ -259,9 +284,9 @@ namespace Microsoft::Console::Render
                                       const COORD coord) noexcept;
 
         [[nodiscard]]
-        HRESULT _WriteTerminalUtf8(const std::wstring& str) noexcept;
+        HRESULT _WriteTerminalUtf8(const std::wstring_view str) noexcept;
         [[nodiscard]]
-        HRESULT _WriteTerminalAscii(const std::wstring& str) noexcept;
+        HRESULT _WriteTerminalAscii(const std::wstring_view str) noexcept;
 
         [[nodiscard]]
         virtual HRESULT _DoUpdateTitle(const std::wstring& newTitle) noexcept override;
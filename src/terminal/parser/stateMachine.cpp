@@ -6,6 +6,12 @@
 #include "stateMachine.hpp"
 
 #include "ascii.hpp"
+#include "../../inc/unicode.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
 
 using namespace Microsoft::Console::VirtualTerminal;
 
@@ -25,7 +31,8 @@ StateMachine::StateMachine(IStateMachineEngine* const pEngine) :
     // rgusParams Initialized below
     _sOscNextChar(0),
     _sOscParam(0),
-    _currRunLength(0)
+    _currRunLength(0),
+    _fProcessingIndividually(false)
 {
     ZeroMemory(_pwchOscStringBuffer, sizeof(_pwchOscStringBuffer));
     ZeroMemory(_rgusParams, sizeof(_rgusParams));
@@ -42,251 +49,140 @@ IStateMachineEngine& StateMachine::Engine() noexcept
     return *_pEngine;
 }
 
+#if defined(_M_X64) || defined(_M_IX86)
 // Routine Description:
-// - Determines if a character indicates an action that should be taken in the ground state -
-//     These are C0 characters and the C1 [single-character] CSI.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsActionableFromGround(const wchar_t wch)
-{
-    return (wch <= AsciiChars::US) || s_IsC1Csi(wch) || s_IsDelete(wch);
-}
-
-// Routine Description:
-// - Determines if a character belongs to the C0 escape range.
-//   This is character sequences less than a space character (null, backspace, new line, etc.)
-//   See also https://en.wikipedia.org/wiki/C0_and_C1_control_codes
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsC0Code(const wchar_t wch)
-{
-    return (wch >= AsciiChars::NUL && wch <= AsciiChars::ETB) ||
-           wch == AsciiChars::EM ||
-           (wch >= AsciiChars::FS && wch <= AsciiChars::US);
-}
-
-// Routine Description:
-// - Determines if a character is a C1 CSI (Control Sequence Introducer)
-//   This is a single-character way to start a control sequence, as opposed to "ESC[".
-//
-//   Not all single-byte codepages support C1 control codes--in some, the range that would
-//   be used for C1 codes are instead used for additional graphic characters.
-//
-//   However, we do not need to worry about confusion whether a single byte \x9b in a
-//   single-byte stream represents a C1 CSI or some other glyph, because by the time we
-//   get here, everything is Unicode. Knowing whether a single-byte \x9b represents a
-//   single-character C1 CSI or some other glyph is handled by MultiByteToWideChar before
-//   we get here (if the stream was not already UTF-16). For instance, in CP_ACP, if a
-//   \x9b shows up, it will get converted to \x203a. So, if we get here, and have a
-//   \x009b, we know that it unambiguously represents a C1 CSI.
-//
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsC1Csi(const wchar_t wch)
-{
-    return wch == L'\x9b';
-}
-
-// Routine Description:
-// - Determines if a character is a valid intermediate in an VT escape sequence.
-//   Intermediates are punctuation type characters that are generally vendor specific and
-//   modify the operational mode of a command.
-//   See also http://vt100.net/emu/dec_ansi_parser
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsIntermediate(const wchar_t wch)
-{
-    return wch >= L' ' && wch <= L'/'; // 0x20 - 0x2F
-}
-
-// Routine Description:
-// - Determines if a character is the delete character.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsDelete(const wchar_t wch)
-{
-    return wch == AsciiChars::DEL;
-}
-
-// Routine Description:
-// - Determines if a character is the escape character.
-//   Used to start escape sequences.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsEscape(const wchar_t wch)
-{
-    return wch == AsciiChars::ESC;
-}
-
-// Routine Description:
-// - Determines if a character is "control sequence" beginning indicator.
-//   This immediately follows an escape and signifies a varying length control sequence.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsCsiIndicator(const wchar_t wch)
-{
-    return wch == L'['; // 0x5B
-}
-
-// Routine Description:
-// - Determines if a character is a delimiter between two parameters in a "control sequence"
-//   This occurs in the middle of a control sequence after escape and CsiIndicator have been recognized
-//   between a series of parameters.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsCsiDelimiter(const wchar_t wch)
-{
-    return wch == L';'; // 0x3B
-}
-
-// Routine Description:
-// - Determines if a character is a valid parameter value
-//   Parameters must be numerical digits.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsCsiParamValue(const wchar_t wch)
-{
-    return wch >= L'0' && wch <= L'9'; // 0x30 - 0x39
-}
-
-// Routine Description:
-// - Determines if a character is a private range marker for a control sequence.
-//   Private range markers indicate vendor-specific behavior.
+// - Determines whether the processor and OS support AVX2. We need both the
+//   CPUID feature bit and OS support for saving the YMM registers (XGETBV).
 // Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsCsiPrivateMarker(const wchar_t wch)
-{
-    return wch == L'<' || wch == L'=' || wch == L'>' || wch == L'?'; // 0x3C - 0x3F
-}
-
-// Routine Description:
-// - Determines if a character is invalid in a control sequence
-// Arguments:
-// - wch - Character to check.
+// - <none>
 // Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsCsiInvalid(const wchar_t wch)
+// - True if AVX2 instructions can be used. False otherwise.
+static bool _IsAvx2Supported() noexcept
 {
-    return wch == L':'; // 0x3A
-}
+    int rgCpuInfo[4]{};
+    __cpuid(rgCpuInfo, 0);
+    if (rgCpuInfo[0] < 7)
+    {
+        return false;
+    }
 
-// Routine Description:
-// - Determines if a character is "operating system control string" beginning
-//      indicator.
-//   This immediately follows an escape and signifies a  signifies a varying
-//      length control sequence, quite similar to CSI.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsSs3Indicator(const wchar_t wch)
-{
-    return wch == L'O'; // 0x4F
-}
+    __cpuid(rgCpuInfo, 1);
+    const bool fOsXsave = WI_IsFlagSet(rgCpuInfo[2], 1 << 27);
+    const bool fAvx = WI_IsFlagSet(rgCpuInfo[2], 1 << 28);
+    if (!fOsXsave || !fAvx || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
 
-// Routine Description:
-// - Determines if a character is a "Single Shift Select" indicator.
-//   This immediately follows an escape and signifies a varying length control string.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsOscIndicator(const wchar_t wch)
-{
-    return wch == L']'; // 0x5D
+    __cpuidex(rgCpuInfo, 7, 0);
+    return WI_IsFlagSet(rgCpuInfo[1], 1 << 5);
 }
 
-// Routine Description:
-// - Determines if a character is a delimiter between two parameters in a "operating system control sequence"
-//   This occurs in the middle of a control sequence after escape and OscIndicator have been recognized,
-//   after the paramater indicating which OSC action to take.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsOscDelimiter(const wchar_t wch)
-{
-    return wch == L';'; // 0x3B
-}
+static const bool s_fAvx2Supported = _IsAvx2Supported();
 
 // Routine Description:
-// - Determines if a character is a valid parameter value for an OSC String,
-//     that is, the indicator of which OSC action to take.
-//   Parameters must be numerical digits.
+// - Scans 16 characters at a time for the first character that is actionable
+//      from the ground state (see s_IsActionableFromGround).
 // Arguments:
-// - wch - Character to check.
+// - pwch - The first character to scan.
+// - pwchEnd - One past the last character to scan.
 // Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsOscParamValue(const wchar_t wch)
-{
-    return s_IsNumber(wch); // 0x30 - 0x39
+// - A pointer to the first actionable character, or to the first character
+//      of the trailing partial block if none was found.
+static const wchar_t* _FindActionableAvx2(const wchar_t* pwch, const wchar_t* const pwchEnd) noexcept
+{
+    const __m256i vC0Max = _mm256_set1_epi16(AsciiChars::US);
+    const __m256i vDel = _mm256_set1_epi16(AsciiChars::DEL);
+    const __m256i vC1Csi = _mm256_set1_epi16(L'\x9b');
+    const __m256i vZero = _mm256_setzero_si256();
+    // Clear the upper halves of the YMM registers on every way out, so the SSE2 code
+    // that runs next doesn't pay for the transition.
+    auto zeroUpper = wil::scope_exit([]() noexcept { _mm256_zeroupper(); });
+
+    while (pwchEnd - pwch >= 16)
+    {
+        const __m256i vChars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pwch));
+        // There's no unsigned 16-bit compare, but (wch - US) saturates to 0 exactly when wch <= US.
+        const __m256i vIsC0 = _mm256_cmpeq_epi16(_mm256_subs_epu16(vChars, vC0Max), vZero);
+        const __m256i vIsDel = _mm256_cmpeq_epi16(vChars, vDel);
+        const __m256i vIsC1Csi = _mm256_cmpeq_epi16(vChars, vC1Csi);
+        const unsigned long ulMask = static_cast<unsigned long>(_mm256_movemask_epi8(_mm256_or_si256(vIsC0, _mm256_or_si256(vIsDel, vIsC1Csi))));
+        if (ulMask != 0)
+        {
+            unsigned long ulIndex;
+            _BitScanForward(&ulIndex, ulMask);
+            // movemask gives us one bit per byte, so two bits per character.
+            return pwch + (ulIndex / 2);
+        }
+        pwch += 16;
+    }
+    return pwch;
 }
 
 // Routine Description:
-// - Determines if a character should be initiate the end of an OSC sequence.
+// - Scans 8 characters at a time for the first character that is actionable
+//      from the ground state (see s_IsActionableFromGround).
 // Arguments:
-// - wch - Character to check.
+// - pwch - The first character to scan.
+// - pwchEnd - One past the last character to scan.
 // Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsOscTerminationInitiator(const wchar_t wch)
-{
-    return wch == AsciiChars::ESC;
-}
+// - A pointer to the first actionable character, or to the first character
+//      of the trailing partial block if none was found.
+static const wchar_t* _FindActionableSse2(const wchar_t* pwch, const wchar_t* const pwchEnd) noexcept
+{
+    const __m128i vC0Max = _mm_set1_epi16(AsciiChars::US);
+    const __m128i vDel = _mm_set1_epi16(AsciiChars::DEL);
+    const __m128i vC1Csi = _mm_set1_epi16(L'\x9b');
+    const __m128i vZero = _mm_setzero_si128();
+
+    while (pwchEnd - pwch >= 8)
+    {
+        const __m128i vChars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pwch));
+        // There's no unsigned 16-bit compare, but (wch - US) saturates to 0 exactly when wch <= US.
+        const __m128i vIsC0 = _mm_cmpeq_epi16(_mm_subs_epu16(vChars, vC0Max), vZero);
+        const __m128i vIsDel = _mm_cmpeq_epi16(vChars, vDel);
+        const __m128i vIsC1Csi = _mm_cmpeq_epi16(vChars, vC1Csi);
+        const unsigned long ulMask = static_cast<unsigned long>(_mm_movemask_epi8(_mm_or_si128(vIsC0, _mm_or_si128(vIsDel, vIsC1Csi))));
+        if (ulMask != 0)
+        {
+            unsigned long ulIndex;
+            _BitScanForward(&ulIndex, ulMask);
+            // movemask gives us one bit per byte, so two bits per character.
+            return pwch + (ulIndex / 2);
+        }
+        pwch += 8;
+    }
 
-// Routine Description:
-// - Determines if a character should be ignored in a operating system control sequence
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsOscInvalid(const wchar_t wch)
-{
-    return wch <= L'\x17' ||
-           wch == L'\x19' ||
-           (wch >= L'\x1c' && wch <= L'\x1f') ;
+    return pwch;
 }
+#endif
 
 // Routine Description:
-// - Determines if a character is "operating system control string" termination indicator.
-//   This signals the end of an OSC string collection.
+// - Finds the next character in the given range that is actionable from the
+//      ground state. Everything before it is a printable run that can be
+//      handed to the engine in one ActionPrintString call.
+//   Uses AVX2 or SSE2 where available and falls back to a scalar loop for
+//      the tail of the range (and on other architectures).
 // Arguments:
-// - wch - Character to check.
+// - pwch - The first character to scan.
+// - pwchEnd - One past the last character to scan.
 // Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsOscTerminator(const wchar_t wch)
+// - A pointer to the first actionable character, or pwchEnd if there isn't one.
+const wchar_t* StateMachine::s_FindActionableFromGround(const wchar_t* pwch, const wchar_t* const pwchEnd) noexcept
 {
-    return wch == L'\x7' || wch == L'\x9C'; // Bell character or C1 terminator
-}
+#if defined(_M_X64) || defined(_M_IX86)
+    if (s_fAvx2Supported)
+    {
+        pwch = _FindActionableAvx2(pwch, pwchEnd);
+    }
+    pwch = _FindActionableSse2(pwch, pwchEnd);
+#endif
 
-// Routine Description:
-// - Determines if a character is a valid number character, 0-9.
-// Arguments:
-// - wch - Character to check.
-// Return Value:
-// - True if it is. False if it isn't.
-bool StateMachine::s_IsNumber(const wchar_t wch)
-{
-    return wch >= L'0' && wch <= L'9'; // 0x30 - 0x39
+    while (pwch < pwchEnd && !s_IsActionableFromGround(*pwch))
+    {
+        pwch++;
+    }
+    return pwch;
 }
 
 // Routine Description:
@@ -790,207 +686,600 @@ void StateMachine::_EnterSs3Param()
 }
 
 // Routine Description:
-// - Processes a character event into an Action that occurs while in the Ground state.
-//   Events in this state will:
-//   1. Execute C0 control characters
-//   2. Handle a C1 Control Sequence Introducer
-//   3. Print all other characters
+// - Sorts a character into the class that the state transitions depend on.
+//   The classes are built from the s_Is* predicates, so that those stay the
+//      only definition of each kind of character. This is only used to build
+//      s_charClassTable at compile time.
 // Arguments:
-// - wch - Character that triggered the event
+// - wch - Character to classify. Must be less than s_wchFirstOther.
 // Return Value:
-// - <none>
-void StateMachine::_EventGround(const wchar_t wch)
+// - The character's class.
+constexpr StateMachine::VTCharClass StateMachine::s_ClassifyChar(const wchar_t wch) noexcept
 {
-    _trace.TraceOnEvent(L"Ground");
-    if (s_IsC0Code(wch) || s_IsDelete(wch))
+    if (s_IsEscape(wch))
     {
-        _ActionExecute(wch);
+        return VTCharClass::Escape;
     }
-    else if (s_IsC1Csi(wch))
+    else if (s_IsOscTerminator(wch))
     {
-        _EnterCsiEntry();
+        // BEL is also a C0 control that's executed outside of OSC strings.
+        return s_IsC0Code(wch) ? VTCharClass::Bell : VTCharClass::C1St;
     }
-    else
+    else if (s_IsC0Code(wch))
     {
-        _ActionPrint(wch);
+        return VTCharClass::C0;
     }
-}
-
-// Routine Description:
-// - Processes a character event into an Action that occurs while in the Escape state.
-//   Events in this state will:
-//   1. Execute C0 control characters
-//   2. Ignore Delete characters
-//   3. Collect Intermediate characters
-//   4. Enter Control Sequence state
-//   5. Dispatch an Escape action.
-// Arguments:
-// - wch - Character that triggered the event
-// Return Value:
-// - <none>
-void StateMachine::_EventEscape(const wchar_t wch)
-{
-    _trace.TraceOnEvent(L"Escape");
-    if (s_IsC0Code(wch))
+    else if (wch <= L'\x1f')
     {
-        if (_pEngine->DispatchControlCharsFromEscape())
-        {
-            _ActionExecuteFromEscape(wch);
-            _EnterGround();
-        }
-        else
-        {
-            _ActionExecute(wch);
-        }
+        // The only C0 controls that s_IsC0Code leaves out, besides ESC.
+        return VTCharClass::CanSub;
     }
-    else if (s_IsDelete(wch))
+    else if (s_IsIntermediate(wch))
     {
-        _ActionIgnore();
+        return VTCharClass::Intermediate;
     }
-    else if (s_IsIntermediate(wch))
+    else if (s_IsCsiParamValue(wch))
     {
-        _ActionCollect(wch);
-        _EnterEscapeIntermediate();
+        return VTCharClass::Digit;
     }
-    else if (s_IsCsiIndicator(wch))
+    else if (s_IsCsiInvalid(wch))
     {
-        _EnterCsiEntry();
+        return VTCharClass::Colon;
     }
-    else if (s_IsOscIndicator(wch))
+    else if (s_IsCsiDelimiter(wch))
     {
-        _EnterOscParam();
+        return VTCharClass::Semicolon;
     }
-    else if (s_IsSs3Indicator(wch))
+    else if (s_IsCsiPrivateMarker(wch))
     {
-        _EnterSs3Entry();
+        return VTCharClass::PrivateMarker;
     }
-    else
+    else if (s_IsCsiIndicator(wch))
     {
-        _ActionEscDispatch(wch);
-        _EnterGround();
+        return VTCharClass::CsiIndicator;
     }
-}
-
-// Routine Description:
-// - Processes a character event into an Action that occurs while in the EscapeIntermediate state.
-//   Events in this state will:
-//   1. Execute C0 control characters
-//   2. Ignore Delete characters
-//   3. Collect Intermediate characters
-//   4. Dispatch an Escape action.
-// Arguments:
-// - wch - Character that triggered the event
-// Return Value:
-// - <none>
-void StateMachine::_EventEscapeIntermediate(const wchar_t wch)
-{
-    _trace.TraceOnEvent(L"EscapeIntermediate");
-    if (s_IsC0Code(wch))
+    else if (s_IsOscIndicator(wch))
     {
-        _ActionExecute(wch);
+        return VTCharClass::OscIndicator;
     }
-    else if (s_IsIntermediate(wch))
+    else if (s_IsSs3Indicator(wch))
     {
-        _ActionCollect(wch);
+        return VTCharClass::Ss3Indicator;
     }
     else if (s_IsDelete(wch))
     {
-        _ActionIgnore();
+        return VTCharClass::Delete;
     }
-    else
+    else if (s_IsC1Csi(wch))
     {
-        _ActionEscDispatch(wch);
-        _EnterGround();
+        return VTCharClass::C1Csi;
     }
+    return VTCharClass::Other;
 }
 
 // Routine Description:
-// - Processes a character event into an Action that occurs while in the CsiEntry state.
-//   Events in this state will:
-//   1. Execute C0 control characters
-//   2. Ignore Delete characters
-//   3. Collect Intermediate characters
-//   4. Begin to ignore all remaining parameters when an invalid character is detected (CsiIgnore)
-//   5. Store parameter data
-//   6. Collect Control Sequence Private markers
-//   7. Dispatch a control sequence with parameters for action
+// - Determines what to do with a character of the given class in the given state.
+//   This follows the state diagram at http://vt100.net/emu/dec_ansi_parser,
+//      and is only used to build s_transitionTable at compile time.
 // Arguments:
-// - wch - Character that triggered the event
+// - state - The state the character arrives in.
+// - charClass - The class of the character.
 // Return Value:
-// - <none>
-void StateMachine::_EventCsiEntry(const wchar_t wch)
+// - The action to take, and the state to enter after.
+constexpr StateMachine::VTTransition StateMachine::s_BuildTransition(const VTStates state, const VTCharClass charClass) noexcept
 {
-    _trace.TraceOnEvent(L"CsiEntry");
-    if (s_IsC0Code(wch))
-    {
-        _ActionExecute(wch);
-    }
-    else if (s_IsDelete(wch))
-    {
-        _ActionIgnore();
-    }
-    else if (s_IsIntermediate(wch))
-    {
-        _ActionCollect(wch);
-        _EnterCsiIntermediate();
-    }
-    else if (s_IsCsiInvalid(wch))
-    {
-        _EnterCsiIgnore();
-    }
-    else if (s_IsCsiParamValue(wch) || s_IsCsiDelimiter(wch))
-    {
-        _ActionParam(wch);
-        _EnterCsiParam();
-    }
-    else if (s_IsCsiPrivateMarker(wch))
+    using C = VTCharClass;
+    using A = VTActions;
+
+    const VTTransition stay = { A::None, false, state };
+    const auto enter = [](const VTActions action, const VTStates nextState) constexpr {
+        return VTTransition{ action, true, nextState };
+    };
+
+    // "From anywhere" events come first.
+    //      CAN and SUB are executed, and always take us back to ground.
+    //      ESC starts a new escape sequence - except in the OSC string state,
+    //      where it can begin the termination of the string.
+    if (charClass == C::CanSub)
     {
-        _ActionCollect(wch);
-        _EnterCsiParam();
+        return enter(A::Execute, VTStates::Ground);
     }
-    else
+    else if (charClass == C::Escape)
     {
-        _ActionCsiDispatch(wch);
-        _EnterGround();
+        return enter(A::None, state == VTStates::OscString ? VTStates::OscTermination : VTStates::Escape);
     }
-}
 
-// Routine Description:
-// - Processes a character event into an Action that occurs while in the CsiIntermediate state.
-//   Events in this state will:
-//   1. Execute C0 control characters
-//   2. Ignore Delete characters
-//   3. Collect Intermediate characters
-//   4. Begin to ignore all remaining parameters when an invalid character is detected (CsiIgnore)
-//   5. Dispatch a control sequence with parameters for action
-// Arguments:
-// - wch - Character that triggered the event
-// Return Value:
-// - <none>
-void StateMachine::_EventCsiIntermediate(const wchar_t wch)
-{
-    _trace.TraceOnEvent(L"CsiIntermediate");
-    if (s_IsC0Code(wch))
-    {
-        _ActionExecute(wch);
-    }
-    else if (s_IsIntermediate(wch))
+    const bool fIsC0 = (charClass == C::C0 || charClass == C::Bell);
+    const bool fIsCsiParam = (charClass == C::Digit || charClass == C::Semicolon);
+    const bool fIsCsiIgnorable = (fIsCsiParam || charClass == C::Colon || charClass == C::PrivateMarker);
+
+    switch (state)
     {
-        _ActionCollect(wch);
+    case VTStates::Ground:
+        if (fIsC0 || charClass == C::Delete)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::C1Csi)
+        {
+            return enter(A::None, VTStates::CsiEntry);
+        }
+        return { A::Print, false, state };
+
+    case VTStates::Escape:
+        if (fIsC0)
+        {
+            return { A::ExecuteFromEscape, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        else if (charClass == C::Intermediate)
+        {
+            return enter(A::Collect, VTStates::EscapeIntermediate);
+        }
+        else if (charClass == C::CsiIndicator)
+        {
+            return enter(A::None, VTStates::CsiEntry);
+        }
+        else if (charClass == C::OscIndicator)
+        {
+            return enter(A::None, VTStates::OscParam);
+        }
+        else if (charClass == C::Ss3Indicator)
+        {
+            return enter(A::None, VTStates::Ss3Entry);
+        }
+        return enter(A::EscDispatch, VTStates::Ground);
+
+    case VTStates::EscapeIntermediate:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Intermediate)
+        {
+            return { A::Collect, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        return enter(A::EscDispatch, VTStates::Ground);
+
+    case VTStates::CsiEntry:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        else if (charClass == C::Intermediate)
+        {
+            return enter(A::Collect, VTStates::CsiIntermediate);
+        }
+        else if (charClass == C::Colon)
+        {
+            return enter(A::None, VTStates::CsiIgnore);
+        }
+        else if (fIsCsiParam)
+        {
+            return enter(A::Param, VTStates::CsiParam);
+        }
+        else if (charClass == C::PrivateMarker)
+        {
+            return enter(A::Collect, VTStates::CsiParam);
+        }
+        return enter(A::CsiDispatch, VTStates::Ground);
+
+    case VTStates::CsiIntermediate:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Intermediate)
+        {
+            return { A::Collect, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        else if (fIsCsiIgnorable)
+        {
+            return enter(A::None, VTStates::CsiIgnore);
+        }
+        return enter(A::CsiDispatch, VTStates::Ground);
+
+    case VTStates::CsiIgnore:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Delete || charClass == C::Intermediate || fIsCsiIgnorable)
+        {
+            return { A::Ignore, false, state };
+        }
+        return enter(A::None, VTStates::Ground);
+
+    case VTStates::CsiParam:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        else if (fIsCsiParam)
+        {
+            return { A::Param, false, state };
+        }
+        else if (charClass == C::Intermediate)
+        {
+            return enter(A::Collect, VTStates::CsiIntermediate);
+        }
+        else if (charClass == C::Colon || charClass == C::PrivateMarker)
+        {
+            return enter(A::None, VTStates::CsiIgnore);
+        }
+        return enter(A::CsiDispatch, VTStates::Ground);
+
+    case VTStates::OscParam:
+        if (charClass == C::Bell || charClass == C::C1St)
+        {
+            return enter(A::None, VTStates::Ground);
+        }
+        else if (charClass == C::Digit)
+        {
+            return { A::OscParam, false, state };
+        }
+        else if (charClass == C::Semicolon)
+        {
+            return enter(A::None, VTStates::OscString);
+        }
+        return { A::Ignore, false, state };
+
+    case VTStates::OscString:
+        if (charClass == C::Bell || charClass == C::C1St)
+        {
+            return enter(A::OscDispatch, VTStates::Ground);
+        }
+        else if (charClass == C::C0)
+        {
+            return { A::Ignore, false, state };
+        }
+        return { A::OscPut, false, state };
+
+    case VTStates::OscTermination:
+        return enter(A::OscDispatch, VTStates::Ground);
+
+    case VTStates::Ss3Entry:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        else if (charClass == C::Colon)
+        {
+            // It's safe for us to go into the CSI ignore here, because both SS3 and
+            //      CSI sequences ignore characters the same way.
+            return enter(A::None, VTStates::CsiIgnore);
+        }
+        else if (fIsCsiParam)
+        {
+            return enter(A::Param, VTStates::Ss3Param);
+        }
+        return enter(A::Ss3Dispatch, VTStates::Ground);
+
+    case VTStates::Ss3Param:
+        if (fIsC0)
+        {
+            return { A::Execute, false, state };
+        }
+        else if (charClass == C::Delete)
+        {
+            return { A::Ignore, false, state };
+        }
+        else if (fIsCsiParam)
+        {
+            return { A::Param, false, state };
+        }
+        else if (charClass == C::Colon || charClass == C::PrivateMarker)
+        {
+            return enter(A::None, VTStates::CsiIgnore);
+        }
+        return enter(A::Ss3Dispatch, VTStates::Ground);
+
+    default:
+        return stay;
     }
-    else if (s_IsDelete(wch))
+}
+
+constexpr StateMachine::VTCharClassTable StateMachine::s_BuildCharClassTable() noexcept
+{
+    VTCharClassTable table{};
+    for (size_t i = 0; i < table.size(); i++)
     {
-        _ActionIgnore();
+        table[i] = s_ClassifyChar(static_cast<wchar_t>(i));
     }
-    else if (s_IsCsiParamValue(wch) || s_IsCsiInvalid(wch) || s_IsCsiDelimiter(wch) || s_IsCsiPrivateMarker(wch))
+    return table;
+}
+
+constexpr StateMachine::VTTransitionTable StateMachine::s_BuildTransitionTable() noexcept
+{
+    VTTransitionTable table{};
+    for (size_t state = 0; state < s_cStates; state++)
     {
-        _EnterCsiIgnore();
+        for (size_t charClass = 0; charClass < s_cCharClasses; charClass++)
+        {
+            table[state][charClass] = s_BuildTransition(static_cast<VTStates>(state), static_cast<VTCharClass>(charClass));
+        }
     }
-    else
+    return table;
+}
+
+// Both tables are generated by the compiler, so there's no work done at runtime to set them up.
+constexpr StateMachine::VTCharClassTable StateMachine::s_charClassTable = StateMachine::s_BuildCharClassTable();
+constexpr StateMachine::VTTransitionTable StateMachine::s_transitionTable = StateMachine::s_BuildTransitionTable();
+
+// Routine Description:
+// - Checks that the character classes agree with the predicates that
+//      s_ClassifyChar doesn't use directly, and with the ground state scan,
+//      so that the table and the predicates can't drift apart.
+// Arguments:
+// - <none>
+// Return Value:
+// - True if every character below s_wchFirstOther agrees. False otherwise.
+constexpr bool StateMachine::s_CharClassTableMatchesPredicates() noexcept
+{
+    for (size_t i = 0; i < s_charClassTable.size(); i++)
+    {
+        const wchar_t wch = static_cast<wchar_t>(i);
+        const VTCharClass charClass = s_charClassTable[i];
+
+        const bool fActionable = charClass == VTCharClass::C0 ||
+                                 charClass == VTCharClass::Bell ||
+                                 charClass == VTCharClass::CanSub ||
+                                 charClass == VTCharClass::Escape ||
+                                 charClass == VTCharClass::Delete ||
+                                 charClass == VTCharClass::C1Csi;
+        if (s_IsActionableFromGround(wch) != fActionable ||
+            s_IsNumber(wch) != (charClass == VTCharClass::Digit) ||
+            s_IsOscParamValue(wch) != (charClass == VTCharClass::Digit) ||
+            s_IsOscDelimiter(wch) != (charClass == VTCharClass::Semicolon) ||
+            s_IsOscTerminationInitiator(wch) != (charClass == VTCharClass::Escape) ||
+            s_IsOscInvalid(wch) != (charClass == VTCharClass::C0 || charClass == VTCharClass::Bell))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Routine Description:
+// - Looks up the class of a character for the transition table.
+// Arguments:
+// - wch - Character to classify.
+// Return Value:
+// - The character's class.
+StateMachine::VTCharClass StateMachine::s_GetCharClass(const wchar_t wch) noexcept
+{
+    static_assert(s_CharClassTableMatchesPredicates(), "s_charClassTable disagrees with the s_Is* predicates");
+    return wch < s_wchFirstOther ? s_charClassTable[wch] : VTCharClass::Other;
+}
+
+// Routine Description:
+// - Looks up what to do with a character in the given state.
+// Arguments:
+// - state - The state the character arrives in.
+// - wch - The character.
+// Return Value:
+// - The action to take, and the state to enter after.
+const StateMachine::VTTransition& StateMachine::s_GetTransition(const VTStates state, const wchar_t wch) noexcept
+{
+    return s_transitionTable[static_cast<size_t>(state)][static_cast<size_t>(s_GetCharClass(wch))];
+}
+
+// Routine Description:
+// - Moves the state machine into the given state, running the state's entry actions.
+// Arguments:
+// - state - The state to enter.
+// Return Value:
+// - <none>
+void StateMachine::_EnterState(const VTStates state)
+{
+    switch (state)
+    {
+    case VTStates::Ground:
+        return _EnterGround();
+    case VTStates::Escape:
+        return _EnterEscape();
+    case VTStates::EscapeIntermediate:
+        return _EnterEscapeIntermediate();
+    case VTStates::CsiEntry:
+        return _EnterCsiEntry();
+    case VTStates::CsiIntermediate:
+        return _EnterCsiIntermediate();
+    case VTStates::CsiIgnore:
+        return _EnterCsiIgnore();
+    case VTStates::CsiParam:
+        return _EnterCsiParam();
+    case VTStates::OscParam:
+        return _EnterOscParam();
+    case VTStates::OscString:
+        return _EnterOscString();
+    case VTStates::OscTermination:
+        return _EnterOscTermination();
+    case VTStates::Ss3Entry:
+        return _EnterSs3Entry();
+    case VTStates::Ss3Param:
+        return _EnterSs3Param();
+    default:
+        return;
+    }
+}
+
+// Routine Description:
+// - Performs the action for a transition from the table, then enters the
+//      transition's next state (if it has one).
+// Arguments:
+// - wch - Character that triggered the transition
+// - transition - The entry from the transition table for wch in the current state.
+// Return Value:
+// - <none>
+void StateMachine::_ExecuteTransition(const wchar_t wch, const VTTransition& transition)
+{
+    switch (transition.action)
     {
+    case VTActions::Ignore:
+        _ActionIgnore();
+        break;
+    case VTActions::Execute:
+        _ActionExecute(wch);
+        break;
+    case VTActions::ExecuteFromEscape:
+        if (_pEngine->DispatchControlCharsFromEscape())
+        {
+            _ActionExecuteFromEscape(wch);
+            _EnterGround();
+        }
+        else
+        {
+            _ActionExecute(wch);
+        }
+        break;
+    case VTActions::Print:
+        _ActionPrint(wch);
+        break;
+    case VTActions::Collect:
+        _ActionCollect(wch);
+        break;
+    case VTActions::Param:
+        _ActionParam(wch);
+        break;
+    case VTActions::EscDispatch:
+        _ActionEscDispatch(wch);
+        break;
+    case VTActions::CsiDispatch:
         _ActionCsiDispatch(wch);
-        _EnterGround();
+        break;
+    case VTActions::OscParam:
+        _ActionOscParam(wch);
+        break;
+    case VTActions::OscPut:
+        _ActionOscPut(wch);
+        break;
+    case VTActions::OscDispatch:
+        _ActionOscDispatch(wch);
+        break;
+    case VTActions::Ss3Dispatch:
+        _ActionSs3Dispatch(wch);
+        break;
+    case VTActions::None:
+    default:
+        break;
     }
+
+    if (transition.fEnterState)
+    {
+        _EnterState(transition.nextState);
+    }
+}
+
+// Routine Description:
+// - Processes a character event into an Action that occurs while in the Ground state.
+//   Events in this state will:
+//   1. Execute C0 control characters
+//   2. Handle a C1 Control Sequence Introducer
+//   3. Print all other characters
+// Arguments:
+// - wch - Character that triggered the event
+// Return Value:
+// - <none>
+void StateMachine::_EventGround(const wchar_t wch)
+{
+    _trace.TraceOnEvent(L"Ground");
+    _ExecuteTransition(wch, s_GetTransition(VTStates::Ground, wch));
+}
+
+// Routine Description:
+// - Processes a character event into an Action that occurs while in the Escape state.
+//   Events in this state will:
+//   1. Execute C0 control characters
+//   2. Ignore Delete characters
+//   3. Collect Intermediate characters
+//   4. Enter Control Sequence state
+//   5. Dispatch an Escape action.
+// Arguments:
+// - wch - Character that triggered the event
+// Return Value:
+// - <none>
+void StateMachine::_EventEscape(const wchar_t wch)
+{
+    _trace.TraceOnEvent(L"Escape");
+    _ExecuteTransition(wch, s_GetTransition(VTStates::Escape, wch));
+}
+
+// Routine Description:
+// - Processes a character event into an Action that occurs while in the EscapeIntermediate state.
+//   Events in this state will:
+//   1. Execute C0 control characters
+//   2. Ignore Delete characters
+//   3. Collect Intermediate characters
+//   4. Dispatch an Escape action.
+// Arguments:
+// - wch - Character that triggered the event
+// Return Value:
+// - <none>
+void StateMachine::_EventEscapeIntermediate(const wchar_t wch)
+{
+    _trace.TraceOnEvent(L"EscapeIntermediate");
+    _ExecuteTransition(wch, s_GetTransition(VTStates::EscapeIntermediate, wch));
+}
+
+// Routine Description:
+// - Processes a character event into an Action that occurs while in the CsiEntry state.
+//   Events in this state will:
+//   1. Execute C0 control characters
+//   2. Ignore Delete characters
+//   3. Collect Intermediate characters
+//   4. Begin to ignore all remaining parameters when an invalid character is detected (CsiIgnore)
+//   5. Store parameter data
+//   6. Collect Control Sequence Private markers
+//   7. Dispatch a control sequence with parameters for action
+// Arguments:
+// - wch - Character that triggered the event
+// Return Value:
+// - <none>
+void StateMachine::_EventCsiEntry(const wchar_t wch)
+{
+    _trace.TraceOnEvent(L"CsiEntry");
+    _ExecuteTransition(wch, s_GetTransition(VTStates::CsiEntry, wch));
+}
+
+// Routine Description:
+// - Processes a character event into an Action that occurs while in the CsiIntermediate state.
+//   Events in this state will:
+//   1. Execute C0 control characters
+//   2. Ignore Delete characters
+//   3. Collect Intermediate characters
+//   4. Begin to ignore all remaining parameters when an invalid character is detected (CsiIgnore)
+//   5. Dispatch a control sequence with parameters for action
+// Arguments:
+// - wch - Character that triggered the event
+// Return Value:
+// - <none>
+void StateMachine::_EventCsiIntermediate(const wchar_t wch)
+{
+    _trace.TraceOnEvent(L"CsiIntermediate");
+    _ExecuteTransition(wch, s_GetTransition(VTStates::CsiIntermediate, wch));
 }
 
 // Routine Description:
@@ -1008,26 +1297,7 @@ void StateMachine::_EventCsiIntermediate(const wchar_t wch)
 void StateMachine::_EventCsiIgnore(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"CsiIgnore");
-    if (s_IsC0Code(wch))
-    {
-        _ActionExecute(wch);
-    }
-    else if (s_IsDelete(wch))
-    {
-        _ActionIgnore();
-    }
-    else if (s_IsIntermediate(wch))
-    {
-        _ActionIgnore();
-    }
-    else if (s_IsCsiParamValue(wch) || s_IsCsiInvalid(wch) || s_IsCsiDelimiter(wch) || s_IsCsiPrivateMarker(wch))
-    {
-        _ActionIgnore();
-    }
-    else
-    {
-        _EnterGround();
-    }
+    _ExecuteTransition(wch, s_GetTransition(VTStates::CsiIgnore, wch));
 }
 
 // Routine Description:
@@ -1046,32 +1316,7 @@ void StateMachine::_EventCsiIgnore(const wchar_t wch)
 void StateMachine::_EventCsiParam(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"CsiParam");
-    if (s_IsC0Code(wch))
-    {
-        _ActionExecute(wch);
-    }
-    else if (s_IsDelete(wch))
-    {
-        _ActionIgnore();
-    }
-    else if (s_IsCsiParamValue(wch) || s_IsCsiDelimiter(wch))
-    {
-        _ActionParam(wch);
-    }
-    else if (s_IsIntermediate(wch))
-    {
-        _ActionCollect(wch);
-        _EnterCsiIntermediate();
-    }
-    else if (s_IsCsiInvalid(wch) || s_IsCsiPrivateMarker(wch))
-    {
-        _EnterCsiIgnore();
-    }
-    else
-    {
-        _ActionCsiDispatch(wch);
-        _EnterGround();
-    }
+    _ExecuteTransition(wch, s_GetTransition(VTStates::CsiParam, wch));
 }
 
 // Routine Description:
@@ -1087,22 +1332,7 @@ void StateMachine::_EventCsiParam(const wchar_t wch)
 void StateMachine::_EventOscParam(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"OscParam");
-    if (s_IsOscTerminator(wch))
-    {
-        _EnterGround();
-    }
-    else if (s_IsOscParamValue(wch))
-    {
-        _ActionOscParam(wch);
-    }
-    else if (s_IsOscDelimiter(wch))
-    {
-        _EnterOscString();
-    }
-    else
-    {
-        _ActionIgnore();
-    }
+    _ExecuteTransition(wch, s_GetTransition(VTStates::OscParam, wch));
 }
 
 // Routine Description:
@@ -1120,24 +1350,7 @@ void StateMachine::_EventOscParam(const wchar_t wch)
 void StateMachine::_EventOscString(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"OscString");
-    if (s_IsOscTerminator(wch))
-    {
-        _ActionOscDispatch(wch);
-        _EnterGround();
-    }
-    else if (s_IsOscTerminationInitiator(wch))
-    {
-        _EnterOscTermination();
-    }
-    else if (s_IsOscInvalid(wch))
-    {
-        _ActionIgnore();
-    }
-    else
-    {
-        // add this character to our OSC string
-        _ActionOscPut(wch);
-    }
+    _ExecuteTransition(wch, s_GetTransition(VTStates::OscString, wch));
 }
 
 // Routine Description:
@@ -1151,9 +1364,7 @@ void StateMachine::_EventOscString(const wchar_t wch)
 void StateMachine::_EventOscTermination(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"OscTermination");
-
-    _ActionOscDispatch(wch);
-    _EnterGround();
+    _ExecuteTransition(wch, s_GetTransition(VTStates::OscTermination, wch));
 }
 
 // Routine Description:
@@ -1174,30 +1385,7 @@ void StateMachine::_EventOscTermination(const wchar_t wch)
 void StateMachine::_EventSs3Entry(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"Ss3Entry");
-    if (s_IsC0Code(wch))
-    {
-        _ActionExecute(wch);
-    }
-    else if (s_IsDelete(wch))
-    {
-        _ActionIgnore();
-    }
-    else if (s_IsCsiInvalid(wch))
-    {
-        // It's safe for us to go into the CSI ignore here, because both SS3 and
-        //      CSI sequences ignore characters the same way.
-        _EnterCsiIgnore();
-    }
-    else if (s_IsCsiParamValue(wch) || s_IsCsiDelimiter(wch))
-    {
-        _ActionParam(wch);
-        _EnterSs3Param();
-    }
-    else
-    {
-        _ActionSs3Dispatch(wch);
-        _EnterGround();
-    }
+    _ExecuteTransition(wch, s_GetTransition(VTStates::Ss3Entry, wch));
 }
 
 // Routine Description:
@@ -1215,27 +1403,7 @@ void StateMachine::_EventSs3Entry(const wchar_t wch)
 void StateMachine::_EventSs3Param(const wchar_t wch)
 {
     _trace.TraceOnEvent(L"Ss3Param");
-    if (s_IsC0Code(wch))
-    {
-        _ActionExecute(wch);
-    }
-    else if (s_IsDelete(wch))
-    {
-        _ActionIgnore();
-    }
-    else if (s_IsCsiParamValue(wch) || s_IsCsiDelimiter(wch))
-    {
-        _ActionParam(wch);
-    }
-    else if (s_IsCsiInvalid(wch) || s_IsCsiPrivateMarker(wch))
-    {
-        _EnterCsiIgnore();
-    }
-    else
-    {
-        _ActionSs3Dispatch(wch);
-        _EnterGround();
-    }
+    _ExecuteTransition(wch, s_GetTransition(VTStates::Ss3Param, wch));
 }
 
 // Routine Description:
@@ -1249,17 +1417,13 @@ void StateMachine::ProcessCharacter(const wchar_t wch)
     _trace.TraceCharInput(wch);
 
     // Process "from anywhere" events first.
-    if (wch == AsciiChars::CAN ||
-        wch == AsciiChars::SUB)
+    //      CAN and SUB always execute and go to ground, and ESC goes to escape
+    //      (except from the OSC string state - ESC can be used to terminate
+    //      OSC strings). The transition table has the details.
+    const VTCharClass charClass = s_GetCharClass(wch);
+    if (charClass == VTCharClass::CanSub || charClass == VTCharClass::Escape)
     {
-        _ActionExecute(wch);
-        _EnterGround();
-    }
-    else if (s_IsEscape(wch) && _state != VTStates::OscString)
-    {
-        // Don't go to escape from the OSC string state - ESC can be used to
-        //      terminate OSC strings.
-        _EnterEscape();
+        _ExecuteTransition(wch, s_transitionTable[static_cast<size_t>(_state)][static_cast<size_t>(charClass)]);
     }
     else
     {
@@ -1334,101 +1498,414 @@ void StateMachine::ProcessString(const wchar_t* const rgwch, const size_t cch)
     _pwchSequenceStart = rgwch;
     _currRunLength = 0;
 
-    // This should be static, because if one string starts a sequence, and the next finishes it,
-    //   we want the partial sequence state to persist.
-    static bool s_fProcessIndividually = false;
+    const wchar_t* const pwchEnd = rgwch + cch;
 
-    for(size_t cchCharsRemaining = cch; cchCharsRemaining > 0; cchCharsRemaining--)
+    while (_pwchCurr < pwchEnd)
     {
-        if (s_fProcessIndividually)
+        if (_fProcessingIndividually)
         {
             // If we're processing characters individually, send it to the state machine.
             ProcessCharacter(*_pwchCurr);
             _pwchCurr++;
             if (_state == VTStates::Ground)  // Then check if we're back at ground. If we are, the next character (pwchCurr)
             {                                //   is the start of the next run of characters that might be printable.
-                s_fProcessIndividually = false;
+                _fProcessingIndividually = false;
                 _pwchSequenceStart = _pwchCurr;
                 _currRunLength = 0;
             }
         }
         else
         {
-            if (s_IsActionableFromGround(*_pwchCurr))  // If the current char is the start of an escape sequence, or should be executed in ground state...
+            // Add every printable char up to the next actionable one to the current run in one go.
+            const wchar_t* const pwchActionable = s_FindActionableFromGround(_pwchCurr, pwchEnd);
+            _currRunLength += pwchActionable - _pwchCurr;
+            _pwchCurr = pwchActionable;
+
+            if (_pwchCurr < pwchEnd)  // If the current char is the start of an escape sequence, or should be executed in ground state...
             {
                 FAIL_FAST_IF(!(_pwchSequenceStart + _currRunLength <= rgwch + cch));
                 _pEngine->ActionPrintString(_pwchSequenceStart, _currRunLength); // ... print all the chars leading up to it as part of the run...
                 _trace.DispatchPrintRunTrace(_pwchSequenceStart, _currRunLength);
-                s_fProcessIndividually = true; // begin processing future characters individually...
+                _fProcessingIndividually = true; // begin processing future characters individually...
                 _currRunLength = 0;
                 _pwchSequenceStart = _pwchCurr;
                 ProcessCharacter(*_pwchCurr); // ... Then process the character individually.
                 if (_state == VTStates::Ground)  // If the character took us right back to ground, start another run after it.
                 {
-                    s_fProcessIndividually = false;
+                    _fProcessingIndividually = false;
                     _pwchSequenceStart = _pwchCurr + 1;
                     _currRunLength = 0;
                 }
+                _pwchCurr++;
             }
-            else
-            {
-                _currRunLength++; // Otherwise, add this char to the current run to be printed.
-            }
-            _pwchCurr++;
         }
     }
 
     // If we're at the end of the string and have remaining un-printed characters,
-    if (!s_fProcessIndividually && _currRunLength > 0)
+    if (!_fProcessingIndividually && _currRunLength > 0)
     {
         // print the rest of the characters in the string
         _pEngine->ActionPrintString(_pwchSequenceStart, _currRunLength);
         _trace.DispatchPrintRunTrace(_pwchSequenceStart, _currRunLength);
 
     }
-    else if (s_fProcessIndividually)
+    else if (_fProcessingIndividually)
     {
         if (_pEngine->FlushAtEndOfString())
         {
-            // Reset our state, and put all but the last char in again.
-            ResetState();
-            // Chars to flush are [pwchSequenceStart, pwchCurr)
-            const wchar_t* pwch = _pwchSequenceStart;
-            for (; pwch < _pwchCurr-1; pwch++)
+            _FlushSequenceAtEndOfString();
+        }
+    }
+}
+
+void StateMachine::ProcessString(const std::wstring& wstr)
+{
+    return ProcessString(wstr.c_str(), wstr.length());
+}
+
+// Routine Description:
+// - For engines that want it, dispatches the partial sequence we were in the
+//      middle of when we reached the end of the string, rather than waiting
+//      for the rest of it to arrive in the next string.
+//   The chars of the partial sequence are [_pwchSequenceStart, _pwchCurr).
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void StateMachine::_FlushSequenceAtEndOfString()
+{
+    // Reset our state, and put all but the last char in again.
+    ResetState();
+    const wchar_t* pwch = _pwchSequenceStart;
+    for (; pwch < _pwchCurr-1; pwch++)
+    {
+        ProcessCharacter(*pwch);
+    }
+    // Manually execute the last char [pwchCurr]
+    switch (_state)
+    {
+    case VTStates::Ground:
+        return _ActionExecute(*pwch);
+    case VTStates::Escape:
+    case VTStates::EscapeIntermediate:
+        return _ActionEscDispatch(*pwch);
+    case VTStates::CsiEntry:
+    case VTStates::CsiIntermediate:
+    case VTStates::CsiIgnore:
+    case VTStates::CsiParam:
+        return _ActionCsiDispatch(*pwch);
+    case VTStates::OscParam:
+    case VTStates::OscString:
+    case VTStates::OscTermination:
+        return _ActionOscDispatch(*pwch);
+    case VTStates::Ss3Entry:
+    case VTStates::Ss3Param:
+        return _ActionSs3Dispatch(*pwch);
+    default:
+        return;
+    }
+}
+
+// Routine Description:
+// - Determines how many bytes the UTF-8 sequence beginning with the given
+//      lead byte should be. Bytes that can't begin a sequence are treated as
+//      a sequence of their own, which will decode to U+FFFD.
+// Arguments:
+// - ch - The lead byte.
+// Return Value:
+// - The expected length of the sequence, 1 to 4.
+size_t StateMachine::s_Utf8SequenceLength(const char ch) noexcept
+{
+    const unsigned char uch = static_cast<unsigned char>(ch);
+    if (uch >= 0xC2 && uch <= 0xDF)
+    {
+        return 2;
+    }
+    else if (uch >= 0xE0 && uch <= 0xEF)
+    {
+        return 3;
+    }
+    else if (uch >= 0xF0 && uch <= 0xF4)
+    {
+        return 4;
+    }
+    return 1;
+}
+
+// Routine Description:
+// - Determines if a byte is a UTF-8 continuation byte (10xxxxxx).
+// Arguments:
+// - ch - The byte to check.
+// Return Value:
+// - True if it is. False if it isn't.
+bool StateMachine::s_IsUtf8Continuation(const char ch) noexcept
+{
+    return (static_cast<unsigned char>(ch) & 0xC0) == 0x80;
+}
+
+// Routine Description:
+// - Measures the code point that starts at the given byte. An invalid one
+//      stops early at the first byte that can't continue it, so that byte
+//      starts the next code point.
+// Arguments:
+// - pch - The lead byte.
+// - pchEnd - One past the last byte available.
+// Return Value:
+// - The number of bytes in the code point, which is less than its lead byte
+//      asks for if it's cut short.
+size_t StateMachine::s_Utf8CodePointLength(const char* const pch, const char* const pchEnd) noexcept
+{
+    const size_t cbExpected = s_Utf8SequenceLength(*pch);
+    size_t cb = 1;
+    while (cb < cbExpected && pch + cb < pchEnd && s_IsUtf8Continuation(pch[cb]))
+    {
+        cb++;
+    }
+    return cb;
+}
+
+// Routine Description:
+// - Finds the next byte that starts a character that is actionable from the
+//      ground state. In UTF-8 those are the single byte C0 controls and DEL,
+//      and the two byte encoding of the C1 CSI (0xC2 0x9B). All of them are
+//      complete code points, so everything before the returned byte is a run
+//      of whole printable code points (except possibly at pchEnd).
+// Arguments:
+// - pch - The first byte to scan.
+// - pchEnd - One past the last byte to scan.
+// Return Value:
+// - A pointer to the first actionable byte, or pchEnd if there isn't one.
+const char* StateMachine::s_FindActionableFromGroundUtf8(const char* pch, const char* const pchEnd) noexcept
+{
+    for (; pch < pchEnd; pch++)
+    {
+        const unsigned char uch = static_cast<unsigned char>(*pch);
+        if (uch <= AsciiChars::US || uch == AsciiChars::DEL)
+        {
+            break;
+        }
+        else if (uch == 0xC2 && pch + 1 < pchEnd && static_cast<unsigned char>(pch[1]) == 0x9B)
+        {
+            break;
+        }
+    }
+    return pch;
+}
+
+// Routine Description:
+// - Finds an incomplete code point at the end of the given bytes, which we'll
+//      need to hold on to until the rest of it arrives.
+// Arguments:
+// - pchBegin - The first byte of the input.
+// - pchEnd - One past the last byte of the input.
+// Return Value:
+// - A pointer to the lead byte of the incomplete code point, or pchEnd if
+//      the input ends with a complete one.
+const char* StateMachine::s_FindUtf8PartialCodePoint(const char* const pchBegin, const char* const pchEnd) noexcept
+{
+    // A sequence is at most 4 bytes, so only the last 3 can start an incomplete one.
+    const char* pch = pchEnd;
+    while (pch > pchBegin && pchEnd - pch < 3)
+    {
+        pch--;
+        if (!s_IsUtf8Continuation(*pch))
+        {
+            return (pch + s_Utf8SequenceLength(*pch) > pchEnd) ? pch : pchEnd;
+        }
+    }
+    return pchEnd;
+}
+
+// Routine Description:
+// - Decodes a run of printable UTF-8 and hands it to the engine to print.
+//      Invalid sequences are replaced with U+FFFD, or left out.
+// Arguments:
+// - pchBegin - The first byte of the run.
+// - pchEnd - One past the last byte of the run.
+// - fDropInvalid - If true, invalid sequences are left out.
+// Return Value:
+// - <none>
+void StateMachine::_ActionPrintUtf8(const char* const pchBegin, const char* const pchEnd, const bool fDropInvalid)
+{
+    const int cb = gsl::narrow<int>(pchEnd - pchBegin);
+    if (cb == 0)
+    {
+        return;
+    }
+
+    // A UTF-8 sequence never decodes to more UTF-16 units than it has bytes.
+    if (_utf8Decoded.size() < static_cast<size_t>(cb))
+    {
+        _utf8Decoded.resize(cb);
+    }
+
+    int cch = MultiByteToWideChar(CP_UTF8, fDropInvalid ? MB_ERR_INVALID_CHARS : 0, pchBegin, cb, _utf8Decoded.data(), cb);
+    if (cch == 0 && fDropInvalid && GetLastError() == ERROR_NO_UNICODE_TRANSLATION)
+    {
+        // Somewhere in the run is something that isn't UTF-8. Go through it a
+        //      code point at a time, and leave out the ones that don't decode.
+        for (const char* pch = pchBegin; pch < pchEnd;)
+        {
+            const size_t cbCodePoint = s_Utf8CodePointLength(pch, pchEnd);
+            cch += MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, pch, gsl::narrow_cast<int>(cbCodePoint), _utf8Decoded.data() + cch, cb - cch);
+            pch += cbCodePoint;
+        }
+
+        if (cch == 0)
+        {
+            return;
+        }
+    }
+    THROW_LAST_ERROR_IF(cch == 0);
+
+    _pEngine->ActionPrintString(_utf8Decoded.data(), cch);
+    _trace.DispatchPrintRunTrace(_utf8Decoded.data(), cch);
+}
+
+// Routine Description:
+// - Processes as much of the given UTF-8 as we can. Printable runs are decoded
+//      and printed in one go. Characters that are part of a sequence are
+//      decoded one at a time and fed to the state machine, and are collected
+//      in _utf8Sequence so that FlushToTerminal can pass the sequence through.
+// Arguments:
+// - pch - The first byte to process.
+// - pchEnd - One past the last byte to process.
+// - fDecodePartial - If true, an incomplete code point at the end of the
+//      input is decoded (to U+FFFD) instead of being left for the next call.
+// - fDropInvalid - If true, invalid sequences are left out instead of
+//      becoming U+FFFD.
+// Return Value:
+// - A pointer to the first byte that wasn't processed, which is the start of
+//      an incomplete code point, or pchEnd.
+const char* StateMachine::_ProcessUtf8Range(const char* pch, const char* const pchEnd, const bool fDecodePartial, const bool fDropInvalid)
+{
+    while (pch < pchEnd)
+    {
+        if (!_fProcessingIndividually)
+        {
+            const char* const pchActionable = s_FindActionableFromGroundUtf8(pch, pchEnd);
+            const char* const pchRunEnd = (pchActionable == pchEnd && !fDecodePartial) ?
+                                          s_FindUtf8PartialCodePoint(pch, pchEnd) :
+                                          pchActionable;
+            _ActionPrintUtf8(pch, pchRunEnd, fDropInvalid);
+            pch = pchRunEnd;
+
+            if (pchActionable == pchEnd)
             {
-                ProcessCharacter(*pwch);
+                break;
             }
-            // Manually execute the last char [pwchCurr]
-            switch (_state)
+
+            _fProcessingIndividually = true;
+            _utf8Sequence.clear();
+        }
+
+        // Decode the next code point, stopping early at any byte that can't continue it.
+        const size_t cb = s_Utf8CodePointLength(pch, pchEnd);
+        if (cb < s_Utf8SequenceLength(*pch) && pch + cb == pchEnd && !fDecodePartial)
+        {
+            break;
+        }
+
+        wchar_t rgwch[2];
+        int cch = MultiByteToWideChar(CP_UTF8, fDropInvalid ? MB_ERR_INVALID_CHARS : 0, pch, gsl::narrow_cast<int>(cb), rgwch, ARRAYSIZE(rgwch));
+        pch += cb;
+        if (cch == 0)
+        {
+            if (fDropInvalid)
             {
-            case VTStates::Ground:
-                return _ActionExecute(*pwch);
-            case VTStates::Escape:
-            case VTStates::EscapeIntermediate:
-                return _ActionEscDispatch(*pwch);
-            case VTStates::CsiEntry:
-            case VTStates::CsiIntermediate:
-            case VTStates::CsiIgnore:
-            case VTStates::CsiParam:
-                return _ActionCsiDispatch(*pwch);
-            case VTStates::OscParam:
-            case VTStates::OscString:
-            case VTStates::OscTermination:
-                return _ActionOscDispatch(*pwch);
-            case VTStates::Ss3Entry:
-            case VTStates::Ss3Param:
-                return _ActionSs3Dispatch(*pwch);
-            default:
-                return;
+                continue;
             }
+            rgwch[0] = UNICODE_REPLACEMENT;
+            cch = 1;
+        }
+
+        for (int i = 0; i < cch; i++)
+        {
+            _utf8Sequence.push_back(rgwch[i]);
+            _pwchSequenceStart = _utf8Sequence.data();
+            _pwchCurr = _pwchSequenceStart + _utf8Sequence.size() - 1;
 
+            ProcessCharacter(rgwch[i]);
+            if (_state == VTStates::Ground)
+            {
+                _fProcessingIndividually = false;
+                _utf8Sequence.clear();
+            }
+            else
+            {
+                _fProcessingIndividually = true;
+            }
         }
     }
+
+    return pch;
 }
 
-void StateMachine::ProcessString(const std::wstring& wstr)
+// Routine Description:
+// - Entry to the state machine for UTF-8 encoded input, like the output of a
+//      conpty pipe. This is the UTF-8 equivalent of ProcessString, without
+//      first converting the whole input to UTF-16: control characters are
+//      found directly in the UTF-8, and only the printable runs between them
+//      are decoded before they're handed to the engine.
+//   A code point split across calls is held on to until the rest of it
+//      arrives, as is a sequence.
+// Arguments:
+// - utf8 - The UTF-8 encoded input.
+// - fDropInvalid - If true, invalid sequences are left out, rather than
+//      replaced with U+FFFD. Input from a terminal wants this, so that line
+//      noise doesn't turn into keypresses.
+// Return Value:
+// - <none>
+void StateMachine::ProcessUtf8(const std::string_view utf8, const bool fDropInvalid)
 {
-    return ProcessString(wstr.c_str(), wstr.length());
+    const char* pch = utf8.data();
+    const char* const pchEnd = pch + utf8.size();
+
+    // Finish the code point the last call ended in the middle of, if any.
+    if (!_utf8Partial.empty())
+    {
+        const size_t cbExpected = s_Utf8SequenceLength(_utf8Partial.front());
+        while (_utf8Partial.size() < cbExpected && pch < pchEnd && s_IsUtf8Continuation(*pch))
+        {
+            _utf8Partial.push_back(*pch);
+            pch++;
+        }
+
+        if (_utf8Partial.size() < cbExpected && pch == pchEnd)
+        {
+            // Still not enough. Wait for more, but don't hold up a sequence on it.
+            _FlushUtf8SequenceAtEndOfString();
+            return;
+        }
+
+        const std::string partial{ std::move(_utf8Partial) };
+        _utf8Partial.clear();
+        _ProcessUtf8Range(partial.data(), partial.data() + partial.size(), true, fDropInvalid);
+    }
+
+    const char* const pchRemaining = _ProcessUtf8Range(pch, pchEnd, false, fDropInvalid);
+    _utf8Partial.assign(pchRemaining, pchEnd);
+
+    _FlushUtf8SequenceAtEndOfString();
+}
+
+// Routine Description:
+// - The ProcessUtf8 equivalent of the end of ProcessString. For engines that
+//      want it, dispatches the partial sequence in _utf8Sequence, even if
+//      the input ended in the middle of a code point.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void StateMachine::_FlushUtf8SequenceAtEndOfString()
+{
+    if (_fProcessingIndividually && !_utf8Sequence.empty() && _pEngine->FlushAtEndOfString())
+    {
+        _pwchSequenceStart = _utf8Sequence.data();
+        _pwchCurr = _pwchSequenceStart + _utf8Sequence.size();
+        _FlushSequenceAtEndOfString();
+        _utf8Sequence.clear();
+    }
 }
 
 // Routine Description:
@@ -17,6 +17,7 @@ Abstract:
 #include "IStateMachineEngine.hpp"
 #include "telemetry.hpp"
 #include "tracing.hpp"
+#include <array>
 #include <memory>
 
 namespace Microsoft::Console::VirtualTerminal
@@ -26,6 +27,7 @@ namespace Microsoft::Console::VirtualTerminal
 #ifdef UNIT_TESTING
         friend class OutputEngineTest;
         friend class InputEngineTest;
+        friend class StateMachinePerfTests;
 #endif
 
     public:
@@ -34,6 +36,7 @@ namespace Microsoft::Console::VirtualTerminal
         void ProcessCharacter(const wchar_t wch);
         void ProcessString(const wchar_t* const rgwch, const size_t cch);
         void ProcessString(const std::wstring& wstr);
+        void ProcessUtf8(const std::string_view utf8, const bool fDropInvalid = false);
 
         void ResetState();
 
@@ -47,27 +50,34 @@ namespace Microsoft::Console::VirtualTerminal
         static const short s_cOscStringMaxLength = 256;
 
     private:
-        static bool s_IsActionableFromGround(const wchar_t wch);
-        static bool s_IsC0Code(const wchar_t wch);
-        static bool s_IsC1Csi(const wchar_t wch);
-        static bool s_IsIntermediate(const wchar_t wch);
-        static bool s_IsDelete(const wchar_t wch);
-        static bool s_IsEscape(const wchar_t wch);
-        static bool s_IsCsiIndicator(const wchar_t wch);
-        static bool s_IsCsiDelimiter(const wchar_t wch);
-        static bool s_IsCsiParamValue(const wchar_t wch);
-        static bool s_IsCsiPrivateMarker(const wchar_t wch);
-        static bool s_IsCsiInvalid(const wchar_t wch);
-        static bool s_IsOscIndicator(const wchar_t wch);
-        static bool s_IsOscDelimiter(const wchar_t wch);
-        static bool s_IsOscParamValue(const wchar_t wch);
-        static bool s_IsOscInvalid(const wchar_t wch);
-        static bool s_IsOscTerminator(const wchar_t wch);
-        static bool s_IsOscTerminationInitiator(const wchar_t wch);
+        static constexpr bool s_IsActionableFromGround(const wchar_t wch) noexcept;
+        static const wchar_t* s_FindActionableFromGround(const wchar_t* pwch, const wchar_t* const pwchEnd) noexcept;
+        static constexpr bool s_IsC0Code(const wchar_t wch) noexcept;
+        static constexpr bool s_IsC1Csi(const wchar_t wch) noexcept;
+        static constexpr bool s_IsIntermediate(const wchar_t wch) noexcept;
+        static constexpr bool s_IsDelete(const wchar_t wch) noexcept;
+        static constexpr bool s_IsEscape(const wchar_t wch) noexcept;
+        static constexpr bool s_IsCsiIndicator(const wchar_t wch) noexcept;
+        static constexpr bool s_IsCsiDelimiter(const wchar_t wch) noexcept;
+        static constexpr bool s_IsCsiParamValue(const wchar_t wch) noexcept;
+        static constexpr bool s_IsCsiPrivateMarker(const wchar_t wch) noexcept;
+        static constexpr bool s_IsCsiInvalid(const wchar_t wch) noexcept;
+        static constexpr bool s_IsOscIndicator(const wchar_t wch) noexcept;
+        static constexpr bool s_IsOscDelimiter(const wchar_t wch) noexcept;
+        static constexpr bool s_IsOscParamValue(const wchar_t wch) noexcept;
+        static constexpr bool s_IsOscInvalid(const wchar_t wch) noexcept;
+        static constexpr bool s_IsOscTerminator(const wchar_t wch) noexcept;
+        static constexpr bool s_IsOscTerminationInitiator(const wchar_t wch) noexcept;
         static bool s_IsDesignateCharsetIndicator(const wchar_t wch);
         static bool s_IsCharsetCode(const wchar_t wch);
-        static bool s_IsNumber(const wchar_t wch);
-        static bool s_IsSs3Indicator(const wchar_t wch);
+        static constexpr bool s_IsNumber(const wchar_t wch) noexcept;
+        static constexpr bool s_IsSs3Indicator(const wchar_t wch) noexcept;
+
+        static size_t s_Utf8SequenceLength(const char ch) noexcept;
+        static bool s_IsUtf8Continuation(const char ch) noexcept;
+        static size_t s_Utf8CodePointLength(const char* const pch, const char* const pchEnd) noexcept;
+        static const char* s_FindActionableFromGroundUtf8(const char* pch, const char* const pchEnd) noexcept;
+        static const char* s_FindUtf8PartialCodePoint(const char* const pchBegin, const char* const pchEnd) noexcept;
 
         void _ActionExecute(const wchar_t wch);
         void _ActionExecuteFromEscape(const wchar_t wch);
@@ -110,6 +120,12 @@ namespace Microsoft::Console::VirtualTerminal
         void _EventSs3Entry(const wchar_t wch);
         void _EventSs3Param(const wchar_t wch);
 
+        void _FlushSequenceAtEndOfString();
+        void _FlushUtf8SequenceAtEndOfString();
+
+        void _ActionPrintUtf8(const char* const pchBegin, const char* const pchEnd, const bool fDropInvalid);
+        const char* _ProcessUtf8Range(const char* pch, const char* const pchEnd, const bool fDecodePartial, const bool fDropInvalid);
+
         enum class VTStates
         {
             Ground,
@@ -126,6 +142,77 @@ namespace Microsoft::Console::VirtualTerminal
             Ss3Param
         };
 
+        // The classes of characters that the transitions out of each state depend on.
+        //      Every character from s_wchFirstOther up is Other.
+        enum class VTCharClass : BYTE
+        {
+            C0, // C0 controls that aren't listed separately
+            Bell,
+            CanSub,
+            Escape,
+            Intermediate,
+            Digit,
+            Colon,
+            Semicolon,
+            PrivateMarker,
+            CsiIndicator,
+            OscIndicator,
+            Ss3Indicator,
+            Delete,
+            C1Csi,
+            C1St,
+            Other
+        };
+
+        enum class VTActions : BYTE
+        {
+            None,
+            Ignore,
+            Execute,
+            ExecuteFromEscape, // Execute, or ExecuteFromEscape and go to ground, as the engine prefers.
+            Print,
+            Collect,
+            Param,
+            EscDispatch,
+            CsiDispatch,
+            OscParam,
+            OscPut,
+            OscDispatch,
+            Ss3Dispatch
+        };
+
+        // The action to take for a character, and the state to enter after.
+        //      If fEnterState is false we stay in the current state, without
+        //      running its entry action.
+        struct VTTransition
+        {
+            VTActions action;
+            bool fEnterState;
+            VTStates nextState;
+        };
+
+        static constexpr size_t s_cStates = static_cast<size_t>(VTStates::Ss3Param) + 1;
+        static constexpr size_t s_cCharClasses = static_cast<size_t>(VTCharClass::Other) + 1;
+        static constexpr wchar_t s_wchFirstOther = L'\xa0';
+
+        using VTCharClassTable = std::array<VTCharClass, s_wchFirstOther>;
+        using VTTransitionTable = std::array<std::array<VTTransition, s_cCharClasses>, s_cStates>;
+
+        static constexpr VTCharClass s_ClassifyChar(const wchar_t wch) noexcept;
+        static constexpr VTTransition s_BuildTransition(const VTStates state, const VTCharClass charClass) noexcept;
+        static constexpr VTCharClassTable s_BuildCharClassTable() noexcept;
+        static constexpr VTTransitionTable s_BuildTransitionTable() noexcept;
+        static constexpr bool s_CharClassTableMatchesPredicates() noexcept;
+
+        static const VTCharClassTable s_charClassTable;
+        static const VTTransitionTable s_transitionTable;
+
+        static VTCharClass s_GetCharClass(const wchar_t wch) noexcept;
+        static const VTTransition& s_GetTransition(const VTStates state, const wchar_t wch) noexcept;
+
+        void _ExecuteTransition(const wchar_t wch, const VTTransition& transition);
+        void _EnterState(const VTStates state);
+
         Microsoft::Console::VirtualTerminal::ParserTracing _trace;
 
         std::unique_ptr<IStateMachineEngine> _pEngine;
@@ -151,5 +238,268 @@ namespace Microsoft::Console::VirtualTerminal
         const wchar_t* _pwchSequenceStart;
         size_t _currRunLength;
 
+        // This is true while we're in the middle of a sequence, and persists
+        // between calls to ProcessString, because if one string starts a
+        // sequence, and the next finishes it, we want the partial sequence
+        // state to persist. It lives in the instance, not in a static, so
+        // that separate state machines can run on separate threads.
+        bool _fProcessingIndividually;
+
+        // State for ProcessUtf8.
+        // - _utf8Partial holds the bytes of a code point that was split between calls.
+        // - _utf8Sequence holds the decoded chars of the sequence we're in the
+        //   middle of, since there's no UTF-16 string for _pwchSequenceStart to point into.
+        // - _utf8Decoded is scratch space for decoding printable runs, kept to avoid reallocating.
+        std::string _utf8Partial;
+        std::wstring _utf8Sequence;
+        std::vector<wchar_t> _utf8Decoded;
+
     };
+
+    // Routine Description:
+    // - Determines if a character indicates an action that should be taken in the ground state -
+    //     These are C0 characters and the C1 [single-character] CSI.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsActionableFromGround(const wchar_t wch) noexcept
+    {
+        return wch <= L'\x1f' || s_IsC1Csi(wch) || s_IsDelete(wch);
+    }
+
+    // Routine Description:
+    // - Determines if a character belongs to the C0 escape range.
+    //   This is character sequences less than a space character (null, backspace, new line, etc.)
+    //   See also https://en.wikipedia.org/wiki/C0_and_C1_control_codes
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsC0Code(const wchar_t wch) noexcept
+    {
+        return wch <= L'\x17' || // NUL - ETB
+               wch == L'\x19' || // EM
+               (wch >= L'\x1c' && wch <= L'\x1f'); // FS - US
+    }
+
+    // Routine Description:
+    // - Determines if a character is a C1 CSI (Control Sequence Introducer)
+    //   This is a single-character way to start a control sequence, as opposed to "ESC[".
+    //
+    //   Not all single-byte codepages support C1 control codes--in some, the range that would
+    //   be used for C1 codes are instead used for additional graphic characters.
+    //
+    //   However, we do not need to worry about confusion whether a single byte \x9b in a
+    //   single-byte stream represents a C1 CSI or some other glyph, because by the time we
+    //   get here, everything is Unicode. Knowing whether a single-byte \x9b represents a
+    //   single-character C1 CSI or some other glyph is handled by MultiByteToWideChar before
+    //   we get here (if the stream was not already UTF-16). For instance, in CP_ACP, if a
+    //   \x9b shows up, it will get converted to \x203a. So, if we get here, and have a
+    //   \x009b, we know that it unambiguously represents a C1 CSI.
+    //
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsC1Csi(const wchar_t wch) noexcept
+    {
+        return wch == L'\x9b';
+    }
+
+    // Routine Description:
+    // - Determines if a character is a valid intermediate in an VT escape sequence.
+    //   Intermediates are punctuation type characters that are generally vendor specific and
+    //   modify the operational mode of a command.
+    //   See also http://vt100.net/emu/dec_ansi_parser
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsIntermediate(const wchar_t wch) noexcept
+    {
+        return wch >= L' ' && wch <= L'/'; // 0x20 - 0x2F
+    }
+
+    // Routine Description:
+    // - Determines if a character is the delete character.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsDelete(const wchar_t wch) noexcept
+    {
+        return wch == L'\x7f';
+    }
+
+    // Routine Description:
+    // - Determines if a character is the escape character.
+    //   Used to start escape sequences.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsEscape(const wchar_t wch) noexcept
+    {
+        return wch == L'\x1b';
+    }
+
+    // Routine Description:
+    // - Determines if a character is "control sequence" beginning indicator.
+    //   This immediately follows an escape and signifies a varying length control sequence.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsCsiIndicator(const wchar_t wch) noexcept
+    {
+        return wch == L'['; // 0x5B
+    }
+
+    // Routine Description:
+    // - Determines if a character is a delimiter between two parameters in a "control sequence"
+    //   This occurs in the middle of a control sequence after escape and CsiIndicator have been recognized
+    //   between a series of parameters.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsCsiDelimiter(const wchar_t wch) noexcept
+    {
+        return wch == L';'; // 0x3B
+    }
+
+    // Routine Description:
+    // - Determines if a character is a valid parameter value
+    //   Parameters must be numerical digits.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsCsiParamValue(const wchar_t wch) noexcept
+    {
+        return wch >= L'0' && wch <= L'9'; // 0x30 - 0x39
+    }
+
+    // Routine Description:
+    // - Determines if a character is a private range marker for a control sequence.
+    //   Private range markers indicate vendor-specific behavior.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsCsiPrivateMarker(const wchar_t wch) noexcept
+    {
+        return wch == L'<' || wch == L'=' || wch == L'>' || wch == L'?'; // 0x3C - 0x3F
+    }
+
+    // Routine Description:
+    // - Determines if a character is invalid in a control sequence
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsCsiInvalid(const wchar_t wch) noexcept
+    {
+        return wch == L':'; // 0x3A
+    }
+
+    // Routine Description:
+    // - Determines if a character is a "Single Shift Select" indicator.
+    //   This immediately follows an escape and signifies a varying length control string.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsOscIndicator(const wchar_t wch) noexcept
+    {
+        return wch == L']'; // 0x5D
+    }
+
+    // Routine Description:
+    // - Determines if a character is a delimiter between two parameters in a "operating system control sequence"
+    //   This occurs in the middle of a control sequence after escape and OscIndicator have been recognized,
+    //   after the paramater indicating which OSC action to take.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsOscDelimiter(const wchar_t wch) noexcept
+    {
+        return wch == L';'; // 0x3B
+    }
+
+    // Routine Description:
+    // - Determines if a character is a valid parameter value for an OSC String,
+    //     that is, the indicator of which OSC action to take.
+    //   Parameters must be numerical digits.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsOscParamValue(const wchar_t wch) noexcept
+    {
+        return s_IsNumber(wch); // 0x30 - 0x39
+    }
+
+    // Routine Description:
+    // - Determines if a character should be ignored in a operating system control sequence
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsOscInvalid(const wchar_t wch) noexcept
+    {
+        return wch <= L'\x17' ||
+               wch == L'\x19' ||
+               (wch >= L'\x1c' && wch <= L'\x1f') ;
+    }
+
+    // Routine Description:
+    // - Determines if a character is "operating system control string" termination indicator.
+    //   This signals the end of an OSC string collection.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsOscTerminator(const wchar_t wch) noexcept
+    {
+        return wch == L'\x7' || wch == L'\x9C'; // Bell character or C1 terminator
+    }
+
+    // Routine Description:
+    // - Determines if a character should be initiate the end of an OSC sequence.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsOscTerminationInitiator(const wchar_t wch) noexcept
+    {
+        return wch == L'\x1b';
+    }
+
+    // Routine Description:
+    // - Determines if a character is a valid number character, 0-9.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsNumber(const wchar_t wch) noexcept
+    {
+        return wch >= L'0' && wch <= L'9'; // 0x30 - 0x39
+    }
+
+    // Routine Description:
+    // - Determines if a character is "operating system control string" beginning
+    //      indicator.
+    //   This immediately follows an escape and signifies a  signifies a varying
+    //      length control sequence, quite similar to CSI.
+    // Arguments:
+    // - wch - Character to check.
+    // Return Value:
+    // - True if it is. False if it isn't.
+    constexpr bool StateMachine::s_IsSs3Indicator(const wchar_t wch) noexcept
+    {
+        return wch == L'O'; // 0x4F
+    }
 }
@@ -103,6 +103,8 @@ namespace Microsoft::Console::VirtualTerminal
 
         void WriteFinalTraceLog() const;
 
+        // These are updated with Interlocked* since every state machine in
+        // the process shares this instance.
         unsigned int _uiTimesUsedCurrent;
         unsigned int _uiTimesFailedCurrent;
         unsigned int _uiTimesFailedOutsideRangeCurrent;
@@ -239,6 +239,7 @@ class Microsoft::Console::VirtualTerminal::InputEngineTest
     TEST_METHOD(CSICursorBackTabTest);
     TEST_METHOD(AltBackspaceTest);
     TEST_METHOD(AltCtrlDTest);
+    TEST_METHOD(Utf8EscapeBeforePartialCodePointTest);
 
     friend class TestInteractDispatch;
 };
@@ -788,3 +789,42 @@ void InputEngineTest::AltCtrlDTest()
     Log::Comment(NoThrowString().Format(L"Processing \"\\x1b\\x04\""));
     _stateMachine->ProcessString(seq);
 }
+
+void InputEngineTest::Utf8EscapeBeforePartialCodePointTest()
+{
+    TestState testState;
+    auto pfn = std::bind(&TestState::TestInputStringCallback, &testState, std::placeholders::_1);
+
+    auto inputEngine = std::make_unique<InputStateMachineEngine>(new TestInteractDispatch(pfn, &testState));
+    auto _stateMachine = std::make_unique<StateMachine>(inputEngine.release());
+    VERIFY_IS_NOT_NULL(_stateMachine);
+    testState._stateMachine = _stateMachine.get();
+
+    INPUT_RECORD proto = {0};
+    proto.EventType = KEY_EVENT;
+    proto.Event.KeyEvent.dwControlKeyState = 0;
+    proto.Event.KeyEvent.wRepeatCount = 1;
+    proto.Event.KeyEvent.bKeyDown = TRUE;
+
+    Log::Comment(NoThrowString().Format(
+        L"An ESC followed by the start of a multibyte code point is still flushed as an Escape keypress."
+    ));
+    INPUT_RECORD test = proto;
+    test.Event.KeyEvent.uChar.UnicodeChar = L'\x1b';
+    testState.vExpectedInput.push_back(test);
+    _stateMachine->ProcessUtf8("\x1b\xe2", true);
+    VERIFY_ARE_EQUAL(0u, testState.vExpectedInput.size());
+
+    Log::Comment(NoThrowString().Format(
+        L"More of the code point that still doesn't finish it doesn't dispatch anything. "
+        L"When something else cuts it short, it's dropped, and input carries on."
+    ));
+    _stateMachine->ProcessUtf8("\x82", true);
+    test = proto;
+    test.Event.KeyEvent.uChar.UnicodeChar = L'a';
+    testState.vExpectedInput.push_back(test);
+    test.Event.KeyEvent.bKeyDown = FALSE;
+    testState.vExpectedInput.push_back(test);
+    _stateMachine->ProcessUtf8("a", true);
+    VERIFY_ARE_EQUAL(0u, testState.vExpectedInput.size());
+}
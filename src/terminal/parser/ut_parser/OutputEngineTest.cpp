@@ -10,6 +10,8 @@
 
 #include "ascii.hpp"
 
+#include <random>
+
 using namespace Microsoft::Console::VirtualTerminal;
 
 using namespace WEX::Common;
@@ -203,6 +205,30 @@ class Microsoft::Console::VirtualTerminal::OutputEngineTest final
         VERIFY_ARE_EQUAL(mach._state, StateMachine::VTStates::Ground);
     }
 
+    TEST_METHOD(TestFindActionableFromGround)
+    {
+        // Check every character that can matter to the vectorized scanner at
+        //      every offset of a buffer long enough to cover the AVX2, SSE2 and
+        //      scalar tail paths.
+        const std::vector<wchar_t> rgwchInteresting = { L'\x0', L'\x1b', L'\x1f', L' ', L'a', L'\x7e', L'\x7f', L'\x80', L'\x9b', L'\x9c', L'\x4e00', L'\xff1b', L'\xffff' };
+        const size_t cchBuffer = 41;
+
+        for (const auto wch : rgwchInteresting)
+        {
+            for (size_t i = 0; i < cchBuffer; i++)
+            {
+                std::wstring wstr(cchBuffer, L'A');
+                wstr[i] = wch;
+
+                const wchar_t* const pwchBegin = wstr.data();
+                const wchar_t* const pwchEnd = pwchBegin + wstr.size();
+                const size_t expected = StateMachine::s_IsActionableFromGround(wch) ? i : cchBuffer;
+
+                VERIFY_ARE_EQUAL(expected, static_cast<size_t>(StateMachine::s_FindActionableFromGround(pwchBegin, pwchEnd) - pwchBegin));
+            }
+        }
+    }
+
     TEST_METHOD(TestCsiEntry)
     {
         StateMachine mach(new OutputStateMachineEngine(new DummyDispatch));
@@ -1648,3 +1674,286 @@ class StateMachineExternalTest final
 
     }
 };
+
+// Records everything dispatched to it, so that two runs over the same stream can be compared.
+// Printed text is merged into a single entry no matter how it was split up between
+//      Print and PrintString calls, since that depends on where the input was chunked.
+class RecordingDispatch final : public TermDispatch
+{
+public:
+    virtual void Execute(const wchar_t wchControl) override
+    {
+        _Record(std::wstring(NoThrowString().Format(L"Execute(%d)", wchControl)));
+    }
+
+    virtual void Print(const wchar_t wchPrintable) override
+    {
+        PrintString(&wchPrintable, 1);
+    }
+
+    virtual void PrintString(const wchar_t* const rgwch, const size_t cch) override
+    {
+        if (cch == 0)
+        {
+            return;
+        }
+
+        if (!_fLastWasPrint)
+        {
+            _log.emplace_back(L"Print:");
+            _fLastWasPrint = true;
+        }
+        _log.back().append(rgwch, cch);
+    }
+
+    virtual bool CursorPosition(const unsigned int uiLine, const unsigned int uiColumn) override
+    {
+        _Record(std::wstring(NoThrowString().Format(L"CUP(%u,%u)", uiLine, uiColumn)));
+        return true;
+    }
+
+    virtual bool EraseInLine(const DispatchTypes::EraseType eraseType) override
+    {
+        _Record(std::wstring(NoThrowString().Format(L"EL(%d)", static_cast<int>(eraseType))));
+        return true;
+    }
+
+    virtual bool SetGraphicsRendition(const DispatchTypes::GraphicsOptions* const rgOptions,
+                                      const size_t cOptions) override
+    {
+        std::wstring wstr(L"SGR(");
+        for (size_t i = 0; i < cOptions; i++)
+        {
+            wstr += std::to_wstring(static_cast<int>(rgOptions[i])) + L";";
+        }
+        _Record(wstr + L")");
+        return true;
+    }
+
+    virtual bool SetWindowTitle(std::wstring_view title) override
+    {
+        _Record(L"Title(" + std::wstring(title) + L")");
+        return true;
+    }
+
+    std::vector<std::wstring> _log;
+
+private:
+    void _Record(const std::wstring& wstr)
+    {
+        _log.emplace_back(wstr);
+        _fLastWasPrint = false;
+    }
+
+    bool _fLastWasPrint = false;
+};
+
+class StateMachineConcurrencyTest final
+{
+    TEST_CLASS(StateMachineConcurrencyTest);
+
+    // Builds a stream with printable text interleaved with the sequences
+    //      RecordingDispatch understands, varied by the seed.
+    static std::wstring _MakeStream(const unsigned int uiSeed)
+    {
+        std::mt19937 rng(uiSeed);
+        std::uniform_int_distribution<int> piece(0, 5);
+        std::uniform_int_distribution<int> value(0, 120);
+
+        std::wstring wstr;
+        for (int i = 0; i < 2000; i++)
+        {
+            switch (piece(rng))
+            {
+            case 0:
+                wstr += L"Hello World " + std::to_wstring(value(rng));
+                break;
+            case 1:
+                wstr += L"\x1b[" + std::to_wstring(value(rng)) + L";" + std::to_wstring(value(rng)) + L"H";
+                break;
+            case 2:
+                wstr += L"\x1b[1;3" + std::to_wstring(value(rng) % 8) + L"m";
+                break;
+            case 3:
+                wstr += L"\x1b]0;title " + std::to_wstring(value(rng)) + L"\x7";
+                break;
+            case 4:
+                wstr += L"\x1b[K\r\n";
+                break;
+            default:
+                wstr += L"\x6f22\x5b57\x9b" L"2K";
+                break;
+            }
+        }
+        return wstr;
+    }
+
+    // Feeds the stream to the state machine in randomly sized chunks, so
+    //      that most sequences end up split across ProcessString calls.
+    static void _ProcessChunked(StateMachine& mach, const std::wstring& wstr, const unsigned int uiSeed)
+    {
+        std::mt19937 rng(uiSeed);
+        std::uniform_int_distribution<size_t> chunk(1, 7);
+
+        size_t i = 0;
+        while (i < wstr.size())
+        {
+            const size_t cch = std::min(chunk(rng), wstr.size() - i);
+            mach.ProcessString(wstr.data() + i, cch);
+            i += cch;
+            // Give the other threads a chance to interleave with us mid-sequence.
+            std::this_thread::yield();
+        }
+    }
+
+    TEST_METHOD(TestParallelChunkedStreams)
+    {
+        const unsigned int cMachines = 8;
+
+        Log::Comment(L"Parse each stream in one piece on this thread to get the expected dispatches.");
+        std::vector<std::wstring> rgStreams;
+        std::vector<std::vector<std::wstring>> rgExpected;
+        for (unsigned int i = 0; i < cMachines; i++)
+        {
+            rgStreams.push_back(_MakeStream(i));
+
+            auto pDispatch = new RecordingDispatch;
+            StateMachine mach(new OutputStateMachineEngine(pDispatch));
+            mach.ProcessString(rgStreams.back());
+            rgExpected.push_back(pDispatch->_log);
+        }
+
+        Log::Comment(L"Parse the same streams in small chunks on one thread per state machine.");
+        std::vector<RecordingDispatch*> rgDispatches;
+        std::vector<std::unique_ptr<StateMachine>> rgMachines;
+        for (unsigned int i = 0; i < cMachines; i++)
+        {
+            rgDispatches.push_back(new RecordingDispatch);
+            rgMachines.push_back(std::make_unique<StateMachine>(new OutputStateMachineEngine(rgDispatches.back())));
+        }
+
+        std::vector<std::thread> rgThreads;
+        for (unsigned int i = 0; i < cMachines; i++)
+        {
+            rgThreads.emplace_back([&, i]() {
+                _ProcessChunked(*rgMachines[i], rgStreams[i], 1000 + i);
+            });
+        }
+        for (auto& thread : rgThreads)
+        {
+            thread.join();
+        }
+
+        for (unsigned int i = 0; i < cMachines; i++)
+        {
+            Log::Comment(NoThrowString().Format(L"Checking state machine %u", i));
+            VERIFY_ARE_EQUAL(rgExpected[i].size(), rgDispatches[i]->_log.size());
+            for (size_t j = 0; j < rgExpected[i].size(); j++)
+            {
+                VERIFY_ARE_EQUAL(String(rgExpected[i][j].c_str()), String(rgDispatches[i]->_log[j].c_str()));
+            }
+        }
+    }
+};
+
+class StateMachineUtf8Test final
+{
+    TEST_CLASS(StateMachineUtf8Test);
+
+    // "Hello " (ASCII), e-acute (2 bytes), a CJK char (3 bytes), an emoji (4 bytes),
+    //      an SGR, a title with non-ASCII in it, a C1 CSI (0xC2 0x9B) and some more text.
+    static std::string _Utf8Stream()
+    {
+        return "Hello \xc3\xa9\xe6\xbc\xa2\xf0\x9f\x98\x80\x1b[1;31mred\x1b]0;t\xc3\xadtulo\x07\xc2\x9b" "2Kdone\r\n";
+    }
+
+    static std::wstring _Utf16Stream()
+    {
+        return L"Hello \x00e9\x6f22\xd83d\xde00\x1b[1;31mred\x1b]0;t\x00edtulo\x07\x9b" L"2Kdone\r\n";
+    }
+
+    static std::vector<std::wstring> _ExpectedLog()
+    {
+        auto pDispatch = new RecordingDispatch;
+        StateMachine mach(new OutputStateMachineEngine(pDispatch));
+        mach.ProcessString(_Utf16Stream());
+        return pDispatch->_log;
+    }
+
+    static void _VerifyLog(const std::vector<std::wstring>& expected, const std::vector<std::wstring>& actual)
+    {
+        VERIFY_ARE_EQUAL(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            VERIFY_ARE_EQUAL(String(expected[i].c_str()), String(actual[i].c_str()));
+        }
+    }
+
+    TEST_METHOD(TestUtf8WholeString)
+    {
+        auto pDispatch = new RecordingDispatch;
+        StateMachine mach(new OutputStateMachineEngine(pDispatch));
+        mach.ProcessUtf8(_Utf8Stream());
+
+        _VerifyLog(_ExpectedLog(), pDispatch->_log);
+    }
+
+    TEST_METHOD(TestUtf8SplitAtEveryByte)
+    {
+        const auto expected = _ExpectedLog();
+        const auto utf8 = _Utf8Stream();
+
+        for (size_t i = 1; i < utf8.size(); i++)
+        {
+            Log::Comment(NoThrowString().Format(L"Splitting after byte %zu", i));
+            auto pDispatch = new RecordingDispatch;
+            StateMachine mach(new OutputStateMachineEngine(pDispatch));
+            mach.ProcessUtf8(std::string_view(utf8).substr(0, i));
+            mach.ProcessUtf8(std::string_view(utf8).substr(i));
+
+            _VerifyLog(expected, pDispatch->_log);
+        }
+    }
+
+    TEST_METHOD(TestUtf8OneByteAtATime)
+    {
+        const auto utf8 = _Utf8Stream();
+
+        auto pDispatch = new RecordingDispatch;
+        StateMachine mach(new OutputStateMachineEngine(pDispatch));
+        for (const auto ch : utf8)
+        {
+            mach.ProcessUtf8(std::string_view(&ch, 1));
+        }
+
+        _VerifyLog(_ExpectedLog(), pDispatch->_log);
+    }
+
+    TEST_METHOD(TestUtf8InvalidSequences)
+    {
+        auto pDispatch = new RecordingDispatch;
+        StateMachine mach(new OutputStateMachineEngine(pDispatch));
+
+        Log::Comment(L"A lone continuation byte, and a lead byte cut short by an ESC, both become U+FFFD.");
+        mach.ProcessUtf8("a\x80" "b\xe6\xbc");
+        mach.ProcessUtf8("\x1b[mc");
+
+        const std::vector<std::wstring> expected = { L"Print:a\xfffd" L"b\xfffd", L"SGR(0;)", L"Print:c" };
+        _VerifyLog(expected, pDispatch->_log);
+    }
+
+    TEST_METHOD(TestUtf8InvalidSequencesDropped)
+    {
+        auto pDispatch = new RecordingDispatch;
+        StateMachine mach(new OutputStateMachineEngine(pDispatch));
+
+        Log::Comment(L"When asked to, invalid sequences are left out instead, in printable text and inside sequences.");
+        mach.ProcessUtf8("a\x80" "b\xe6\xbc", true);
+        mach.ProcessUtf8("\x1b[3\xff" "1mc\xc3", true);
+        mach.ProcessUtf8("\xa9\xf0\x9f", true);
+        mach.ProcessUtf8("d", true);
+
+        const std::vector<std::wstring> expected = { L"Print:ab", L"SGR(31;)", L"Print:c\x00e9" L"d" };
+        _VerifyLog(expected, pDispatch->_log);
+    }
+};
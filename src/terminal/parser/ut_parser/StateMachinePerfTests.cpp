@@ -0,0 +1,509 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include <wextestclass.h>
+#include "../../inc/consoletaeftemplates.hpp"
+
+#include "stateMachine.hpp"
+#include "OutputStateMachineEngine.hpp"
+
+#include "ascii.hpp"
+
+using namespace Microsoft::Console::VirtualTerminal;
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+namespace Microsoft
+{
+    namespace Console
+    {
+        namespace VirtualTerminal
+        {
+            class StateMachinePerfTests;
+        }
+    }
+}
+
+// Counts what the parser hands to the dispatch, so the optimizer can't throw the work away.
+class CountingDispatch final : public TermDispatch
+{
+public:
+    virtual void Execute(const wchar_t /*wchControl*/) override
+    {
+        _cExecuted++;
+    }
+
+    virtual void Print(const wchar_t /*wchPrintable*/) override
+    {
+        _cPrinted++;
+    }
+
+    virtual void PrintString(const wchar_t* const /*rgwch*/, const size_t cch) override
+    {
+        _cPrinted += cch;
+    }
+
+    virtual bool SetGraphicsRendition(const DispatchTypes::GraphicsOptions* const /*rgOptions*/,
+                                      const size_t /*cOptions*/) override
+    {
+        _cSequences++;
+        return true;
+    }
+
+    size_t _cExecuted = 0;
+    size_t _cPrinted = 0;
+    size_t _cSequences = 0;
+};
+
+class Microsoft::Console::VirtualTerminal::StateMachinePerfTests final
+{
+    TEST_CLASS(StateMachinePerfTests);
+
+    // Each corpus is repeated until it is roughly this many characters long.
+    static const size_t s_cchCorpus = 4 * 1024 * 1024;
+    static const size_t s_cIterations = 10;
+
+    static std::wstring _MakeCorpus(const std::wstring& wstrLine)
+    {
+        std::wstring wstr;
+        wstr.reserve(s_cchCorpus + wstrLine.size());
+        while (wstr.size() < s_cchCorpus)
+        {
+            wstr += wstrLine;
+        }
+        return wstr;
+    }
+
+    // Plain build-log style output. Only the line endings are actionable.
+    static std::wstring _MakeAsciiCorpus()
+    {
+        return _MakeCorpus(L"cl.exe /c /Zi /nologo /W4 /WX /O2 src\\terminal\\parser\\stateMachine.cpp /Fo:obj\\stateMachine.obj\r\n");
+    }
+
+    // Colorized compiler output - a few SGRs on every line.
+    static std::wstring _MakeSgrCorpus()
+    {
+        return _MakeCorpus(L"\x1b[1m\x1b[31merror\x1b[0m C2065: '\x1b[1mfoo\x1b[0m': undeclared identifier \x1b[38;2;128;128;128m(stateMachine.cpp:42)\x1b[m\r\n");
+    }
+
+    // CJK text, which is entirely outside of the ASCII range.
+    static std::wstring _MakeCjkCorpus()
+    {
+        return _MakeCorpus(L"\x6f22\x5b57\x304b\x306a\x4ea4\x3058\x308a\x6587\x3002\x3053\x308c\x306f\x30c6\x30b9\x30c8\x3067\x3059\x3002\x4e2d\x6587\x6d4b\x8bd5\x3002\xd55c\xad6d\xc5b4\r\n");
+    }
+
+    // A vim redraw - every line is positioned, colored and erased on its own.
+    static std::wstring _MakeVimCorpus()
+    {
+        return _MakeCorpus(L"\x1b[?25l\x1b[12;1H\x1b[38;5;130m 12 \x1b[m\x1b[38;5;121mvoid\x1b[m \x1b[38;5;81mStateMachine\x1b[m::ProcessString(\x1b[38;5;121mconst\x1b[m \x1b[38;5;121mwchar_t\x1b[m* rgwch)\x1b[K\x1b[13;1H\x1b[38;5;130m 13 \x1b[m{\x1b[K\x1b[?12l\x1b[?25h");
+    }
+
+    // An htop refresh - short, dense runs of cursor movement, colors, and a title update.
+    static std::wstring _MakeHtopCorpus()
+    {
+        return _MakeCorpus(L"\x1b]0;htop\x07\x1b(B\x1b[m\x1b[3;3H\x1b[1m\x1b[36m1\x1b[39m\x1b[1m[\x1b[32m||||\x1b[31m||\x1b[90m          \x1b[39m12.5%\x1b[1m]\x1b[m\x1b[4;3H\x1b[30m\x1b[46m  PID USER      PRI  NI  VIRT   RES \x1b[m\x1b[5;1H\x1b[1m 1337\x1b[m root       20   0 \x1b[36m 9.8G\x1b[m  412M\x1b[K");
+    }
+
+    // ls --color - a short colored name per few characters.
+    static std::wstring _MakeLsColorCorpus()
+    {
+        return _MakeCorpus(L"\x1b[0m\x1b[01;34mbin\x1b[0m  \x1b[01;32mbuild.sh\x1b[0m  \x1b[01;36mlib64\x1b[0m  \x1b[40;31;01mbroken\x1b[0m  README.md  \x1b[01;31mrelease.tar.gz\x1b[0m\r\n");
+    }
+
+    // Routine Description:
+    // - The transition the state machine made before it was table driven, when
+    //      every state chained through the s_Is* predicates. This is the oracle
+    //      for the generated table, and the baseline for measuring it.
+    static StateMachine::VTTransition _LegacyTransition(const StateMachine::VTStates state, const wchar_t wch)
+    {
+        using S = StateMachine::VTStates;
+        using A = StateMachine::VTActions;
+        const auto stay = [state](const A action) { return StateMachine::VTTransition{ action, false, state }; };
+        const auto enter = [](const A action, const S nextState) { return StateMachine::VTTransition{ action, true, nextState }; };
+
+        const bool fIsParam = StateMachine::s_IsCsiParamValue(wch) || StateMachine::s_IsCsiDelimiter(wch);
+
+        if (wch == AsciiChars::CAN || wch == AsciiChars::SUB)
+        {
+            return enter(A::Execute, S::Ground);
+        }
+        else if (StateMachine::s_IsEscape(wch) && state != S::OscString)
+        {
+            return enter(A::None, S::Escape);
+        }
+
+        switch (state)
+        {
+        case S::Ground:
+            if (StateMachine::s_IsC0Code(wch) || StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Execute);
+            }
+            return StateMachine::s_IsC1Csi(wch) ? enter(A::None, S::CsiEntry) : stay(A::Print);
+        case S::Escape:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::ExecuteFromEscape);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            else if (StateMachine::s_IsIntermediate(wch))
+            {
+                return enter(A::Collect, S::EscapeIntermediate);
+            }
+            else if (StateMachine::s_IsCsiIndicator(wch))
+            {
+                return enter(A::None, S::CsiEntry);
+            }
+            else if (StateMachine::s_IsOscIndicator(wch))
+            {
+                return enter(A::None, S::OscParam);
+            }
+            else if (StateMachine::s_IsSs3Indicator(wch))
+            {
+                return enter(A::None, S::Ss3Entry);
+            }
+            return enter(A::EscDispatch, S::Ground);
+        case S::EscapeIntermediate:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsIntermediate(wch))
+            {
+                return stay(A::Collect);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            return enter(A::EscDispatch, S::Ground);
+        case S::CsiEntry:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            else if (StateMachine::s_IsIntermediate(wch))
+            {
+                return enter(A::Collect, S::CsiIntermediate);
+            }
+            else if (StateMachine::s_IsCsiInvalid(wch))
+            {
+                return enter(A::None, S::CsiIgnore);
+            }
+            else if (fIsParam)
+            {
+                return enter(A::Param, S::CsiParam);
+            }
+            else if (StateMachine::s_IsCsiPrivateMarker(wch))
+            {
+                return enter(A::Collect, S::CsiParam);
+            }
+            return enter(A::CsiDispatch, S::Ground);
+        case S::CsiIntermediate:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsIntermediate(wch))
+            {
+                return stay(A::Collect);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            else if (fIsParam || StateMachine::s_IsCsiInvalid(wch) || StateMachine::s_IsCsiPrivateMarker(wch))
+            {
+                return enter(A::None, S::CsiIgnore);
+            }
+            return enter(A::CsiDispatch, S::Ground);
+        case S::CsiIgnore:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsDelete(wch) ||
+                     StateMachine::s_IsIntermediate(wch) ||
+                     fIsParam ||
+                     StateMachine::s_IsCsiInvalid(wch) ||
+                     StateMachine::s_IsCsiPrivateMarker(wch))
+            {
+                return stay(A::Ignore);
+            }
+            return enter(A::None, S::Ground);
+        case S::CsiParam:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            else if (fIsParam)
+            {
+                return stay(A::Param);
+            }
+            else if (StateMachine::s_IsIntermediate(wch))
+            {
+                return enter(A::Collect, S::CsiIntermediate);
+            }
+            else if (StateMachine::s_IsCsiInvalid(wch) || StateMachine::s_IsCsiPrivateMarker(wch))
+            {
+                return enter(A::None, S::CsiIgnore);
+            }
+            return enter(A::CsiDispatch, S::Ground);
+        case S::OscParam:
+            if (StateMachine::s_IsOscTerminator(wch))
+            {
+                return enter(A::None, S::Ground);
+            }
+            else if (StateMachine::s_IsOscParamValue(wch))
+            {
+                return stay(A::OscParam);
+            }
+            else if (StateMachine::s_IsOscDelimiter(wch))
+            {
+                return enter(A::None, S::OscString);
+            }
+            return stay(A::Ignore);
+        case S::OscString:
+            if (StateMachine::s_IsOscTerminator(wch))
+            {
+                return enter(A::OscDispatch, S::Ground);
+            }
+            else if (StateMachine::s_IsOscTerminationInitiator(wch))
+            {
+                return enter(A::None, S::OscTermination);
+            }
+            return StateMachine::s_IsOscInvalid(wch) ? stay(A::Ignore) : stay(A::OscPut);
+        case S::OscTermination:
+            return enter(A::OscDispatch, S::Ground);
+        case S::Ss3Entry:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            else if (StateMachine::s_IsCsiInvalid(wch))
+            {
+                return enter(A::None, S::CsiIgnore);
+            }
+            else if (fIsParam)
+            {
+                return enter(A::Param, S::Ss3Param);
+            }
+            return enter(A::Ss3Dispatch, S::Ground);
+        case S::Ss3Param:
+            if (StateMachine::s_IsC0Code(wch))
+            {
+                return stay(A::Execute);
+            }
+            else if (StateMachine::s_IsDelete(wch))
+            {
+                return stay(A::Ignore);
+            }
+            else if (fIsParam)
+            {
+                return stay(A::Param);
+            }
+            else if (StateMachine::s_IsCsiInvalid(wch) || StateMachine::s_IsCsiPrivateMarker(wch))
+            {
+                return enter(A::None, S::CsiIgnore);
+            }
+            return enter(A::Ss3Dispatch, S::Ground);
+        default:
+            return stay(A::None);
+        }
+    }
+
+    // Runs a corpus through just the dispatch decisions (no actions), following
+    //      the state changes, and returns a checksum of the actions taken.
+    template<typename TLookup>
+    static size_t _WalkTransitions(const std::wstring& wstrCorpus, TLookup lookup)
+    {
+        size_t cChecksum = 0;
+        auto state = StateMachine::VTStates::Ground;
+        for (const auto wch : wstrCorpus)
+        {
+            const StateMachine::VTTransition transition = lookup(state, wch);
+            cChecksum = cChecksum * 31 + static_cast<size_t>(transition.action);
+            if (transition.fEnterState)
+            {
+                state = transition.nextState;
+            }
+        }
+        return cChecksum;
+    }
+
+    static void _MeasureDispatch(const wchar_t* const pwszName, const std::wstring& wstrCorpus)
+    {
+        size_t cChecksumLegacy = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < s_cIterations; i++)
+        {
+            cChecksumLegacy += _WalkTransitions(wstrCorpus, _LegacyTransition);
+        }
+        const auto deltaLegacy = std::chrono::steady_clock::now() - start;
+
+        size_t cChecksumTable = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < s_cIterations; i++)
+        {
+            cChecksumTable += _WalkTransitions(wstrCorpus, StateMachine::s_GetTransition);
+        }
+        const auto deltaTable = std::chrono::steady_clock::now() - start;
+
+        VERIFY_ARE_EQUAL(cChecksumLegacy, cChecksumTable);
+        Log::Comment(NoThrowString().Format(L"Dispatch %s: predicate chains %.1f MB/s, transition table %.1f MB/s",
+                                            pwszName,
+                                            _MegabytesPerSecond(wstrCorpus.size() * s_cIterations, deltaLegacy),
+                                            _MegabytesPerSecond(wstrCorpus.size() * s_cIterations, deltaTable)));
+    }
+
+    static double _MegabytesPerSecond(const size_t cch, const std::chrono::steady_clock::duration duration)
+    {
+        const double dSeconds = std::chrono::duration<double>(duration).count();
+        const double dMegabytes = static_cast<double>(cch * sizeof(wchar_t)) / (1024.0 * 1024.0);
+        return dSeconds > 0 ? dMegabytes / dSeconds : 0;
+    }
+
+    static void _MeasureProcessString(const wchar_t* const pwszName, const std::wstring& wstrCorpus)
+    {
+        auto pDispatch = new CountingDispatch;
+        StateMachine mach(new OutputStateMachineEngine(pDispatch));
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < s_cIterations; i++)
+        {
+            mach.ProcessString(wstrCorpus);
+        }
+        const auto delta = std::chrono::steady_clock::now() - start;
+
+        VERIFY_IS_GREATER_THAN(pDispatch->_cPrinted, 0u);
+        Log::Comment(NoThrowString().Format(L"ProcessString %s: %zu chars x %zu took %lld ms (%.1f MB/s)",
+                                            pwszName,
+                                            wstrCorpus.size(),
+                                            s_cIterations,
+                                            std::chrono::duration_cast<std::chrono::milliseconds>(delta).count(),
+                                            _MegabytesPerSecond(wstrCorpus.size() * s_cIterations, delta)));
+    }
+
+    static void _MeasureScanner(const wchar_t* const pwszName, const std::wstring& wstrCorpus)
+    {
+        const wchar_t* const pwchBegin = wstrCorpus.data();
+        const wchar_t* const pwchEnd = pwchBegin + wstrCorpus.size();
+
+        // Baseline: the character-at-a-time test ProcessString used to do.
+        size_t cActionableScalar = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < s_cIterations; i++)
+        {
+            for (const wchar_t* pwch = pwchBegin; pwch < pwchEnd; pwch++)
+            {
+                if (StateMachine::s_IsActionableFromGround(*pwch))
+                {
+                    cActionableScalar++;
+                }
+            }
+        }
+        const auto deltaScalar = std::chrono::steady_clock::now() - start;
+
+        size_t cActionableVector = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < s_cIterations; i++)
+        {
+            for (const wchar_t* pwch = StateMachine::s_FindActionableFromGround(pwchBegin, pwchEnd);
+                 pwch < pwchEnd;
+                 pwch = StateMachine::s_FindActionableFromGround(pwch + 1, pwchEnd))
+            {
+                cActionableVector++;
+            }
+        }
+        const auto deltaVector = std::chrono::steady_clock::now() - start;
+
+        VERIFY_ARE_EQUAL(cActionableScalar, cActionableVector);
+        Log::Comment(NoThrowString().Format(L"Ground scan %s: per-character %.1f MB/s, s_FindActionableFromGround %.1f MB/s",
+                                            pwszName,
+                                            _MegabytesPerSecond(wstrCorpus.size() * s_cIterations, deltaScalar),
+                                            _MegabytesPerSecond(wstrCorpus.size() * s_cIterations, deltaVector)));
+    }
+
+    TEST_METHOD(TransitionTableMatchesPredicates)
+    {
+        Log::Comment(L"Every state and every character must transition exactly as the predicate chains did.");
+
+        size_t cMismatches = 0;
+        for (size_t state = 0; state < StateMachine::s_cStates; state++)
+        {
+            const auto vtState = static_cast<StateMachine::VTStates>(state);
+            for (size_t wch = 0; wch <= 0xFFFF; wch++)
+            {
+                const auto expected = _LegacyTransition(vtState, static_cast<wchar_t>(wch));
+                const auto& actual = StateMachine::s_GetTransition(vtState, static_cast<wchar_t>(wch));
+
+                if (expected.action != actual.action ||
+                    expected.fEnterState != actual.fEnterState ||
+                    (expected.fEnterState && expected.nextState != actual.nextState))
+                {
+                    if (cMismatches++ < 10)
+                    {
+                        Log::Comment(NoThrowString().Format(L"Mismatch in state %zu for 0x%04zx", state, wch));
+                    }
+                }
+            }
+        }
+        VERIFY_ARE_EQUAL(0u, cMismatches);
+    }
+
+    TEST_METHOD(EscapeHeavyDispatchThroughput)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+        END_TEST_METHOD_PROPERTIES()
+
+        _MeasureDispatch(L"vim", _MakeVimCorpus());
+        _MeasureDispatch(L"htop", _MakeHtopCorpus());
+        _MeasureDispatch(L"ls --color", _MakeLsColorCorpus());
+        _MeasureDispatch(L"SGR", _MakeSgrCorpus());
+
+        _MeasureProcessString(L"vim", _MakeVimCorpus());
+        _MeasureProcessString(L"htop", _MakeHtopCorpus());
+        _MeasureProcessString(L"ls --color", _MakeLsColorCorpus());
+    }
+
+    TEST_METHOD(GroundScanThroughput)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+        END_TEST_METHOD_PROPERTIES()
+
+        _MeasureScanner(L"ASCII", _MakeAsciiCorpus());
+        _MeasureScanner(L"SGR", _MakeSgrCorpus());
+        _MeasureScanner(L"CJK", _MakeCjkCorpus());
+    }
+
+    TEST_METHOD(ProcessStringThroughput)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"IsPerfTest", L"true")
+        END_TEST_METHOD_PROPERTIES()
+
+        _MeasureProcessString(L"ASCII", _MakeAsciiCorpus());
+        _MeasureProcessString(L"SGR", _MakeSgrCorpus());
+        _MeasureProcessString(L"CJK", _MakeCjkCorpus());
+    }
+};
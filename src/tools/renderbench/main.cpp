@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// RenderBench plays recorded VT output through the terminal and the renderer,
+//      painting frames with the headless engine, and reports how fast it went.
+// It doesn't need a window or a display, so it can run on a build machine.
+//
+// Record something to play back with one of the scripts in src/tools/vttests:
+//      python render-bench.py > render-bench.vt
+// Then:
+//      RenderBench.exe [-w columns] [-h rows] [-c chars] file.vt [file.vt...]
+
+#include <windows.h>
+
+#include "LibraryIncludes.h"
+
+#include <chrono>
+#include <fstream>
+
+#include "..\..\cascadia\TerminalCore\Terminal.hpp"
+#include "..\..\renderer\base\renderer.hpp"
+#include "..\..\renderer\headless\HeadlessEngine.hpp"
+#include "..\..\types\inc\convert.hpp"
+#include "..\..\types\inc\GlyphWidth.hpp"
+#include "..\..\types\inc\Utf16Parser.hpp"
+
+using namespace Microsoft::Console::Render;
+using namespace Microsoft::Console::Types;
+using namespace Microsoft::Terminal::Core;
+
+// Frames are painted when the benchmark says so, after each write, rather than
+//      on a thread of their own.
+class ManualRenderThread final : public IRenderThread
+{
+public:
+    void NotifyPaint() override {}
+    void EnablePainting() override {}
+    void WaitForPaintCompletionAndDisable(const DWORD /*dwTimeoutMs*/) override {}
+};
+
+struct Options
+{
+    COORD size{ 120, 30 };
+    // How much is written to the terminal between frames. About what a
+    //      connection hands over from one read of its pipe.
+    size_t charsPerFrame = 4096;
+    std::vector<std::wstring> files;
+};
+
+struct Results
+{
+    std::vector<double> frameMicroseconds;
+    size_t cellsPainted = 0;
+    double writeMicroseconds = 0;
+};
+
+static void _PrintUsage()
+{
+    wprintf(L"Usage: RenderBench [-w columns] [-h rows] [-c chars] file.vt [file.vt...]\n");
+    wprintf(L"    -w, -h   the size of the terminal. Defaults to 120x30.\n");
+    wprintf(L"    -c       how many characters to write between frames. Defaults to 4096.\n");
+    wprintf(L"Each file is UTF-8 text, as written to a terminal. See src/tools/vttests.\n");
+}
+
+static bool _ParseArgs(const int argc, const wchar_t* const argv[], Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::wstring_view arg{ argv[i] };
+        if ((arg == L"-w" || arg == L"-h" || arg == L"-c") && i + 1 < argc)
+        {
+            const auto value = wcstoul(argv[++i], nullptr, 10);
+            if (value == 0 || value > SHRT_MAX)
+            {
+                return false;
+            }
+
+            if (arg == L"-w")
+            {
+                options.size.X = gsl::narrow<SHORT>(value);
+            }
+            else if (arg == L"-h")
+            {
+                options.size.Y = gsl::narrow<SHORT>(value);
+            }
+            else
+            {
+                options.charsPerFrame = value;
+            }
+        }
+        else if (!arg.empty() && arg[0] == L'-')
+        {
+            return false;
+        }
+        else
+        {
+            options.files.emplace_back(arg);
+        }
+    }
+    return !options.files.empty();
+}
+
+static std::wstring _ReadCorpus(const std::wstring& path)
+{
+    std::ifstream file{ path, std::ios::binary };
+    THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND), !file);
+
+    const std::string utf8{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+    return ConvertToW(CP_UTF8, utf8);
+}
+
+// Writes the corpus to a fresh terminal a piece at a time, painting a frame
+//      after each piece, and times the frames.
+static Results _Play(const std::wstring_view corpus, const Options& options)
+{
+    Results results;
+
+    // The renderer paints from the terminal with the engine, so it's declared
+    //      after both of them, to be destroyed before they are.
+    HeadlessEngine engine{ Viewport::FromDimensions({ 0, 0 }, options.size) };
+    Terminal terminal;
+    IRenderEngine* engines[] = { &engine };
+    Renderer renderer{ &terminal, engines, ARRAYSIZE(engines), std::make_unique<ManualRenderThread>() };
+
+    SetGlyphWidthFallback(std::bind(&Renderer::IsGlyphWideByFont, &renderer, std::placeholders::_1));
+    terminal.Create(options.size, 0, renderer);
+
+    results.frameMicroseconds.reserve(corpus.size() / options.charsPerFrame + 1);
+
+    for (size_t offset = 0; offset < corpus.size();)
+    {
+        // Don't split a surrogate pair between two writes. Back off a char, or
+        //      take the whole pair if that would leave nothing to write.
+        size_t count = options.charsPerFrame;
+        if (offset + count >= corpus.size())
+        {
+            count = corpus.size() - offset;
+        }
+        else if (Utf16Parser::IsLeadingSurrogate(corpus[offset + count - 1]))
+        {
+            count = count > 1 ? count - 1 : count + 1;
+        }
+
+        const auto writeStart = std::chrono::steady_clock::now();
+        terminal.Write(corpus.substr(offset, count));
+        const auto writeEnd = std::chrono::steady_clock::now();
+        offset += count;
+
+        const auto framesBefore = engine.GetFramesPainted();
+        LOG_IF_FAILED(renderer.PaintFrame());
+        const auto paintEnd = std::chrono::steady_clock::now();
+
+        results.writeMicroseconds += std::chrono::duration<double, std::micro>(writeEnd - writeStart).count();
+
+        // Writes that don't change anything on the screen don't make a frame.
+        if (engine.GetFramesPainted() != framesBefore)
+        {
+            results.frameMicroseconds.push_back(std::chrono::duration<double, std::micro>(paintEnd - writeEnd).count());
+            results.cellsPainted += engine.GetCellsPainted();
+        }
+    }
+
+    return results;
+}
+
+// Gets the frame time that the given fraction of frames took no longer than.
+static double _Percentile(std::vector<double> frameMicroseconds, const double fraction)
+{
+    if (frameMicroseconds.empty())
+    {
+        return 0;
+    }
+
+    const auto nth = frameMicroseconds.begin() + static_cast<ptrdiff_t>(fraction * (frameMicroseconds.size() - 1));
+    std::nth_element(frameMicroseconds.begin(), nth, frameMicroseconds.end());
+    return *nth;
+}
+
+static void _Report(const std::wstring& name, const size_t corpusChars, const Results& results)
+{
+    const auto frames = results.frameMicroseconds.size();
+    double totalMicroseconds = 0;
+    for (const auto microseconds : results.frameMicroseconds)
+    {
+        totalMicroseconds += microseconds;
+    }
+
+    const double framesPerSecond = totalMicroseconds > 0 ? frames * 1000000.0 / totalMicroseconds : 0;
+    const double cellsPerFrame = frames > 0 ? static_cast<double>(results.cellsPainted) / frames : 0;
+
+    wprintf(L"%s: %zu chars, %zu frames\n", name.c_str(), corpusChars, frames);
+    wprintf(L"    painting: %.1f frames/s, p50 %.1f us, p99 %.1f us, %.1f cells/frame\n",
+            framesPerSecond,
+            _Percentile(results.frameMicroseconds, 0.50),
+            _Percentile(results.frameMicroseconds, 0.99),
+            cellsPerFrame);
+    wprintf(L"    writing: %.1f us in all\n", results.writeMicroseconds);
+}
+
+int __cdecl wmain(int argc, wchar_t* argv[])
+{
+    Options options;
+    if (!_ParseArgs(argc, argv, options))
+    {
+        _PrintUsage();
+        return 1;
+    }
+
+    int result = 0;
+    for (const auto& path : options.files)
+    {
+        try
+        {
+            const auto corpus = _ReadCorpus(path);
+            const auto results = _Play(corpus, options);
+            _Report(path, corpus.size(), results);
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION();
+            fwprintf(stderr, L"%s: couldn't be played back (0x%08x)\n", path.c_str(), static_cast<unsigned int>(wil::ResultFromCaughtException()));
+            result = 1;
+        }
+    }
+    return result;
+}
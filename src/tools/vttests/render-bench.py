@@ -0,0 +1,60 @@
+################################################################################
+#                                                                              #
+# Copyright (c) Microsoft Corporation.
+# Licensed under the MIT license.
+#                                                                              #
+################################################################################
+
+"""
+Writes the same VT output every time it's run, for RenderBench to play back.
+It has a bit of what makes the renderer work hard:
+ - colored lines scrolling by, like a build log
+ - the whole screen being redrawn in place, like top or a text editor
+ - wide glyphs and lots of color changes in one line
+"""
+import sys
+from common import *
+
+WIDTH = 120
+HEIGHT = 30
+
+def scrolling_log(lines):
+    colors = [32, 33, 36, 37, 91]
+    for i in range(lines):
+        sgr(colors[i % len(colors)])
+        write('[{:6}] '.format(i))
+        sgr(0)
+        write('building src/renderer/base/renderer.cpp ' * ((i % 3) + 1))
+        write('\n')
+
+def full_screen_redraws(frames):
+    alt_buffer()
+    for frame in range(frames):
+        for row in range(HEIGHT):
+            cupxy(0, row)
+            sgr_n([38, 5, (frame + row) % 256, 48, 5, (frame * 7 + row) % 256])
+            write('{:<{}}'.format('row {} of frame {}'.format(row, frame), WIDTH))
+        sgr(0)
+    main_buffer()
+
+def wide_and_colorful(lines):
+    for i in range(lines):
+        for column in range(WIDTH // 4):
+            sgr(31 + (i + column) % 7)
+            write(u'\u4e00x' if column % 2 else 'abcd')
+        sgr(0)
+        write('\n')
+
+# Run this file with:
+#   python render-bench.py > render-bench.vt
+# Then play it back with:
+#   RenderBench.exe -w 120 -h 30 render-bench.vt
+if __name__ == '__main__':
+    if len(sys.argv) > 2:
+        WIDTH = int(sys.argv[1])
+        HEIGHT = int(sys.argv[2])
+    clear_all()
+    scrolling_log(2000)
+    full_screen_redraws(200)
+    wide_and_colorful(500)
+    flush()
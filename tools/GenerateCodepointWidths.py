@@ -0,0 +1,96 @@
+# Copyright (c) Microsoft Corporation.
+# Licensed under the MIT license.
+
+# Generates the s_pages and s_leaves tables in src/types/CodepointWidthDetector.cpp
+# from the Unicode Character Database's EastAsianWidth.txt.
+#
+# Usage: python GenerateCodepointWidths.py EastAsianWidth.txt > tables.txt
+#
+# Paste the output over the two tables in CodepointWidthDetector.cpp. Wide (W) and
+# fullwidth (F) codepoints are wide, ambiguous (A) codepoints are ambiguous, every
+# other codepoint the file lists is narrow, and codepoints it doesn't list are invalid.
+
+import re
+import sys
+
+# These match CodepointWidth, and PageSize and CodepointsPerByte in CodepointWidthDetector.cpp.
+NARROW = 0
+WIDE = 1
+AMBIGUOUS = 2
+INVALID = 3
+
+PAGE_SIZE = 256
+CODEPOINTS_PER_BYTE = 4
+MAX_CODEPOINT = 0x10FFFF
+PAGES_PER_PLANE = 0x10000 // PAGE_SIZE
+
+WIDTHS = {
+    "W": WIDE,
+    "F": WIDE,
+    "A": AMBIGUOUS,
+    "N": NARROW,
+    "Na": NARROW,
+    "H": NARROW,
+}
+
+LINE = re.compile(r"^([0-9A-Fa-f]+)(?:\.\.([0-9A-Fa-f]+))?\s*;\s*(\w+)")
+
+
+def read_widths(path):
+    widths = [INVALID] * (MAX_CODEPOINT + 1)
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            match = LINE.match(line)
+            if not match:
+                continue
+            first = int(match.group(1), 16)
+            last = int(match.group(2), 16) if match.group(2) else first
+            width = WIDTHS[match.group(3)]
+            for codepoint in range(first, last + 1):
+                widths[codepoint] = width
+    return widths
+
+
+def pack_pages(widths):
+    pages = []
+    leaves = []
+    leaf_indices = {}
+    for start in range(0, MAX_CODEPOINT + 1, PAGE_SIZE):
+        page = bytearray(PAGE_SIZE // CODEPOINTS_PER_BYTE)
+        for offset in range(PAGE_SIZE):
+            page[offset // CODEPOINTS_PER_BYTE] |= widths[start + offset] << (offset % CODEPOINTS_PER_BYTE * 2)
+        page = bytes(page)
+        if page not in leaf_indices:
+            leaf_indices[page] = len(leaves)
+            leaves.append(page)
+        pages.append(leaf_indices[page])
+    if len(leaves) > 256:
+        sys.exit("too many distinct pages to index with a BYTE")
+    return pages, leaves
+
+
+def write_tables(pages, leaves, out):
+    out.write("static constexpr std::array<BYTE, (MaxCodepoint + 1) / PageSize> s_pages{\n")
+    for plane in range(len(pages) // PAGES_PER_PLANE):
+        out.write(f"    // plane {plane}\n")
+        for row in range(plane * PAGES_PER_PLANE, (plane + 1) * PAGES_PER_PLANE, 16):
+            out.write("    " + " ".join(f"{leaf:3d}," for leaf in pages[row:row + 16]) + "\n")
+    out.write("};\n")
+    out.write("\n")
+    out.write(f"static constexpr std::array<BYTE, {len(leaves)} * PageSize / CodepointsPerByte> s_leaves{{\n")
+    for index, leaf in enumerate(leaves):
+        out.write(f"    // page {index}\n")
+        for row in range(0, len(leaf), 16):
+            out.write("    " + " ".join(f"0x{widths:02x}," for widths in leaf[row:row + 16]) + "\n")
+    out.write("};\n")
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: GenerateCodepointWidths.py EastAsianWidth.txt")
+    pages, leaves = pack_pages(read_widths(sys.argv[1]))
+    write_tables(pages, leaves, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()